@@ -8,7 +8,22 @@ import {
 } from 'react-native';
 import * as exampleByName from './examples';
 import {NavigationContainer, Page} from './components';
-import {Benchmarker, DeepTree, SierpinskiTriangle} from './benchmarks';
+import {
+  AsyncBenchmarker,
+  Benchmarker,
+  DeepTree,
+  MixedComponentsList,
+  SierpinskiTriangle,
+  downloadLargeJson,
+  LARGE_JSON_SIZES_IN_MB,
+  callSyncTurboModule,
+  TURBO_MODULE_PAYLOAD_SHAPES,
+  sendBinaryMessages,
+  WEBSOCKET_MESSAGE_SIZES_IN_MB,
+  roundTripBlob,
+  BLOB_SIZES_IN_MB,
+  StartupReport,
+} from './benchmarks';
 import {PortalHost, PortalProvider} from '@gorhom/portal';
 import * as testSuiteByName from './tests';
 import {Tester} from '@rnoh/testerino';
@@ -64,6 +79,19 @@ function App() {
                 }
               />
             </Page>
+            <Page name="BENCHMARK: MOUNTING MIXED COMPONENTS (500 rows)">
+              <Benchmarker
+                samplesCount={20}
+                renderContent={refreshKey =>
+                  refreshKey % 2 === 0 ? (
+                    <MixedComponentsList
+                      rowsCount={500}
+                      renderCount={refreshKey}
+                    />
+                  ) : null
+                }
+              />
+            </Page>
             <Page name="BENCHMARK: UPDATING COLORS">
               <Benchmarker
                 samplesCount={100}
@@ -92,6 +120,58 @@ function App() {
                 )}
               />
             </Page>
+            <Page name="BENCHMARK: STARTUP (TIME TO FIRST JS, PEAK RSS)">
+              <StartupReport />
+            </Page>
+            {LARGE_JSON_SIZES_IN_MB.flatMap(sizeInMB =>
+              (['text', 'base64'] as const).map(responseType => (
+                <Page
+                  key={`${sizeInMB}-${responseType}`}
+                  name={`BENCHMARK: NETWORKING (${sizeInMB} MB JSON, ${responseType})`}>
+                  <AsyncBenchmarker
+                    samplesCount={10}
+                    bytesPerSample={sizeInMB * 1024 * 1024}
+                    runSample={() => downloadLargeJson(sizeInMB, responseType)}
+                  />
+                </Page>
+              )),
+            )}
+            {WEBSOCKET_MESSAGE_SIZES_IN_MB.map(sizeInMB => (
+              <Page
+                key={sizeInMB}
+                name={`BENCHMARK: WEBSOCKET BINARY MESSAGE (${sizeInMB} MB)`}>
+                <AsyncBenchmarker
+                  samplesCount={5}
+                  bytesPerSample={sizeInMB * 1024 * 1024}
+                  runSample={() =>
+                    sendBinaryMessages(1, sizeInMB * 1024 * 1024)
+                  }
+                />
+              </Page>
+            ))}
+            {BLOB_SIZES_IN_MB.flatMap(sizeInMB =>
+              (['arrayBuffer', 'base64'] as const).map(readMethod => (
+                <Page
+                  key={`${sizeInMB}-${readMethod}`}
+                  name={`BENCHMARK: BLOB ROUND TRIP (${sizeInMB} MB, ${readMethod})`}>
+                  <AsyncBenchmarker
+                    samplesCount={5}
+                    bytesPerSample={sizeInMB * 1024 * 1024}
+                    runSample={() => roundTripBlob(sizeInMB, readMethod)}
+                  />
+                </Page>
+              )),
+            )}
+            {TURBO_MODULE_PAYLOAD_SHAPES.map(shape => (
+              <Page
+                key={shape}
+                name={`BENCHMARK: SYNC TURBO MODULE CALL (${shape})`}>
+                <AsyncBenchmarker
+                  samplesCount={1000}
+                  runSample={() => callSyncTurboModule(shape)}
+                />
+              </Page>
+            ))}
             {Object.entries(remainingExampleByName).map(
               ([exampleName, Example]) => {
                 return (
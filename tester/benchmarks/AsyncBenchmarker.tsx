@@ -0,0 +1,83 @@
+import {useState} from 'react';
+import {Text, TouchableOpacity, View} from 'react-native';
+
+/**
+ * Measures how long it takes to run `samplesCount` samples of an asynchronous
+ * operation, one after another. `runSample` may return a short description of
+ * a problem found in the sample, e.g. events received in a wrong order.
+ * If `bytesPerSample` is given, the throughput is displayed too.
+ */
+export function AsyncBenchmarker({
+  samplesCount,
+  runSample,
+  bytesPerSample,
+}: {
+  samplesCount: number;
+  runSample: (sampleIndex: number) => Promise<string | void>;
+  bytesPerSample?: number;
+}) {
+  const [status, setStatus] = useState<'READY' | 'RUNNING' | 'FINISHED'>(
+    'READY',
+  );
+  const [durationInMs, setDurationInMs] = useState(0);
+  const [problems, setProblems] = useState<string[]>([]);
+
+  async function start() {
+    setStatus('RUNNING');
+    setProblems([]);
+    const foundProblems: string[] = [];
+    const startTime = performance.now();
+    for (let i = 0; i < samplesCount; i++) {
+      try {
+        const problem = await runSample(i);
+        if (problem) {
+          foundProblems.push(problem);
+        }
+      } catch (error) {
+        foundProblems.push(String(error));
+      }
+    }
+    setDurationInMs(Math.round(performance.now() - startTime));
+    setProblems(foundProblems);
+    setStatus('FINISHED');
+  }
+
+  return (
+    <View style={{height: '100%', padding: 16, backgroundColor: 'white'}}>
+      <TouchableOpacity onPress={start} disabled={status === 'RUNNING'}>
+        <Text
+          style={{
+            width: 200,
+            height: 32,
+            fontWeight: 'bold',
+            color: status !== 'RUNNING' ? 'blue' : 'black',
+          }}>
+          {status === 'RUNNING' ? 'Running...' : 'Start'}
+        </Text>
+      </TouchableOpacity>
+
+      <View>
+        <Text style={{width: 256, height: 32}}>
+          Duration {durationInMs} ms ({samplesCount} samples)
+        </Text>
+        {status === 'FINISHED' && bytesPerSample !== undefined && (
+          <Text style={{width: 256, height: 32}}>
+            Throughput{' '}
+            {(
+              (bytesPerSample * samplesCount) /
+              (1024 * 1024) /
+              (durationInMs / 1000)
+            ).toFixed(1)}{' '}
+            MB/s
+          </Text>
+        )}
+        {status === 'FINISHED' && (
+          <Text style={{width: 256, height: 32}}>
+            Problems {problems.length}
+            {problems.length > 0 ? `: ${problems[0]}` : ''}
+          </Text>
+        )}
+      </View>
+    </View>
+  );
+}
@@ -0,0 +1,94 @@
+import {TurboModuleRegistry} from 'react-native';
+// @ts-ignore
+import BlobManager from 'react-native/Libraries/Blob/BlobManager';
+
+export const BLOB_SIZES_IN_MB = [1, 10, 50];
+
+export type BlobReadMethod = 'arrayBuffer' | 'base64';
+
+type BlobMetadata = {
+  blobId: string;
+  offset: number;
+  size: number;
+};
+
+/**
+ * RNOH extensions of BlobModule, which pass blob bytes as ArrayBuffers
+ * instead of base64 strings.
+ */
+type BinaryBlobModule = {
+  createFromArrayBuffer(buffer: ArrayBuffer, blobId: string): void;
+  getArrayBuffer(blob: BlobMetadata): Promise<ArrayBuffer>;
+  release(blobId: string): void;
+};
+
+let blobIdCounter = 0;
+
+function createBytes(sizeInBytes: number) {
+  const bytes = new Uint8Array(sizeInBytes);
+  for (let i = 0; i < sizeInBytes; i++) {
+    bytes[i] = i % 256;
+  }
+  return bytes.buffer;
+}
+
+function readAsDataURL(blobMetadata: BlobMetadata): Promise<string> {
+  return new Promise((resolve, reject) => {
+    const reader = new FileReader();
+    reader.onload = () => resolve(reader.result as string);
+    reader.onerror = () => reject(new Error('reading the blob failed'));
+    reader.readAsDataURL(
+      BlobManager.createFromOptions({
+        ...blobMetadata,
+        type: '',
+        lastModified: 0,
+      }),
+    );
+  });
+}
+
+/**
+ * Stores `sizeInMB` megabytes as a native blob and reads them back, either as
+ * an ArrayBuffer through the native binary path or as the base64 data URL
+ * FileReader produces.
+ */
+export async function roundTripBlob(
+  sizeInMB: number,
+  readMethod: BlobReadMethod,
+): Promise<string | void> {
+  const blobModule = TurboModuleRegistry.get<any>('BlobModule') as
+    | BinaryBlobModule
+    | undefined;
+  if (!blobModule?.createFromArrayBuffer || !blobModule?.getArrayBuffer) {
+    return 'BlobModule has no binary methods';
+  }
+  const sizeInBytes = sizeInMB * 1024 * 1024;
+  const blobMetadata = {
+    blobId: `blob-benchmark-${blobIdCounter++}`,
+    offset: 0,
+    size: sizeInBytes,
+  };
+  blobModule.createFromArrayBuffer(
+    createBytes(sizeInBytes),
+    blobMetadata.blobId,
+  );
+  try {
+    if (readMethod === 'arrayBuffer') {
+      const bytes = await blobModule.getArrayBuffer(blobMetadata);
+      if (bytes.byteLength !== sizeInBytes) {
+        return `received ${bytes.byteLength} bytes`;
+      }
+      if (new Uint8Array(bytes)[sizeInBytes - 1] !== (sizeInBytes - 1) % 256) {
+        return 'received different bytes';
+      }
+    } else {
+      const dataUrl = await readAsDataURL(blobMetadata);
+      const base64Length = dataUrl.length - dataUrl.indexOf(',') - 1;
+      if (base64Length < (sizeInBytes * 4) / 3) {
+        return `received ${base64Length} base64 characters`;
+      }
+    }
+  } finally {
+    blobModule.release(blobMetadata.blobId);
+  }
+}
@@ -0,0 +1,54 @@
+import React from 'react';
+import {Image, ScrollView, StyleSheet, Text, View} from 'react-native';
+
+/**
+ * A flat list of rows built from several component types, so that mounting
+ * it creates many instances of each of them through different component
+ * instance factories.
+ */
+export function MixedComponentsList({
+  rowsCount,
+  renderCount,
+}: {
+  rowsCount: number;
+  renderCount: number;
+}) {
+  return (
+    <ScrollView style={styles.container}>
+      {Array.from({length: rowsCount}).map((_, i) => (
+        <View key={i} style={styles.row}>
+          <Image
+            source={require('../assets/react-native-logo.png')}
+            style={styles.image}
+          />
+          <View style={styles.content}>
+            <Text style={styles.title}>Row {i}</Text>
+            <Text>Rendered {renderCount} times</Text>
+          </View>
+        </View>
+      ))}
+    </ScrollView>
+  );
+}
+
+const styles = StyleSheet.create({
+  container: {
+    flex: 1,
+  },
+  row: {
+    flexDirection: 'row',
+    height: 48,
+    alignItems: 'center',
+  },
+  image: {
+    width: 32,
+    height: 32,
+    marginRight: 8,
+  },
+  content: {
+    flex: 1,
+  },
+  title: {
+    fontWeight: 'bold',
+  },
+});
@@ -0,0 +1,63 @@
+/**
+ * JSON served by the tester's Metro server (see
+ * scripts/lib/create-large-json-middleware.js). The tester app reaches Metro
+ * through a reversed port, which makes it a local loopback server.
+ */
+const LARGE_JSON_URL = 'http://localhost:8081/benchmarks/large.json';
+
+export const LARGE_JSON_SIZES_IN_MB = [1, 8, 32];
+
+/**
+ * Downloads a JSON payload of `sizeInMB` megabytes and checks that
+ * XMLHttpRequest went through its states in order, i.e. that the response
+ * headers arrived before the body, and that the body is complete.
+ * `base64` requests the body as an ArrayBuffer, which React Native transfers
+ * as base64.
+ */
+export function downloadLargeJson(
+  sizeInMB: number,
+  responseType: 'text' | 'base64' = 'text',
+): Promise<string | void> {
+  return new Promise((resolve, reject) => {
+    const request = new XMLHttpRequest();
+    const readyStates: number[] = [];
+    request.onreadystatechange = () => {
+      readyStates.push(request.readyState);
+    };
+    request.onload = () => {
+      const headersReceivedIndex = readyStates.indexOf(
+        XMLHttpRequest.HEADERS_RECEIVED,
+      );
+      const loadingIndex = readyStates.indexOf(XMLHttpRequest.LOADING);
+      if (request.status !== 200) {
+        resolve(`status ${request.status}`);
+        return;
+      }
+      if (
+        headersReceivedIndex === -1 ||
+        (loadingIndex !== -1 && loadingIndex < headersReceivedIndex)
+      ) {
+        resolve(`ready states ${readyStates.join(',')}`);
+        return;
+      }
+      const byteLength =
+        responseType === 'base64'
+          ? (request.response as ArrayBuffer).byteLength
+          : request.responseText.length;
+      if (byteLength < sizeInMB * 1024 * 1024) {
+        resolve(`received ${byteLength} bytes`);
+        return;
+      }
+      if (responseType === 'text') {
+        JSON.parse(request.responseText);
+      }
+      resolve();
+    };
+    request.onerror = () => reject(new Error('request failed'));
+    request.open('GET', `${LARGE_JSON_URL}?sizeInMB=${sizeInMB}`);
+    if (responseType === 'base64') {
+      request.responseType = 'arraybuffer';
+    }
+    request.send();
+  });
+}
@@ -0,0 +1,74 @@
+import {useState} from 'react';
+import {Text, TouchableOpacity, View} from 'react-native';
+// @ts-ignore
+import {getStartupMetrics} from '../scripts/lib/create-startup-stats';
+
+const STARTUP_TIMELINE_LOG_PREFIX = 'RNOH_STARTUP_TIMELINE ';
+
+function getStartupTimeline(): any[] {
+  const nativeGetStartupTimeline = (global as any).nativeGetStartupTimeline;
+  if (typeof nativeGetStartupTimeline !== 'function') {
+    return [];
+  }
+  return JSON.parse(nativeGetStartupTimeline());
+}
+
+/**
+ * Logs the native startup timeline once the first frame was displayed, which
+ * scripts/benchmark-startup.js reads from hilog after each cold start.
+ */
+export function logStartupTimelineAfterFirstFrame(timeoutInMs = 10000) {
+  const startTime = Date.now();
+  const intervalId = setInterval(() => {
+    const timeline = getStartupTimeline();
+    const hasFirstFrame = timeline.some(phase => phase.name === 'FIRST_FRAME');
+    if (hasFirstFrame || Date.now() - startTime > timeoutInMs) {
+      clearInterval(intervalId);
+      console.log(STARTUP_TIMELINE_LOG_PREFIX + JSON.stringify(timeline));
+    }
+  }, 100);
+}
+
+function formatMetric(value: number | null, unit: string) {
+  return value === null ? '-' : `${value.toFixed(1)} ${unit}`;
+}
+
+/**
+ * Displays the time to first JS, the time to first frame and the peak RSS of
+ * the current launch. Cold starts are measured by
+ * scripts/benchmark-startup.js.
+ */
+export function StartupReport() {
+  const [metrics, setMetrics] = useState(() =>
+    getStartupMetrics(getStartupTimeline()),
+  );
+
+  return (
+    <View style={{height: '100%', padding: 16, backgroundColor: 'white'}}>
+      <TouchableOpacity
+        onPress={() => setMetrics(getStartupMetrics(getStartupTimeline()))}>
+        <Text
+          style={{width: 200, height: 32, fontWeight: 'bold', color: 'blue'}}>
+          Refresh
+        </Text>
+      </TouchableOpacity>
+      <Text style={{width: 256, height: 32}}>
+        Time to first JS {formatMetric(metrics.timeToFirstJSInMs, 'ms')}
+      </Text>
+      <Text style={{width: 256, height: 32}}>
+        Running JS bundle {formatMetric(metrics.runJSBundleDurationInMs, 'ms')}
+      </Text>
+      <Text style={{width: 256, height: 32}}>
+        Time to first frame {formatMetric(metrics.timeToFirstFrameInMs, 'ms')}
+      </Text>
+      <Text style={{width: 256, height: 32}}>
+        Peak RSS after JS bundle{' '}
+        {formatMetric(metrics.peakRSSAfterJSBundleInMB, 'MB')}
+      </Text>
+      <Text style={{width: 256, height: 32}}>
+        Peak RSS at first frame{' '}
+        {formatMetric(metrics.peakRSSAtFirstFrameInMB, 'MB')}
+      </Text>
+    </View>
+  );
+}
@@ -0,0 +1,52 @@
+import {SampleTurboModule} from 'react-native-sample-package';
+
+function createFlatObject(propertiesCount: number) {
+  const result: Record<string, number | string | boolean> = {};
+  for (let i = 0; i < propertiesCount; i++) {
+    result[`property${i}`] = i % 3 === 0 ? i : i % 3 === 1 ? `value${i}` : true;
+  }
+  return result;
+}
+
+function createNestedObject(depth: number, breadth: number): object {
+  if (depth === 0) {
+    return createFlatObject(breadth);
+  }
+  const result: Record<string, object> = {};
+  for (let i = 0; i < breadth; i++) {
+    result[`child${i}`] = createNestedObject(depth - 1, breadth);
+  }
+  return result;
+}
+
+/**
+ * Payloads resembling what's passed to ArkTS TurboModules: number arrays
+ * (transforms, colors), flat option objects, nested objects and long strings.
+ */
+const PAYLOAD_BY_SHAPE = {
+  numbers: Array.from({length: 1000}, (_, i) => i * 0.5),
+  flatObject: createFlatObject(50),
+  nestedObject: createNestedObject(3, 5),
+  strings: Array.from({length: 200}, (_, i) => `string number ${i}`),
+  longString: 'x'.repeat(100 * 1024),
+};
+
+export type TurboModulePayloadShape = keyof typeof PAYLOAD_BY_SHAPE;
+
+export const TURBO_MODULE_PAYLOAD_SHAPES = Object.keys(
+  PAYLOAD_BY_SHAPE,
+) as TurboModulePayloadShape[];
+
+/**
+ * Passes the payload to a synchronous ArkTS TurboModule method, which returns
+ * it back, and checks the payload survived the round trip.
+ */
+export async function callSyncTurboModule(
+  shape: TurboModulePayloadShape,
+): Promise<string | void> {
+  const payload = PAYLOAD_BY_SHAPE[shape];
+  const result = SampleTurboModule.getArray([payload]);
+  if (JSON.stringify(result[0]) !== JSON.stringify(payload)) {
+    return `${shape} payload changed in the round trip`;
+  }
+}
@@ -0,0 +1,8 @@
+// SampleTurboModule is only provided on Harmony
+export type TurboModulePayloadShape = never;
+
+export const TURBO_MODULE_PAYLOAD_SHAPES: TurboModulePayloadShape[] = [];
+
+export async function callSyncTurboModule(
+  _shape: TurboModulePayloadShape,
+): Promise<string | void> {}
@@ -0,0 +1,54 @@
+// the echo server used by the WebSocket tests
+const ECHO_SERVER_URL = 'wss://ws.postman-echo.com/raw';
+
+/**
+ * Sizes of the binary messages, large enough for base64 encoding and
+ * copying to dominate. Public echo servers may cap the message size, in
+ * which case the sample reports the received size.
+ */
+export const WEBSOCKET_MESSAGE_SIZES_IN_MB = [1, 10, 50];
+
+function createMessage(sizeInBytes: number) {
+  const message = new Uint8Array(sizeInBytes);
+  for (let i = 0; i < sizeInBytes; i++) {
+    message[i] = i % 256;
+  }
+  return message.buffer;
+}
+
+/**
+ * Sends `messagesCount` binary messages over a new WebSocket and waits until
+ * all of them are echoed back, checking their sizes.
+ */
+export function sendBinaryMessages(
+  messagesCount: number,
+  messageSizeInBytes: number,
+): Promise<string | void> {
+  return new Promise((resolve, reject) => {
+    const ws = new WebSocket(ECHO_SERVER_URL);
+    ws.binaryType = 'arraybuffer';
+    let receivedMessagesCount = 0;
+    let problem: string | undefined;
+    ws.onopen = () => {
+      const message = createMessage(messageSizeInBytes);
+      for (let i = 0; i < messagesCount; i++) {
+        ws.send(message);
+      }
+    };
+    ws.onmessage = event => {
+      if (!(event.data instanceof ArrayBuffer)) {
+        problem = `received ${typeof event.data} instead of an ArrayBuffer`;
+      } else if (event.data.byteLength !== messageSizeInBytes) {
+        problem = `received ${event.data.byteLength} bytes`;
+      }
+      receivedMessagesCount++;
+      if (receivedMessagesCount === messagesCount) {
+        ws.close();
+        resolve(problem);
+      }
+    };
+    ws.onerror = event => {
+      reject(new Error(event.message));
+    };
+  });
+}
@@ -1,3 +1,10 @@
 export * from './DeepTree';
 export * from './Benchmarker';
 export * from './SierpinskiTriangle';
+export * from './StartupReport';
+export * from './MixedComponentsList';
+export * from './AsyncBenchmarker';
+export * from './BlobBenchmark';
+export * from './NetworkingBenchmark';
+export * from './TurboModuleBenchmark';
+export * from './WebSocketBenchmark';
@@ -0,0 +1,50 @@
+import type { RNInstance, RNInstanceOptions, RNOHCoreContext } from '@rnoh/react-native-openharmony';
+import { createRNPackages } from '../RNPackagesFactory';
+
+/**
+ * Launch URI which runs the benchmark instead of opening the tester app:
+ * `hdc shell aa start -a EntryAbility -b com.rnoh.tester -U rnohtester://rn-instance-pool-benchmark`
+ * Results are logged with the "RNInstancePoolBenchmark" tag.
+ */
+export const RN_INSTANCE_POOL_BENCHMARK_URI = 'rnohtester://rn-instance-pool-benchmark'
+
+const POOL_NAME = 'RNInstancePoolBenchmark'
+
+function getMedian(values: number[]): number {
+  const sortedValues = [...values].sort((a, b) => a - b)
+  return sortedValues[Math.floor(sortedValues.length / 2)]
+}
+
+async function measureInstanceCreation(
+  ctx: RNOHCoreContext,
+  options: RNInstanceOptions,
+): Promise<number> {
+  const startTime = Date.now()
+  const rnInstance: RNInstance = await ctx.createAndRegisterRNInstance(options)
+  const durationInMs = Date.now() - startTime
+  ctx.destroyAndUnregisterRNInstance(rnInstance)
+  return durationInMs
+}
+
+/**
+ * Compares how long `createAndRegisterRNInstance` takes for a cold instance and for an instance taken from a
+ * prewarmed pool. The pool is refilled outside of the measured time.
+ */
+export async function runRNInstancePoolBenchmark(ctx: RNOHCoreContext, samplesCount: number = 10) {
+  const logger = ctx.logger.clone("RNInstancePoolBenchmark")
+  const coldOptions: RNInstanceOptions = { createRNPackages, enableNDKTextMeasuring: true }
+  const pooledOptions: RNInstanceOptions = { ...coldOptions, poolName: POOL_NAME }
+  const coldDurationsInMs: number[] = []
+  const pooledDurationsInMs: number[] = []
+  for (let i = 0; i < samplesCount; i++) {
+    coldDurationsInMs.push(await measureInstanceCreation(ctx, coldOptions))
+    await ctx.prewarmRNInstances(pooledOptions, 1)
+    pooledDurationsInMs.push(await measureInstanceCreation(ctx, pooledOptions))
+  }
+  // releases the instance created by the last refill
+  await ctx.prewarmRNInstances(pooledOptions, 0)
+  logger.info(
+    `cold: median ${getMedian(coldDurationsInMs)} ms ${JSON.stringify(coldDurationsInMs)}, ` +
+      `pooled: median ${getMedian(pooledDurationsInMs)} ms ${JSON.stringify(pooledDurationsInMs)}`
+  )
+}
@@ -44,7 +44,8 @@ std::shared_ptr<RNInstanceInternal> createRNInstance(
     FeatureFlagRegistry::Shared featureFlagRegistry,
     UITicker::Shared uiTicker,
     bool shouldEnableDebugger,
-    bool shouldEnableBackgroundExecutor) {
+    bool shouldEnableBackgroundExecutor,
+    std::vector<std::string> turboModulesToPrewarm = {}) {
   auto shouldUseCAPIArchitecture =
       featureFlagRegistry->getFeatureFlagStatus("C_API_ARCH");
   std::shared_ptr<TaskExecutor> taskExecutor =
@@ -135,8 +136,11 @@ std::shared_ptr<RNInstanceInternal> createRNInstance(
       std::move(componentJSIBinderByName),
       taskExecutor,
       std::move(turboModuleFactoryDelegates));
+  turboModuleFactory.prewarmArkTSTurboModules(std::move(turboModulesToPrewarm));
   auto mutationsToNapiConverter = std::make_shared<MutationsToNapiConverter>(
       std::move(componentNapiBinderByName));
+  auto surfaceTelemetryAggregator =
+      std::make_shared<SurfaceTelemetryAggregator>();
   auto mountingManager = std::make_shared<MountingManager>(
       taskExecutor,
       shadowViewRegistry,
@@ -158,7 +162,8 @@ std::shared_ptr<RNInstanceInternal> createRNInstance(
                 commandDispatcher(tag, commandName, args);
               });
         }
-      });
+      },
+      surfaceTelemetryAggregator);
   auto schedulerDelegateArkTS =
       std::make_unique<SchedulerDelegateArkTS>(mountingManager, arkTSChannel);
   auto arkTSMessageHub = std::make_shared<ArkTSMessageHub>();
@@ -169,6 +174,10 @@ std::shared_ptr<RNInstanceInternal> createRNInstance(
         std::make_shared<ComponentInstance::Dependencies>();
     componentInstanceDependencies->arkTSChannel = arkTSChannel;
     componentInstanceDependencies->arkTSMessageHub = std::move(arkTSMessageHub);
+    auto continuousEventCoalescer =
+        std::make_shared<ContinuousEventCoalescer>();
+    componentInstanceDependencies->continuousEventCoalescer =
+        continuousEventCoalescer;
     auto customComponentArkUINodeFactory =
         std::make_shared<CustomComponentArkUINodeHandleFactory>(
             env, frameNodeFactoryRef, taskExecutor);
@@ -195,11 +204,13 @@ std::shared_ptr<RNInstanceInternal> createRNInstance(
         globalJSIBinders,
         uiTicker,
         shadowViewRegistry,
+        mountingManager,
         std::move(schedulerDelegateCAPI),
         std::move(arkTSMessageHandlers),
         std::move(arkTSChannel),
         componentInstanceRegistry,
         componentInstanceFactory,
+        continuousEventCoalescer,
         shouldEnableDebugger,
         shouldEnableBackgroundExecutor);
     componentInstanceDependencies->rnInstance = rnInstance;
@@ -222,6 +233,7 @@ std::shared_ptr<RNInstanceInternal> createRNInstance(
       globalJSIBinders,
       uiTicker,
       shadowViewRegistry,
+      mountingManager,
       arkTSChannel,
       std::move(schedulerDelegateArkTS),
       std::move(arkTSMessageHandlers),
@@ -1,6 +1,8 @@
 #include "ArkJS.h"
+#include <cstring>
 #include <stdexcept>
 #include <string>
+#include "RNOH/MapBufferValidation.h"
 #include "napi/native_api.h"
 
 static void
@@ -106,7 +108,7 @@ RNOHNapiObjectBuilder ArkJS::createObjectBuilder() {
 }
 
 std::vector<napi_value> ArkJS::createFromDynamics(
-    std::vector<folly::dynamic> dynamics) {
+    std::vector<folly::dynamic> const& dynamics) {
   std::vector<napi_value> results(dynamics.size());
   for (size_t i = 0; i < dynamics.size(); ++i) {
     results[i] = this->createFromDynamic(dynamics[i]);
@@ -114,7 +116,7 @@ std::vector<napi_value> ArkJS::createFromDynamics(
   return results;
 }
 
-napi_value ArkJS::createFromDynamic(folly::dynamic dyn) {
+napi_value ArkJS::createFromDynamic(folly::dynamic const& dyn) {
   if (dyn.isBool()) {
     return this->createBoolean(dyn.asBool());
   } else if (dyn.isInt()) {
@@ -124,18 +126,39 @@ napi_value ArkJS::createFromDynamic(folly::dynamic dyn) {
   } else if (dyn.isString()) {
     return this->createString(dyn.asString());
   } else if (dyn.isArray()) {
-    std::vector<napi_value> n_values(dyn.size());
+    napi_value result;
+    auto status = napi_create_array_with_length(m_env, dyn.size(), &result);
+    this->maybeThrowFromStatus(status, "Failed to create array");
     for (size_t i = 0; i < dyn.size(); ++i) {
-      n_values[i] = this->createFromDynamic(dyn[i]);
+      status =
+          napi_set_element(m_env, result, i, this->createFromDynamic(dyn[i]));
+      this->maybeThrowFromStatus(status, "Failed to set array element");
     }
-    return this->createArray(n_values);
+    return result;
   } else if (dyn.isObject()) {
-    auto objectBuilder = this->createObjectBuilder();
+    // keys are kept alive by `dyn` until the properties are defined
+    std::vector<napi_property_descriptor> descriptors;
+    descriptors.reserve(dyn.size());
     for (const auto& pair : dyn.items()) {
-      objectBuilder.addProperty(
-          pair.first.asString().c_str(), this->createFromDynamic(pair.second));
+      descriptors.push_back(napi_property_descriptor{
+          pair.first.getString().c_str(),
+          nullptr,
+          nullptr,
+          nullptr,
+          nullptr,
+          this->createFromDynamic(pair.second),
+          napi_default_jsproperty,
+          nullptr});
     }
-    return objectBuilder.build();
+    napi_value result;
+    auto status = napi_create_object(m_env, &result);
+    this->maybeThrowFromStatus(status, "Failed to create an object");
+    if (!descriptors.empty()) {
+      status = napi_define_properties(
+          m_env, result, descriptors.size(), descriptors.data());
+      this->maybeThrowFromStatus(status, "Failed to define properties");
+    }
+    return result;
   } else {
     return this->getUndefined();
   }
@@ -342,6 +365,65 @@ std::vector<uint8_t> ArkJS::getArrayBuffer(napi_value array) {
       static_cast<uint8_t*>(data), static_cast<uint8_t*>(data) + length);
 }
 
+folly::ByteRange ArkJS::getArrayBufferRange(napi_value array) {
+  void* data;
+  size_t length;
+  auto status = napi_get_arraybuffer_info(m_env, array, &data, &length);
+  this->maybeThrowFromStatus(status, "Failed to read array buffer");
+  return folly::ByteRange(static_cast<uint8_t const*>(data), length);
+}
+
+napi_value ArkJS::createArrayBuffer(
+    std::shared_ptr<facebook::jsi::MutableBuffer> buffer) {
+  auto data = buffer->data();
+  auto size = buffer->size();
+  auto owner = new std::shared_ptr<facebook::jsi::MutableBuffer>(
+      std::move(buffer));
+  napi_value result;
+  auto status = napi_create_external_arraybuffer(
+      m_env,
+      data,
+      size,
+      [](napi_env, void*, void* hint) {
+        delete static_cast<std::shared_ptr<facebook::jsi::MutableBuffer>*>(
+            hint);
+      },
+      owner,
+      &result);
+  if (status != napi_ok) {
+    delete owner;
+  }
+  this->maybeThrowFromStatus(status, "Failed to create array buffer");
+  return result;
+}
+
+bool ArkJS::isArrayBuffer(napi_value value) {
+  bool result = false;
+  napi_is_arraybuffer(m_env, value, &result);
+  return result;
+}
+
+facebook::react::MapBuffer ArkJS::getMapBuffer(napi_value value) {
+  auto bytes = getArrayBufferRange(value);
+  if (!rnoh::isWellFormedMapBuffer(bytes.data(), bytes.size())) {
+    throw rnoh::RNOHError(
+        "ArrayBuffer doesn't contain a valid MapBuffer",
+        {"Make sure the ArrayBuffer was built by MapBufferBuilder"});
+  }
+  return facebook::react::MapBuffer(
+      std::vector<uint8_t>(bytes.begin(), bytes.end()));
+}
+
+napi_value ArkJS::createMapBuffer(facebook::react::MapBuffer const& mapBuffer) {
+  void* data;
+  napi_value result;
+  auto status =
+      napi_create_arraybuffer(m_env, mapBuffer.size(), &data, &result);
+  this->maybeThrowFromStatus(status, "Failed to create array buffer");
+  std::memcpy(data, mapBuffer.data(), mapBuffer.size());
+  return result;
+}
+
 std::vector<std::pair<napi_value, napi_value>> ArkJS::getObjectProperties(
     napi_value object) {
   napi_value propertyNames;
@@ -427,8 +509,9 @@ std::vector<folly::dynamic> ArkJS::getDynamics(std::vector<napi_value> values) {
 std::vector<napi_value> ArkJS::convertIntermediaryValuesToNapiValues(
     std::vector<IntermediaryArg> args) {
   std::vector<napi_value> napiArgs;
-  for (auto arg : args) {
-    napiArgs.push_back(convertIntermediaryValueToNapiValue(arg));
+  napiArgs.reserve(args.size());
+  for (auto& arg : args) {
+    napiArgs.push_back(convertIntermediaryValueToNapiValue(std::move(arg)));
   }
   return napiArgs;
 }
@@ -1,13 +1,16 @@
 #ifndef native_ArkJS_H
 #define native_ArkJS_H
 
+#include <folly/Range.h>
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 #include <react/renderer/graphics/Color.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/RectangleCorners.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
 #include <array>
 #include <functional>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
@@ -67,9 +70,10 @@ class ArkJS {
 
   napi_value createArray(std::vector<napi_value>);
 
-  std::vector<napi_value> createFromDynamics(std::vector<folly::dynamic>);
+  std::vector<napi_value> createFromDynamics(
+      std::vector<folly::dynamic> const& dynamics);
 
-  napi_value createFromDynamic(folly::dynamic);
+  napi_value createFromDynamic(folly::dynamic const& dyn);
 
   napi_value createFromException(std::exception const&);
 
@@ -115,6 +119,30 @@ class ArkJS {
 
   std::vector<uint8_t> getArrayBuffer(napi_value array);
 
+  /**
+   * Returns a view of the ArrayBuffer's backing store. The view is valid only
+   * as long as the ArrayBuffer is alive.
+   */
+  folly::ByteRange getArrayBufferRange(napi_value array);
+
+  /**
+   * Creates an ArrayBuffer backed by `buffer` without copying it. The buffer
+   * is kept alive until the ArrayBuffer is garbage collected.
+   */
+  napi_value createArrayBuffer(
+      std::shared_ptr<facebook::jsi::MutableBuffer> buffer);
+
+  bool isArrayBuffer(napi_value value);
+
+  /**
+   * Copies a MapBuffer encoded by the ArkTS MapBufferBuilder. Throws
+   * RNOHError if the ArrayBuffer, or any map nested in it, isn't a
+   * well-formed MapBuffer.
+   */
+  facebook::react::MapBuffer getMapBuffer(napi_value value);
+
+  napi_value createMapBuffer(facebook::react::MapBuffer const& mapBuffer);
+
   std::vector<std::pair<napi_value, napi_value>> getObjectProperties(
       napi_value object);
 
@@ -0,0 +1,64 @@
+#include "RNOH/ArkTSCallBatcher.h"
+#include <glog/logging.h>
+
+using namespace rnoh;
+
+ArkTSCallBatcher::ArkTSCallBatcher(TaskExecutor::Weak taskExecutor)
+    : m_taskExecutor(std::move(taskExecutor)) {}
+
+void ArkTSCallBatcher::enqueue(Call&& call) {
+  auto taskExecutor = m_taskExecutor.lock();
+  if (taskExecutor == nullptr) {
+    return;
+  }
+  bool shouldScheduleFlush = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingCalls.push_back(std::move(call));
+    if (!m_isFlushScheduled) {
+      m_isFlushScheduled = true;
+      shouldScheduleFlush = true;
+    }
+  }
+  if (!shouldScheduleFlush) {
+    return;
+  }
+  if (!taskExecutor->isOnTaskThread(TaskThread::JS)) {
+    flush();
+    return;
+  }
+  // tasks on the JS thread are executed in order, so the flush runs
+  // after the JS task that enqueued the first call has finished
+  taskExecutor->runTask(
+      TaskThread::JS, [weakSelf = weak_from_this()]() {
+        if (auto self = weakSelf.lock()) {
+          self->flush();
+        }
+      });
+}
+
+void ArkTSCallBatcher::flush() {
+  std::vector<Call> calls;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(calls, m_pendingCalls);
+    m_isFlushScheduled = false;
+  }
+  if (calls.empty()) {
+    return;
+  }
+  auto taskExecutor = m_taskExecutor.lock();
+  if (taskExecutor == nullptr) {
+    return;
+  }
+  taskExecutor->runTask(TaskThread::MAIN, [calls = std::move(calls)]() {
+    for (auto const& call : calls) {
+      try {
+        call();
+      } catch (const std::exception& e) {
+        LOG(ERROR) << "Exception thrown while executing batched ArkTS call: "
+                   << e.what();
+      }
+    }
+  });
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "RNOH/TaskExecutor/TaskExecutor.h"
+
+namespace rnoh {
+
+/**
+ * Collects ArkTS calls issued from the JS thread and dispatches them to the
+ * MAIN thread. All calls enqueued during a single JS task are executed in one
+ * MAIN thread task, in the order they were enqueued.
+ */
+class ArkTSCallBatcher
+    : public std::enable_shared_from_this<ArkTSCallBatcher> {
+ public:
+  using Shared = std::shared_ptr<ArkTSCallBatcher>;
+  using Call = std::function<void()>;
+
+  ArkTSCallBatcher(TaskExecutor::Weak taskExecutor);
+
+  void enqueue(Call&& call);
+
+  /**
+   * Dispatches pending calls immediately. Must be called before running a
+   * synchronous task on the MAIN thread, so that previously enqueued calls
+   * are executed first.
+   */
+  void flush();
+
+ private:
+  TaskExecutor::Weak m_taskExecutor;
+  std::mutex m_mutex;
+  std::vector<Call> m_pendingCalls;
+  bool m_isFlushScheduled = false;
+};
+
+} // namespace rnoh
@@ -37,9 +37,55 @@ jsi::Value ArkTSTurboModule::call(
     const std::string& methodName,
     const jsi::Value* jsiArgs,
     size_t argsCount) {
-  auto args = convertJSIValuesToIntermediaryValues(
-      runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
-  return jsi::valueFromDynamic(runtime, callSync(methodName, args));
+  if (!m_ctx.arkTsTurboModuleInstanceRef) {
+    auto errorMsg = "Couldn't find turbo module '" + name_ +
+        "' on ArkUI side. Did you link RNPackage that provides this turbo module?";
+    LOG(FATAL) << errorMsg;
+    throw std::runtime_error(errorMsg);
+  }
+  // jsi values may only be accessed on the JS thread and napi values on the
+  // MAIN thread, so arguments are converted to TransferableValues here, and
+  // to napi values on the MAIN thread, while the JS thread is blocked waiting
+  // for the call to finish. The result takes the opposite way.
+  std::vector<std::variant<TransferableValue, IntermediaryCallback>> args;
+  args.reserve(argsCount);
+  for (size_t argIdx = 0; argIdx < argsCount; argIdx++) {
+    if (jsiArgs[argIdx].isObject()) {
+      auto obj = jsiArgs[argIdx].getObject(runtime);
+      if (obj.isFunction(runtime)) {
+        args.emplace_back(
+            createIntermediaryCallback(react::CallbackWrapper::createWeak(
+                obj.getFunction(runtime), runtime, m_ctx.jsInvoker)));
+        continue;
+      }
+    }
+    args.emplace_back(jsiToTransferable(runtime, jsiArgs[argIdx]));
+  }
+  // calls scheduled earlier must be executed before this one
+  if (m_ctx.callBatcher) {
+    m_ctx.callBatcher->flush();
+  }
+  TransferableValue result;
+  m_ctx.taskExecutor->runSyncTask(
+      TaskThread::MAIN, [ctx = m_ctx, &methodName, &args, &result]() {
+        ArkJS arkJs(ctx.env);
+        std::vector<napi_value> napiArgs;
+        napiArgs.reserve(args.size());
+        for (auto& arg : args) {
+          if (auto callback = std::get_if<IntermediaryCallback>(&arg)) {
+            napiArgs.push_back(
+                arkJs.createSingleUseCallback(std::move(*callback)));
+          } else {
+            napiArgs.push_back(transferableToNapi(
+                ctx.env, std::get<TransferableValue>(arg)));
+          }
+        }
+        auto napiTurboModuleObject =
+            arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
+        auto napiResult = napiTurboModuleObject.call(methodName, napiArgs);
+        result = napiToTransferable(ctx.env, napiResult);
+      });
+  return transferableToJsi(runtime, result);
 }
 
 // the cpp side calls a ArkTs TurboModule method and blocks until it returns,
@@ -53,11 +99,16 @@ folly::dynamic ArkTSTurboModule::callSync(
     LOG(FATAL) << errorMsg;
     throw std::runtime_error(errorMsg);
   }
+  // calls scheduled earlier must be executed before this one
+  if (m_ctx.callBatcher) {
+    m_ctx.callBatcher->flush();
+  }
   folly::dynamic result;
   m_ctx.taskExecutor->runSyncTask(
       TaskThread::MAIN, [ctx = m_ctx, &methodName, &args, &result]() {
         ArkJS arkJs(ctx.env);
-        auto napiArgs = arkJs.convertIntermediaryValuesToNapiValues(args);
+        auto napiArgs =
+            arkJs.convertIntermediaryValuesToNapiValues(std::move(args));
         auto napiTurboModuleObject =
             arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
         auto napiResult = napiTurboModuleObject.call(methodName, napiArgs);
@@ -80,13 +131,8 @@ void rnoh::ArkTSTurboModule::scheduleCall(
   }
   auto args = convertJSIValuesToIntermediaryValues(
       runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
-  m_ctx.taskExecutor->runTask(
-      TaskThread::MAIN,
-      [ctx = m_ctx,
-       name = name_,
-       methodName,
-       args = std::move(args),
-       &runtime]() {
+  runOnMainThread(
+      [ctx = m_ctx, name = name_, methodName, args = std::move(args)]() {
         try {
           ArkJS arkJs(ctx.env);
           auto napiArgs = arkJs.convertIntermediaryValuesToNapiValues(args);
@@ -101,7 +147,8 @@ void rnoh::ArkTSTurboModule::scheduleCall(
       });
 }
 
-// calls an async TurboModule method and returns a Promise
+// calls an async TurboModule method and returns a Promise without waiting for
+// the MAIN thread
 jsi::Value ArkTSTurboModule::callAsync(
     jsi::Runtime& runtime,
     const std::string& methodName,
@@ -115,64 +162,57 @@ jsi::Value ArkTSTurboModule::callAsync(
   }
   auto args = convertJSIValuesToIntermediaryValues(
       runtime, m_ctx.jsInvoker, jsiArgs, argsCount);
-  napi_ref napiResultRef;
-  try {
-    m_ctx.taskExecutor->runSyncTask(
-        TaskThread::MAIN,
-        [ctx = m_ctx,
-         name = name_,
-         &methodName,
-         &args,
-         &runtime,
-         &napiResultRef]() {
-          ArkJS arkJs(ctx.env);
-          auto napiArgs = arkJs.convertIntermediaryValuesToNapiValues(args);
-          auto napiTurboModuleObject =
-              arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
-
-          auto napiResult = napiTurboModuleObject.call(methodName, napiArgs);
-          napiResultRef = arkJs.createReference(napiResult);
-        });
-  } catch (const std::exception& e) {
-    return react::createPromiseAsJSIValue(
-        runtime, [ctx = m_ctx, message = e.what()](auto& rt, auto jsiPromise) {
-          ctx.jsInvoker->invokeAsync([message, jsiPromise] {
-            jsiPromise->reject(message);
-            jsiPromise->allowRelease();
-          });
-        });
-  }
   return react::createPromiseAsJSIValue(
       runtime,
-      [ctx = m_ctx, napiResultRef](
+      [ctx = m_ctx, methodName, args = std::move(args)](
           jsi::Runtime& rt2, std::shared_ptr<react::Promise> jsiPromise) {
-        ctx.taskExecutor->runTask(
-            TaskThread::MAIN, [ctx, napiResultRef, &rt2, jsiPromise]() {
-              ArkJS arkJs(ctx.env);
-              auto napiResult = arkJs.getReferenceValue(napiResultRef);
-              Promise(ctx.env, napiResult)
-                  .then([&rt2, jsiPromise, ctx, napiResultRef](auto args) {
-                    ctx.jsInvoker->invokeAsync(
-                        [&rt2, jsiPromise, args = std::move(args)]() {
-                          jsiPromise->resolve(
-                              preparePromiseResolverResult(rt2, args));
-                          jsiPromise->allowRelease();
-                        });
-                    ArkJS arkJs(ctx.env);
-                    arkJs.deleteReference(napiResultRef);
-                  })
-                  .catch_([&rt2, jsiPromise, ctx, napiResultRef](auto args) {
-                    ctx.jsInvoker->invokeAsync([&rt2, jsiPromise, args]() {
-                      jsiPromise->reject(preparePromiseRejectionResult(args));
-                      jsiPromise->allowRelease();
-                    });
-                    ArkJS arkJs(ctx.env);
-                    arkJs.deleteReference(napiResultRef);
+        runOnMainThread(ctx, [ctx, methodName, args, &rt2, jsiPromise]() {
+          try {
+            ArkJS arkJs(ctx.env);
+            auto napiArgs = arkJs.convertIntermediaryValuesToNapiValues(args);
+            auto napiTurboModuleObject =
+                arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
+            auto napiResult = napiTurboModuleObject.call(methodName, napiArgs);
+            Promise(ctx.env, napiResult)
+                .then([&rt2, jsiPromise, ctx](auto args) {
+                  ctx.jsInvoker->invokeAsync(
+                      [&rt2, jsiPromise, args = std::move(args)]() {
+                        jsiPromise->resolve(
+                            preparePromiseResolverResult(rt2, args));
+                        jsiPromise->allowRelease();
+                      });
+                })
+                .catch_([&rt2, jsiPromise, ctx](auto args) {
+                  ctx.jsInvoker->invokeAsync([&rt2, jsiPromise, args]() {
+                    jsiPromise->reject(preparePromiseRejectionResult(args));
+                    jsiPromise->allowRelease();
                   });
-            });
+                });
+          } catch (const std::exception& e) {
+            ctx.jsInvoker->invokeAsync(
+                [message = std::string(e.what()), jsiPromise] {
+                  jsiPromise->reject(message);
+                  jsiPromise->allowRelease();
+                });
+          }
+        });
       });
 }
 
+void ArkTSTurboModule::runOnMainThread(std::function<void()>&& task) {
+  runOnMainThread(m_ctx, std::move(task));
+}
+
+void ArkTSTurboModule::runOnMainThread(
+    Context const& ctx,
+    std::function<void()>&& task) {
+  if (ctx.callBatcher) {
+    ctx.callBatcher->enqueue(std::move(task));
+    return;
+  }
+  ctx.taskExecutor->runTask(TaskThread::MAIN, std::move(task));
+}
+
 std::vector<IntermediaryArg>
 ArkTSTurboModule::convertJSIValuesToIntermediaryValues(
     jsi::Runtime& runtime,
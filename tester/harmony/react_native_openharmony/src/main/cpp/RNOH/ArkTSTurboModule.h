@@ -8,6 +8,7 @@
 #include "napi/native_api.h"
 
 #include "ArkJS.h"
+#include "RNOH/ArkTSCallBatcher.h"
 #include "RNOH/EventDispatcher.h"
 #include "RNOH/MessageQueueThread.h"
 #include "RNOH/TaskExecutor/TaskExecutor.h"
@@ -67,6 +68,7 @@ class ArkTSTurboModule : public TurboModule {
     std::shared_ptr<EventDispatcher> eventDispatcher;
     std::shared_ptr<MessageQueueThread> jsQueue;
     std::shared_ptr<facebook::react::Scheduler> scheduler;
+    ArkTSCallBatcher::Shared callBatcher;
   };
 
   ArkTSTurboModule(Context ctx, std::string name);
@@ -101,6 +103,16 @@ class ArkTSTurboModule : public TurboModule {
       size_t argsCount);
 
  protected:
+  /**
+   * Runs the task on the MAIN thread. Tasks scheduled during the same JS task
+   * are batched into a single MAIN thread task.
+   */
+  void runOnMainThread(std::function<void()>&& task);
+
+  static void runOnMainThread(
+      Context const& ctx,
+      std::function<void()>&& task);
+
   Context m_ctx;
 };
 } // namespace rnoh
@@ -0,0 +1,121 @@
+#include "RNOH/ArkTSTurboModuleInstanceRegistry.h"
+#include <cxxreact/ReactMarker.h>
+#include <glog/logging.h>
+#include "RNOH/ArkJS.h"
+
+using namespace rnoh;
+using namespace facebook;
+
+ArkTSTurboModuleInstanceRegistry::ArkTSTurboModuleInstanceRegistry(
+    napi_env env,
+    napi_ref arkTsTurboModuleProviderRef,
+    TaskExecutor::Shared taskExecutor)
+    : m_env(env),
+      m_arkTsTurboModuleProviderRef(arkTsTurboModuleProviderRef),
+      m_taskExecutor(taskExecutor) {}
+
+ArkTSTurboModuleInstanceRegistry::~ArkTSTurboModuleInstanceRegistry() {
+  std::vector<napi_ref> instanceRefs;
+  for (auto const& [name, instanceRef] : m_instanceRefByName) {
+    if (instanceRef != nullptr) {
+      instanceRefs.push_back(instanceRef);
+    }
+  }
+  if (instanceRefs.empty()) {
+    return;
+  }
+  auto deleteInstanceRefs = [env = m_env, instanceRefs]() {
+    ArkJS arkJs(env);
+    for (auto instanceRef : instanceRefs) {
+      arkJs.deleteReference(instanceRef);
+    }
+  };
+  auto taskExecutor = m_taskExecutor.lock();
+  if (taskExecutor == nullptr) {
+    LOG(WARNING) << "Leaking " << instanceRefs.size()
+                 << " Turbo Module references, the MAIN thread is gone";
+    return;
+  }
+  if (taskExecutor->isOnTaskThread(TaskThread::MAIN)) {
+    deleteInstanceRefs();
+  } else {
+    taskExecutor->runTask(TaskThread::MAIN, std::move(deleteInstanceRefs));
+  }
+}
+
+napi_ref ArkTSTurboModuleInstanceRegistry::getInstanceRef(
+    std::string const& name) {
+  auto instanceRef = findInstanceRef(name);
+  if (instanceRef.has_value()) {
+    return instanceRef.value();
+  }
+  auto taskExecutor = m_taskExecutor.lock();
+  if (taskExecutor == nullptr) {
+    return nullptr;
+  }
+  napi_ref result = nullptr;
+  taskExecutor->runSyncTask(TaskThread::MAIN, [this, &name, &result]() {
+    result = createInstanceRef(name);
+  });
+  return result;
+}
+
+void ArkTSTurboModuleInstanceRegistry::prewarm(std::vector<std::string> names) {
+  auto taskExecutor = m_taskExecutor.lock();
+  if (taskExecutor == nullptr || names.empty()) {
+    return;
+  }
+  taskExecutor->runTask(
+      TaskThread::MAIN,
+      [weakSelf = weak_from_this(), names = std::move(names)]() {
+        auto self = weakSelf.lock();
+        if (self == nullptr) {
+          return;
+        }
+        for (auto const& name : names) {
+          try {
+            self->createInstanceRef(name);
+          } catch (std::exception const& e) {
+            LOG(ERROR) << "Couldn't prewarm Turbo Module '" << name
+                       << "': " << e.what();
+          }
+        }
+      });
+}
+
+std::optional<napi_ref> ArkTSTurboModuleInstanceRegistry::findInstanceRef(
+    std::string const& name) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_instanceRefByName.find(name);
+  if (it == m_instanceRefByName.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+napi_ref ArkTSTurboModuleInstanceRegistry::createInstanceRef(
+    std::string const& name) {
+  // the module may have been created by a prewarm task in the meantime
+  auto instanceRef = findInstanceRef(name);
+  if (instanceRef.has_value()) {
+    return instanceRef.value();
+  }
+  ArkJS arkJs(m_env);
+  napi_ref result = nullptr;
+  auto arkTsTurboModuleProvider =
+      arkJs.getObject(m_arkTsTurboModuleProviderRef);
+  auto hasModule = arkJs.getBoolean(
+      arkTsTurboModuleProvider.call("hasModule", {arkJs.createString(name)}));
+  if (hasModule) {
+    react::ReactMarker::logTaggedMarker(
+        react::ReactMarker::NATIVE_MODULE_SETUP_START, name.c_str());
+    auto n_turboModuleInstance =
+        arkTsTurboModuleProvider.call("getModule", {arkJs.createString(name)});
+    react::ReactMarker::logTaggedMarker(
+        react::ReactMarker::NATIVE_MODULE_SETUP_STOP, name.c_str());
+    result = arkJs.createReference(n_turboModuleInstance);
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_instanceRefByName.emplace(name, result);
+  return result;
+}
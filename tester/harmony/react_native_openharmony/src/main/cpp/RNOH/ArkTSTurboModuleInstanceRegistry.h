@@ -0,0 +1,63 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RNOH/TaskExecutor/TaskExecutor.h"
+#include "napi/native_api.h"
+
+namespace rnoh {
+
+/**
+ * Keeps references to ArkTS TurboModule instances, so that every module is
+ * looked up on the ArkTS side at most once. Modules which aren't provided by
+ * any ArkTS package are remembered as well, so repeated lookups of missing
+ * modules don't block the JS thread on the MAIN thread.
+ */
+class ArkTSTurboModuleInstanceRegistry
+    : public std::enable_shared_from_this<ArkTSTurboModuleInstanceRegistry> {
+ public:
+  using Shared = std::shared_ptr<ArkTSTurboModuleInstanceRegistry>;
+
+  ArkTSTurboModuleInstanceRegistry(
+      napi_env env,
+      napi_ref arkTsTurboModuleProviderRef,
+      TaskExecutor::Shared taskExecutor);
+
+  /**
+   * Deletes the references to module instances on the MAIN thread, right
+   * away if called there.
+   */
+  ~ArkTSTurboModuleInstanceRegistry();
+
+  /**
+   * Returns a reference to the ArkTS module instance, or nullptr if no
+   * package provides the module. The instance is created on the MAIN thread
+   * on first use.
+   */
+  napi_ref getInstanceRef(std::string const& name);
+
+  /**
+   * Creates the ArkTS instances of the given modules on the MAIN thread
+   * without waiting for it, e.g. while the JS bundle is being loaded.
+   */
+  void prewarm(std::vector<std::string> names);
+
+ private:
+  std::optional<napi_ref> findInstanceRef(std::string const& name);
+  /**
+   * MAIN thread only.
+   */
+  napi_ref createInstanceRef(std::string const& name);
+
+  napi_env m_env;
+  napi_ref m_arkTsTurboModuleProviderRef;
+  TaskExecutor::Weak m_taskExecutor;
+  std::mutex m_mutex;
+  std::unordered_map<std::string, napi_ref> m_instanceRefByName;
+};
+
+} // namespace rnoh
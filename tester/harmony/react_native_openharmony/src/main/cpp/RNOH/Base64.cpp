@@ -0,0 +1,87 @@
+#include "RNOH/Base64.h"
+#include <array>
+
+namespace rnoh {
+
+static constexpr char BASE64_ALPHABET[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static constexpr uint8_t INVALID_SEXTET = 0xFF;
+
+static constexpr std::array<uint8_t, 256> createDecodingTable() {
+  std::array<uint8_t, 256> table{};
+  for (auto& sextet : table) {
+    sextet = INVALID_SEXTET;
+  }
+  for (uint8_t i = 0; i < 64; i++) {
+    table[static_cast<uint8_t>(BASE64_ALPHABET[i])] = i;
+  }
+  return table;
+}
+
+static constexpr auto BASE64_DECODING_TABLE = createDecodingTable();
+
+void encodeBase64(folly::ByteRange bytes, std::string& output) {
+  auto size = bytes.size();
+  auto data = bytes.data();
+  auto offset = output.size();
+  output.resize(offset + ((size + 2) / 3) * 4);
+  auto out = output.data() + offset;
+  size_t i = 0;
+  for (; i + 2 < size; i += 3) {
+    uint32_t chunk = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+    *out++ = BASE64_ALPHABET[(chunk >> 18) & 0x3F];
+    *out++ = BASE64_ALPHABET[(chunk >> 12) & 0x3F];
+    *out++ = BASE64_ALPHABET[(chunk >> 6) & 0x3F];
+    *out++ = BASE64_ALPHABET[chunk & 0x3F];
+  }
+  if (i < size) {
+    uint32_t chunk = data[i] << 16;
+    if (i + 1 < size) {
+      chunk |= data[i + 1] << 8;
+    }
+    *out++ = BASE64_ALPHABET[(chunk >> 18) & 0x3F];
+    *out++ = BASE64_ALPHABET[(chunk >> 12) & 0x3F];
+    *out++ = i + 1 < size ? BASE64_ALPHABET[(chunk >> 6) & 0x3F] : '=';
+    *out++ = '=';
+  }
+}
+
+std::string encodeBase64(folly::ByteRange bytes) {
+  std::string result;
+  encodeBase64(bytes, result);
+  return result;
+}
+
+std::vector<uint8_t> decodeBase64(folly::StringPiece base64) {
+  std::vector<uint8_t> result;
+  result.reserve((base64.size() / 4) * 3);
+  uint32_t chunk = 0;
+  size_t sextetsCount = 0;
+  for (char c : base64) {
+    if (c == '=') {
+      break;
+    }
+    auto sextet = BASE64_DECODING_TABLE[static_cast<uint8_t>(c)];
+    if (sextet == INVALID_SEXTET) {
+      continue;
+    }
+    chunk = (chunk << 6) | sextet;
+    if (++sextetsCount == 4) {
+      result.push_back((chunk >> 16) & 0xFF);
+      result.push_back((chunk >> 8) & 0xFF);
+      result.push_back(chunk & 0xFF);
+      chunk = 0;
+      sextetsCount = 0;
+    }
+  }
+  if (sextetsCount == 2) {
+    result.push_back((chunk >> 4) & 0xFF);
+  } else if (sextetsCount == 3) {
+    result.push_back((chunk >> 10) & 0xFF);
+    result.push_back((chunk >> 2) & 0xFF);
+  }
+  return result;
+}
+
+} // namespace rnoh
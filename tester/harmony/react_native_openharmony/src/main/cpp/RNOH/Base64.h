@@ -0,0 +1,22 @@
+#pragma once
+
+#include <folly/Range.h>
+#include <string>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * Appends the base64 representation of `bytes` to `output`.
+ */
+void encodeBase64(folly::ByteRange bytes, std::string& output);
+
+std::string encodeBase64(folly::ByteRange bytes);
+
+/**
+ * Decodes a base64 string. Characters outside of the base64 alphabet (e.g.
+ * line breaks) are skipped, decoding stops at the first padding character.
+ */
+std::vector<uint8_t> decodeBase64(folly::StringPiece base64);
+
+} // namespace rnoh
@@ -0,0 +1,177 @@
+#include "RNOH/ChildrenClipping.h"
+
+namespace rnoh {
+
+ChildrenClipping::ChildrenClipping(ChildrenClippingDelegate* delegate)
+    : m_delegate(delegate) {}
+
+void ChildrenClipping::setClippingRect(
+    std::optional<facebook::react::Rect> clippingRect) {
+  if (!clippingRect.has_value() && !m_clippingRect.has_value()) {
+    return;
+  }
+  m_clippingRect = std::move(clippingRect);
+  updateClippedChildren();
+}
+
+void ChildrenClipping::updateClippedChildren() {
+  std::size_t arkUINodeIndex = 0;
+  // the tags of children are looked up only when their state changes
+  ensureClippedChildrenCountTree();
+  for (std::size_t index = 0; index < m_isClippedByIndex.size(); index++) {
+    bool shouldClipChild = shouldClip(m_delegate->getChildFrame(index));
+    bool isClipped = m_isClippedByIndex[index];
+    if (shouldClipChild && !isClipped) {
+      m_delegate->detachChildNode(index);
+      m_clippedChildTags.insert(m_delegate->getChildTag(index));
+    } else if (!shouldClipChild && isClipped) {
+      m_delegate->attachChildNode(index, arkUINodeIndex);
+      m_clippedChildTags.erase(m_delegate->getChildTag(index));
+    }
+    m_isClippedByIndex[index] = shouldClipChild;
+    if (!shouldClipChild) {
+      arkUINodeIndex++;
+    }
+  }
+  if (hasClippingRect()) {
+    rebuildClippedChildrenCountTree();
+  } else {
+    m_isClippedByIndex.clear();
+    m_clippedChildrenCountTree.clear();
+    m_isClippedChildrenCountTreeValid = false;
+  }
+}
+
+void ChildrenClipping::onChildFrameChanged(
+    Tag tag,
+    facebook::react::Rect const& frame) {
+  bool shouldClipChild = shouldClip(frame);
+  bool isClipped = m_clippedChildTags.count(tag) > 0;
+  if (shouldClipChild == isClipped) {
+    return;
+  }
+  // the child is looked up only when it needs to be attached or detached
+  auto childrenCount = m_delegate->getChildrenCount();
+  for (std::size_t index = 0; index < childrenCount; index++) {
+    if (m_delegate->getChildTag(index) != tag) {
+      continue;
+    }
+    if (shouldClipChild) {
+      m_delegate->detachChildNode(index);
+      setClipped(index, tag, true);
+    } else {
+      setClipped(index, tag, false);
+      m_delegate->attachChildNode(index, getArkUINodeIndex(index));
+    }
+    return;
+  }
+}
+
+std::size_t ChildrenClipping::onChildInserted(std::size_t index) {
+  if (!hasClippingRect()) {
+    m_isClippedChildrenCountTreeValid = false;
+    return index;
+  }
+  auto arkUINodeIndex = getArkUINodeIndex(index);
+  ensureClippedChildrenCountTree();
+  if (index < m_isClippedByIndex.size()) {
+    m_isClippedByIndex.insert(m_isClippedByIndex.begin() + index, false);
+    rebuildClippedChildrenCountTree();
+    return arkUINodeIndex;
+  }
+  // appending a child adds the node covering it to the tree, which counts
+  // the clipped children in its range
+  m_isClippedByIndex.push_back(false);
+  auto treeIndex = m_isClippedByIndex.size();
+  auto rangeStart = treeIndex - (treeIndex & (~treeIndex + 1));
+  m_clippedChildrenCountTree.push_back(
+      getClippedChildrenCountBefore(treeIndex - 1) -
+      getClippedChildrenCountBefore(rangeStart));
+  return arkUINodeIndex;
+}
+
+bool ChildrenClipping::onChildRemoved(Tag tag) {
+  // the index of the removed child isn't known, the tree is rebuilt when
+  // it's needed
+  m_isClippedChildrenCountTreeValid = false;
+  return m_clippedChildTags.erase(tag) > 0;
+}
+
+std::size_t ChildrenClipping::getArkUINodeIndex(std::size_t index) {
+  if (m_clippedChildTags.empty()) {
+    return index;
+  }
+  // clipped children aren't attached to the ArkUI node
+  ensureClippedChildrenCountTree();
+  return index - getClippedChildrenCountBefore(index);
+}
+
+bool ChildrenClipping::shouldClip(facebook::react::Rect const& frame) const {
+  return m_clippingRect.has_value() &&
+      (frame.getMaxX() < m_clippingRect->getMinX() ||
+       frame.getMinX() > m_clippingRect->getMaxX() ||
+       frame.getMaxY() < m_clippingRect->getMinY() ||
+       frame.getMinY() > m_clippingRect->getMaxY());
+}
+
+void ChildrenClipping::setClipped(std::size_t index, Tag tag, bool isClipped) {
+  if (isClipped) {
+    m_clippedChildTags.insert(tag);
+  } else {
+    m_clippedChildTags.erase(tag);
+  }
+  if (!m_isClippedChildrenCountTreeValid ||
+      index >= m_isClippedByIndex.size() ||
+      m_isClippedByIndex[index] == isClipped) {
+    return;
+  }
+  m_isClippedByIndex[index] = isClipped;
+  addClippedChildrenCount(index, isClipped ? 1 : -1);
+}
+
+void ChildrenClipping::ensureClippedChildrenCountTree() {
+  auto childrenCount = m_delegate->getChildrenCount();
+  if (m_isClippedChildrenCountTreeValid &&
+      m_isClippedByIndex.size() == childrenCount) {
+    return;
+  }
+  m_isClippedByIndex.assign(childrenCount, false);
+  for (std::size_t index = 0; index < childrenCount; index++) {
+    m_isClippedByIndex[index] =
+        m_clippedChildTags.count(m_delegate->getChildTag(index)) > 0;
+  }
+  rebuildClippedChildrenCountTree();
+}
+
+// the tree is 1-based: the node at `i` counts the clipped children in
+// [i - lowbit(i), i)
+void ChildrenClipping::rebuildClippedChildrenCountTree() {
+  auto size = m_isClippedByIndex.size();
+  m_clippedChildrenCountTree.assign(size + 1, 0);
+  for (std::size_t i = 1; i <= size; i++) {
+    m_clippedChildrenCountTree[i] += m_isClippedByIndex[i - 1] ? 1 : 0;
+    auto parent = i + (i & (~i + 1));
+    if (parent <= size) {
+      m_clippedChildrenCountTree[parent] += m_clippedChildrenCountTree[i];
+    }
+  }
+  m_isClippedChildrenCountTreeValid = true;
+}
+
+void ChildrenClipping::addClippedChildrenCount(std::size_t index, int delta) {
+  auto size = m_isClippedByIndex.size();
+  for (auto i = index + 1; i <= size; i += i & (~i + 1)) {
+    m_clippedChildrenCountTree[i] += delta;
+  }
+}
+
+std::size_t ChildrenClipping::getClippedChildrenCountBefore(
+    std::size_t index) const {
+  std::size_t count = 0;
+  for (auto i = index; i > 0; i -= i & (~i + 1)) {
+    count += m_clippedChildrenCountTree[i];
+  }
+  return count;
+}
+
+} // namespace rnoh
@@ -0,0 +1,105 @@
+#pragma once
+#include <react/renderer/graphics/Rect.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+namespace rnoh {
+
+class ChildrenClippingDelegate;
+
+/**
+ * Decides which children of a component have their ArkUI nodes detached,
+ * because their frames don't intersect the clipping rect. The children stay
+ * in the component tree. ArkUI nodes are attached and detached through the
+ * delegate, so that this class doesn't depend on ArkUI.
+ *
+ * While a clipping rect is set, the clipped state of each child is kept by
+ * index in a Fenwick tree, so that the index of a child's node is found in
+ * O(log n). The tree is rebuilt in O(n) when a child is inserted in the
+ * middle or removed, and extended in O(log n) when a child is appended.
+ */
+class ChildrenClipping {
+ public:
+  // same as facebook::react::Tag; ReactPrimitives.h isn't included because
+  // it depends on folly, and this class is tested on the host
+  using Tag = int32_t;
+
+  explicit ChildrenClipping(ChildrenClippingDelegate* delegate);
+
+  bool hasClippingRect() const {
+    return m_clippingRect.has_value();
+  }
+
+  /**
+   * Passing nullopt reattaches every child.
+   */
+  void setClippingRect(std::optional<facebook::react::Rect> clippingRect);
+
+  /**
+   * Attaches and detaches children after they were inserted or removed.
+   */
+  void updateClippedChildren();
+
+  /**
+   * Attaches or detaches a single child after its frame changed. Children
+   * are laid out without their parent being updated, so the parent can't
+   * rely on `updateClippedChildren` being called.
+   */
+  void onChildFrameChanged(Tag tag, facebook::react::Rect const& frame);
+
+  /**
+   * Must be called before the child is added to the delegate's children.
+   * Returns the index at which the child's node must be inserted. The child
+   * is attached until the clipped children are updated.
+   */
+  std::size_t onChildInserted(std::size_t index);
+
+  /**
+   * Returns true if the child was detached, so its node must not be removed.
+   */
+  bool onChildRemoved(Tag tag);
+
+  /**
+   * Maps the index of a child to the index of its node, skipping detached
+   * children.
+   */
+  std::size_t getArkUINodeIndex(std::size_t index);
+
+ private:
+  bool shouldClip(facebook::react::Rect const& frame) const;
+  void setClipped(std::size_t index, Tag tag, bool isClipped);
+
+  // Fenwick tree of the number of clipped children, by child index
+  void ensureClippedChildrenCountTree();
+  void rebuildClippedChildrenCountTree();
+  void addClippedChildrenCount(std::size_t index, int delta);
+  std::size_t getClippedChildrenCountBefore(std::size_t index) const;
+
+  ChildrenClippingDelegate* m_delegate;
+  std::optional<facebook::react::Rect> m_clippingRect;
+  std::unordered_set<Tag> m_clippedChildTags;
+  std::vector<bool> m_isClippedByIndex;
+  std::vector<std::size_t> m_clippedChildrenCountTree;
+  bool m_isClippedChildrenCountTreeValid = false;
+};
+
+class ChildrenClippingDelegate {
+ public:
+  virtual ~ChildrenClippingDelegate() = default;
+  virtual std::size_t getChildrenCount() const = 0;
+  virtual ChildrenClipping::Tag getChildTag(std::size_t index) const = 0;
+  virtual facebook::react::Rect getChildFrame(std::size_t index) const = 0;
+  /**
+   * Attaches the ArkUI node of the child at `index` to the parent's node, at
+   * `arkUINodeIndex`.
+   */
+  virtual void attachChildNode(
+      std::size_t index,
+      std::size_t arkUINodeIndex) = 0;
+  virtual void detachChildNode(std::size_t index) = 0;
+};
+
+} // namespace rnoh
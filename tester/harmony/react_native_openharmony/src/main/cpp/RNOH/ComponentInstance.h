@@ -11,6 +11,7 @@
 #include <vector>
 #include "RNOH/ArkTSChannel.h"
 #include "RNOH/ArkTSMessageHub.h"
+#include "RNOH/ContinuousEventCoalescer.h"
 #include "RNOH/RNInstance.h"
 #include "RNOH/TouchTarget.h"
 #include "RNOH/arkui/ArkUINode.h"
@@ -35,6 +36,7 @@ class ComponentInstance
     ArkTSChannel::Shared arkTSChannel;
     ArkTSMessageHub::Shared arkTSMessageHub;
     RNInstance::Weak rnInstance;
+    ContinuousEventCoalescer::Shared continuousEventCoalescer;
   };
 
   struct Context {
@@ -87,6 +89,12 @@ class ComponentInstance
 
   virtual void setLayout(facebook::react::LayoutMetrics layoutMetrics){};
 
+  /**
+   * Called when the frame of a child changes. Mutations which change only
+   * the layout of a child don't update its parent.
+   */
+  virtual void onChildLayoutChanged(ComponentInstance const& child){};
+
   virtual void setEventEmitter(
       facebook::react::SharedEventEmitter eventEmitter){};
 
@@ -0,0 +1,117 @@
+#include "RNOH/ContinuousEventCoalescer.h"
+
+namespace rnoh {
+
+using namespace facebook;
+
+void ContinuousEventCoalescer::setRuntimeExecutor(
+    react::RuntimeExecutor runtimeExecutor) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_runtimeExecutor = std::move(runtimeExecutor);
+}
+
+// NOTE: events are dispatched while holding the lock, so that an event
+// dispatched on the JS thread can't be reordered with a discrete event
+// dispatched on the MAIN thread. Dispatching an event only enqueues it and
+// requests a beat, so it doesn't reenter this class.
+void ContinuousEventCoalescer::dispatchEvent(
+    Tag tag,
+    std::string const& eventType,
+    Dispatch dispatch) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& stats = m_statsByEventType[eventType];
+  if (m_runtimeExecutor == nullptr) {
+    stats.dispatchedEventsCount++;
+    dispatch();
+    return;
+  }
+  Key key{tag, eventType};
+  auto it = m_inFlightEventByKey.find(key);
+  if (it != m_inFlightEventByKey.end()) {
+    if (it->second.pendingDispatch != nullptr) {
+      stats.coalescedEventsCount++;
+    }
+    it->second.pendingDispatch = std::move(dispatch);
+    return;
+  }
+  stats.dispatchedEventsCount++;
+  dispatch();
+  m_inFlightEventByKey.emplace(key, InFlightEvent{});
+  scheduleConsumptionCheck(std::move(key));
+}
+
+void ContinuousEventCoalescer::flush(Tag tag) {
+  dispatchPendingEvents(tag);
+}
+
+void ContinuousEventCoalescer::flushAll() {
+  dispatchPendingEvents(std::nullopt);
+}
+
+std::unordered_map<std::string, ContinuousEventCoalescer::Stats>
+ContinuousEventCoalescer::getStatsByEventType() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_statsByEventType;
+}
+
+std::string ContinuousEventCoalescer::getStatsJSON() const {
+  std::string json = "[";
+  for (auto const& [eventType, stats] : getStatsByEventType()) {
+    if (json.size() > 1) {
+      json += ',';
+    }
+    json += "{\"eventType\":\"" + eventType + "\"";
+    json += ",\"dispatchedEventsCount\":" +
+        std::to_string(stats.dispatchedEventsCount);
+    json += ",\"coalescedEventsCount\":" +
+        std::to_string(stats.coalescedEventsCount);
+    json += '}';
+  }
+  json += ']';
+  return json;
+}
+
+void ContinuousEventCoalescer::dispatchPendingEvents(
+    std::optional<Tag> tag) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto& [key, inFlightEvent] : m_inFlightEventByKey) {
+    if ((tag.has_value() && key.tag != tag.value()) ||
+        inFlightEvent.pendingDispatch == nullptr) {
+      continue;
+    }
+    m_statsByEventType[key.eventType].dispatchedEventsCount++;
+    auto dispatch = std::move(inFlightEvent.pendingDispatch);
+    inFlightEvent.pendingDispatch = nullptr;
+    dispatch();
+  }
+}
+
+void ContinuousEventCoalescer::scheduleConsumptionCheck(Key key) {
+  // the beat which delivers the dispatched event was scheduled on the same
+  // executor, so it runs before this callback
+  m_runtimeExecutor([weakSelf = weak_from_this(),
+                     key = std::move(key)](jsi::Runtime& /*runtime*/) {
+    if (auto self = weakSelf.lock()) {
+      self->onEventConsumed(key);
+    }
+  });
+}
+
+void ContinuousEventCoalescer::onEventConsumed(Key const& key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_inFlightEventByKey.find(key);
+  if (it == m_inFlightEventByKey.end()) {
+    return;
+  }
+  if (it->second.pendingDispatch == nullptr) {
+    m_inFlightEventByKey.erase(it);
+    return;
+  }
+  m_statsByEventType[key.eventType].dispatchedEventsCount++;
+  auto dispatch = std::move(it->second.pendingDispatch);
+  it->second.pendingDispatch = nullptr;
+  dispatch();
+  scheduleConsumptionCheck(key);
+}
+
+} // namespace rnoh
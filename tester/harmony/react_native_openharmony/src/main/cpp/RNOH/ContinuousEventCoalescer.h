@@ -0,0 +1,99 @@
+#pragma once
+#include <ReactCommon/RuntimeExecutor.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace rnoh {
+
+/**
+ * Used only in C-API based Architecture.
+ *
+ * Applies JS backpressure to continuous events, e.g. scroll or touch move.
+ * Until JS consumes the event dispatched for a given target and event type,
+ * only the latest payload of the following ones is kept, and it's dispatched
+ * once the previous event is consumed. Discrete events of the same target
+ * must be preceded by `flush` to keep the order of events.
+ */
+class ContinuousEventCoalescer
+    : public std::enable_shared_from_this<ContinuousEventCoalescer> {
+ public:
+  using Shared = std::shared_ptr<ContinuousEventCoalescer>;
+  using Dispatch = std::function<void()>;
+  // same as facebook::react::Tag; ReactPrimitives.h isn't included because
+  // it depends on folly, and this class is tested on the host
+  using Tag = int32_t;
+
+  struct Stats {
+    size_t dispatchedEventsCount = 0;
+    size_t coalescedEventsCount = 0;
+  };
+
+  /**
+   * Events are dispatched without coalescing until the executor is set.
+   * Callbacks of the executor must run in the order they were scheduled.
+   */
+  void setRuntimeExecutor(facebook::react::RuntimeExecutor runtimeExecutor);
+
+  /**
+   * `dispatch` may be called on the JS thread, so it must only use
+   * thread-safe APIs such as EventEmitter.
+   */
+  void dispatchEvent(
+      Tag tag,
+      std::string const& eventType,
+      Dispatch dispatch);
+
+  /**
+   * Dispatches pending events of the target.
+   */
+  void flush(Tag tag);
+
+  void flushAll();
+
+  std::unordered_map<std::string, Stats> getStatsByEventType() const;
+
+  /**
+   * Serializes stats of each event type.
+   */
+  std::string getStatsJSON() const;
+
+ private:
+  struct Key {
+    Tag tag;
+    std::string eventType;
+
+    bool operator==(Key const& other) const {
+      return tag == other.tag && eventType == other.eventType;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(Key const& key) const {
+      return std::hash<Tag>()(key.tag) * 31 +
+          std::hash<std::string>()(key.eventType);
+    }
+  };
+
+  /**
+   * An entry exists while an event of the key wasn't consumed by JS.
+   */
+  struct InFlightEvent {
+    Dispatch pendingDispatch;
+  };
+
+  void dispatchPendingEvents(std::optional<Tag> tag);
+  void scheduleConsumptionCheck(Key key);
+  void onEventConsumed(Key const& key);
+
+  mutable std::mutex m_mutex;
+  facebook::react::RuntimeExecutor m_runtimeExecutor;
+  std::unordered_map<Key, InFlightEvent, KeyHash> m_inFlightEventByKey;
+  std::unordered_map<std::string, Stats> m_statsByEventType;
+};
+
+} // namespace rnoh
@@ -87,8 +87,13 @@ class CppComponentInstance : public ComponentInstance {
   void setLayout(facebook::react::LayoutMetrics layoutMetrics) override {
     this->getLocalRootArkUINode().setPosition(layoutMetrics.frame.origin);
     this->getLocalRootArkUINode().setSize(layoutMetrics.frame.size);
+    auto isFrameChanged = layoutMetrics.frame != m_layoutMetrics.frame;
     m_layoutMetrics = layoutMetrics;
     markBoundingBoxAsDirty();
+    auto parent = getParent().lock();
+    if (isFrameChanged && parent != nullptr) {
+      parent->onChildLayoutChanged(*this);
+    }
   }
 
   // TouchTarget implementation
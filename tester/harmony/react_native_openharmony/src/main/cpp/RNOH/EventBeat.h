@@ -1,5 +1,6 @@
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/renderer/core/EventBeat.h>
+#include <atomic>
 #include "RNOH/TaskExecutor/TaskExecutor.h"
 
 namespace rnoh {
@@ -19,8 +20,15 @@ class EventBeat : public facebook::react::EventBeat {
       return;
     }
 
-    this->m_runtimeExecutor(
-        [this](facebook::jsi::Runtime& runtime) { beat(runtime); });
+    // a scheduled beat flushes every event enqueued before it runs, so there's
+    // no need to schedule another one while JS is busy
+    if (m_isBeatScheduled.exchange(true)) {
+      return;
+    }
+    this->m_runtimeExecutor([this](facebook::jsi::Runtime& runtime) {
+      m_isBeatScheduled = false;
+      beat(runtime);
+    });
   }
 
   void request() const override {
@@ -33,6 +41,7 @@ class EventBeat : public facebook::react::EventBeat {
  private:
   std::weak_ptr<TaskExecutor> m_taskExecutor;
   facebook::react::RuntimeExecutor m_runtimeExecutor;
+  mutable std::atomic<bool> m_isBeatScheduled{false};
 };
 
 } // namespace rnoh
\ No newline at end of file
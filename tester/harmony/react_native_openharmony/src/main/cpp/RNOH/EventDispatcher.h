@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EventEmitRequestHandler.h"
+#include "EventRoutingTable.h"
 
 namespace rnoh {
 
@@ -9,43 +10,35 @@ class EventDispatcher {
   using Context = EventEmitRequestHandler::Context;
 
   void sendEvent(Context const& ctx) {
-    for (auto& weakHandler : m_requestHandlers) {
-      if (auto handler = weakHandler.lock()) {
-        handler->handleEvent(ctx);
-      }
-    }
+    m_requestHandlers.forEachHandler(
+        ctx.eventName, [&ctx](auto const& weakHandler) {
+          if (auto handler = weakHandler.lock()) {
+            handler->handleEvent(ctx);
+          }
+        });
   }
 
   void registerEventListener(EventEmitRequestHandler::Shared const& handler) {
-    m_requestHandlers.push_back(handler);
+    m_requestHandlers.add(handler, handler->getEventNames());
   }
 
   void unregisterEventListener(EventEmitRequestHandler::Shared const& handler) {
-    auto it = std::remove_if(
-        m_requestHandlers.begin(),
-        m_requestHandlers.end(),
-        [&handler](auto& weakHandler) {
+    auto isRemoved =
+        m_requestHandlers.removeIf([&handler](auto const& weakHandler) {
           return weakHandler.expired() || weakHandler.lock() == handler;
         });
-    if (it != m_requestHandlers.end()) {
-      m_requestHandlers.erase(it, m_requestHandlers.end());
-    } else {
+    if (!isRemoved) {
       LOG(ERROR) << "Trying to unregister a non-registered listener";
     }
   }
 
   void unregisterExpiredListeners() {
-    auto it = std::remove_if(
-        m_requestHandlers.begin(),
-        m_requestHandlers.end(),
-        [](auto& weakHandler) { return weakHandler.expired(); });
-    if (it != m_requestHandlers.end()) {
-      m_requestHandlers.erase(it, m_requestHandlers.end());
-    }
+    m_requestHandlers.removeIf(
+        [](auto const& weakHandler) { return weakHandler.expired(); });
   }
 
  private:
-  std::vector<EventEmitRequestHandler::Weak> m_requestHandlers;
+  EventRoutingTable<EventEmitRequestHandler::Weak> m_requestHandlers;
 };
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
@@ -20,6 +20,14 @@ class EventEmitRequestHandler {
   };
 
   virtual void handleEvent(Context const& ctx) = 0;
+
+  /**
+   * Names of events passed to this handler. Handlers which return no names
+   * receive every event and have to filter them in `handleEvent`.
+   */
+  virtual std::vector<std::string> getEventNames() const {
+    return {};
+  }
 };
 
 using EventEmitRequestHandlers = std::vector<EventEmitRequestHandler::Shared>;
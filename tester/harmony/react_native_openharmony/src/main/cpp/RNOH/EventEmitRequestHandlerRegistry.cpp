@@ -0,0 +1,21 @@
+#include "RNOH/EventEmitRequestHandlerRegistry.h"
+
+namespace rnoh {
+
+EventEmitRequestHandlerRegistry::EventEmitRequestHandlerRegistry(
+    EventEmitRequestHandlers const& eventEmitRequestHandlers) {
+  for (auto const& eventEmitRequestHandler : eventEmitRequestHandlers) {
+    m_handlers.add(
+        eventEmitRequestHandler, eventEmitRequestHandler->getEventNames());
+  }
+}
+
+void EventEmitRequestHandlerRegistry::handleEvent(
+    EventEmitRequestHandler::Context const& ctx) const {
+  m_handlers.forEachHandler(
+      ctx.eventName, [&ctx](auto const& eventEmitRequestHandler) {
+        eventEmitRequestHandler->handleEvent(ctx);
+      });
+}
+
+} // namespace rnoh
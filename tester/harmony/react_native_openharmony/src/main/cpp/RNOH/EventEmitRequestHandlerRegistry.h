@@ -0,0 +1,24 @@
+#pragma once
+#include "RNOH/EventEmitRequestHandler.h"
+#include "RNOH/EventRoutingTable.h"
+
+namespace rnoh {
+
+/**
+ * Routes events to the handlers of all packages, built once when the
+ * instance is created.
+ */
+class EventEmitRequestHandlerRegistry {
+ public:
+  using Shared = std::shared_ptr<EventEmitRequestHandlerRegistry>;
+
+  explicit EventEmitRequestHandlerRegistry(
+      EventEmitRequestHandlers const& eventEmitRequestHandlers);
+
+  void handleEvent(EventEmitRequestHandler::Context const& ctx) const;
+
+ private:
+  EventRoutingTable<EventEmitRequestHandler::Shared> m_handlers;
+};
+
+} // namespace rnoh
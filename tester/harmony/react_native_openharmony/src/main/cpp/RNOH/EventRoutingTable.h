@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * Groups event handlers by the names of events they handle, so that routing
+ * a high-frequency event, e.g. `onScroll`, costs a single lookup instead of
+ * calling every handler. Handlers registered without names receive every
+ * event. `HandlerRef` is a shared or a weak pointer to the handler; the table
+ * doesn't depend on the handler type, so it can be used in host builds.
+ */
+template <typename HandlerRef>
+class EventRoutingTable {
+ public:
+  void add(HandlerRef handler, std::vector<std::string> eventNames) {
+    if (eventNames.empty()) {
+      m_handlersOfAllEvents.push_back(std::move(handler));
+      return;
+    }
+    for (auto& eventName : eventNames) {
+      m_handlersByEventName[std::move(eventName)].push_back(handler);
+    }
+  }
+
+  /**
+   * Calls `fn(HandlerRef const&)` for the handlers of `eventName`, then for
+   * the handlers of all events.
+   */
+  template <typename Fn>
+  void forEachHandler(std::string const& eventName, Fn&& fn) const {
+    auto it = m_handlersByEventName.find(eventName);
+    if (it != m_handlersByEventName.end()) {
+      for (auto const& handler : it->second) {
+        fn(handler);
+      }
+    }
+    for (auto const& handler : m_handlersOfAllEvents) {
+      fn(handler);
+    }
+  }
+
+  /**
+   * Returns true if any handler was removed.
+   */
+  template <typename Predicate>
+  bool removeIf(Predicate predicate) {
+    bool isRemoved = removeIf(m_handlersOfAllEvents, predicate);
+    for (auto& [eventName, handlers] : m_handlersByEventName) {
+      isRemoved |= removeIf(handlers, predicate);
+    }
+    return isRemoved;
+  }
+
+ private:
+  using Handlers = std::vector<HandlerRef>;
+
+  template <typename Predicate>
+  static bool removeIf(Handlers& handlers, Predicate& predicate) {
+    auto it = std::remove_if(handlers.begin(), handlers.end(), predicate);
+    if (it == handlers.end()) {
+      return false;
+    }
+    handlers.erase(it, handlers.end());
+    return true;
+  }
+
+  std::unordered_map<std::string, Handlers> m_handlersByEventName;
+  Handlers m_handlersOfAllEvents;
+};
+
+} // namespace rnoh
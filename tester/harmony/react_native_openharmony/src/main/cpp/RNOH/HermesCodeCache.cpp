@@ -0,0 +1,262 @@
+#include "RNOH/HermesCodeCache.h"
+#include <cxxreact/JSBundleType.h>
+#include <folly/hash/SpookyHashV2.h>
+#include <glog/logging.h>
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace hermes {
+// from hermes/CompileJS.h, declared weak, so that RNOH links against libhermes
+// builds without the compiler API, in which case the symbol is null
+__attribute__((weak)) bool compileJS(
+    const std::string& str,
+    const std::string& sourceURL,
+    std::string& bytecode,
+    bool optimize);
+} // namespace hermes
+
+namespace rnoh {
+
+using namespace facebook;
+namespace fs = std::filesystem;
+
+static std::string const ENTRY_EXTENSION = ".hbc";
+
+static bool endsWith(std::string const& str, std::string const& suffix) {
+  return str.size() >= suffix.size() &&
+      str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static bool isHermesBytecode(react::JSBigString const& bytecode) {
+  react::BundleHeader header;
+  std::memcpy(
+      &header, bytecode.c_str(), std::min(sizeof(header), bytecode.size()));
+  return react::isHermesBytecodeBundle(header);
+}
+
+/**
+ * Source bundle shared with the compilation task.
+ */
+class SharedJSBigString : public react::JSBigString {
+ public:
+  explicit SharedJSBigString(std::shared_ptr<const react::JSBigString> source)
+      : m_source(std::move(source)) {}
+
+  bool isAscii() const override {
+    return m_source->isAscii();
+  }
+
+  const char* c_str() const override {
+    return m_source->c_str();
+  }
+
+  size_t size() const override {
+    return m_source->size();
+  }
+
+ private:
+  std::shared_ptr<const react::JSBigString> m_source;
+};
+
+std::shared_ptr<HermesCodeCache> HermesCodeCache::instance = nullptr;
+
+void HermesCodeCache::initializeInstance(
+    std::string dirPath,
+    size_t maxSizeInBytes,
+    uint32_t bytecodeVersion) {
+  // the instance is read on the JS threads of all RN instances
+  std::atomic_exchange(
+      &instance,
+      std::make_shared<HermesCodeCache>(
+          std::move(dirPath), maxSizeInBytes, bytecodeVersion));
+}
+
+HermesCodeCache::Shared HermesCodeCache::getInstance() {
+  return std::atomic_load(&instance);
+}
+
+HermesCodeCache::Compiler HermesCodeCache::getHermesCompiler() {
+  if (::hermes::compileJS == nullptr) {
+    return nullptr;
+  }
+  return [](std::string const& source,
+            std::string const& sourceURL,
+            std::string& bytecode) {
+    return ::hermes::compileJS(source, sourceURL, bytecode, true);
+  };
+}
+
+HermesCodeCache::HermesCodeCache(
+    std::string dirPath,
+    size_t maxSizeInBytes,
+    uint32_t bytecodeVersion,
+    Compiler compiler)
+    : m_dirPath(std::move(dirPath)),
+      m_maxSizeInBytes(maxSizeInBytes),
+      m_bytecodeVersion(bytecodeVersion),
+      m_compiler(std::move(compiler)) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  trim();
+}
+
+std::string HermesCodeCache::getKey(react::JSBigString const& source) const {
+  uint64_t hash1 = 0;
+  uint64_t hash2 = 0;
+  folly::hash::SpookyHashV2::Hash128(
+      source.c_str(), source.size(), &hash1, &hash2);
+  char key[33];
+  std::snprintf(key, sizeof(key), "%016" PRIx64 "%016" PRIx64, hash1, hash2);
+  return key;
+}
+
+std::unique_ptr<const react::JSBigString> HermesCodeCache::prepareBundle(
+    std::unique_ptr<const react::JSBigString> source,
+    std::string const& sourceURL,
+    TaskExecutor::Shared const& taskExecutor) {
+  auto canCompile = m_compiler && taskExecutor != nullptr;
+  // without the compiler entries are only added by `store`, so there's
+  // nothing to look up until then, and hashing the source would only delay
+  // the launch
+  if (!canCompile && m_entriesCount == 0) {
+    return source;
+  }
+  auto key = getKey(*source);
+  if (auto bytecode = load(key)) {
+    return bytecode;
+  }
+  if (!canCompile) {
+    return source;
+  }
+  // the source is shared with the compilation task, so it isn't copied
+  std::shared_ptr<const react::JSBigString> sharedSource = std::move(source);
+  taskExecutor->runTask(
+      TaskThread::BACKGROUND,
+      [weakSelf = weak_from_this(), key, sharedSource, sourceURL] {
+        if (auto self = weakSelf.lock()) {
+          self->compileAndStore(key, sharedSource, sourceURL);
+        }
+      });
+  return std::make_unique<SharedJSBigString>(std::move(sharedSource));
+}
+
+bool HermesCodeCache::store(
+    std::string const& key,
+    std::string_view bytecode) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::error_code ec;
+  fs::create_directories(m_dirPath, ec);
+  auto path = getEntryPath(key);
+  // the entry is written under a temporary name, so that a partially written
+  // file is never loaded
+  auto tmpPath = path + ".tmp";
+  {
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    file.write(bytecode.data(), bytecode.size());
+    if (!file) {
+      LOG(ERROR) << "Couldn't write Hermes code cache entry: " << tmpPath;
+      fs::remove(tmpPath, ec);
+      return false;
+    }
+  }
+  fs::rename(tmpPath, path, ec);
+  if (ec) {
+    LOG(ERROR) << "Couldn't store Hermes code cache entry: " << ec.message();
+    fs::remove(tmpPath, ec);
+    return false;
+  }
+  trim();
+  return true;
+}
+
+std::string HermesCodeCache::getEntrySuffix() const {
+  return "." + std::to_string(m_bytecodeVersion) + ENTRY_EXTENSION;
+}
+
+std::string HermesCodeCache::getEntryPath(std::string const& key) const {
+  return m_dirPath + "/" + key + getEntrySuffix();
+}
+
+std::unique_ptr<const react::JSBigString> HermesCodeCache::load(
+    std::string const& key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto path = getEntryPath(key);
+  std::error_code ec;
+  if (!fs::exists(path, ec)) {
+    return nullptr;
+  }
+  std::unique_ptr<const react::JSBigFileString> bytecode;
+  try {
+    bytecode = react::JSBigFileString::fromPath(path);
+  } catch (std::exception const& e) {
+    LOG(ERROR) << "Couldn't open Hermes code cache entry: " << e.what();
+    return nullptr;
+  }
+  if (!isHermesBytecode(*bytecode)) {
+    fs::remove(path, ec);
+    m_entriesCount--;
+    return nullptr;
+  }
+  // the modification time is used to find least recently used entries
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  return bytecode;
+}
+
+void HermesCodeCache::compileAndStore(
+    std::string const& key,
+    std::shared_ptr<const react::JSBigString> source,
+    std::string const& sourceURL) {
+  std::string bytecode;
+  if (!m_compiler(
+          std::string(source->c_str(), source->size()), sourceURL, bytecode)) {
+    LOG(WARNING) << "Couldn't compile " << sourceURL << " to Hermes bytecode";
+    return;
+  }
+  store(key, bytecode);
+}
+
+void HermesCodeCache::trim() {
+  struct Entry {
+    fs::path path;
+    fs::file_time_type lastUsedTime;
+    uintmax_t size;
+  };
+  std::error_code ec;
+  auto entrySuffix = getEntrySuffix();
+  std::vector<Entry> entries;
+  for (auto const& dirEntry : fs::directory_iterator(m_dirPath, ec)) {
+    auto fileName = dirEntry.path().filename().string();
+    if (!endsWith(fileName, ENTRY_EXTENSION)) {
+      continue;
+    }
+    if (!endsWith(fileName, entrySuffix)) {
+      // compiled by a different Hermes version
+      fs::remove(dirEntry.path(), ec);
+      continue;
+    }
+    entries.push_back(
+        {.path = dirEntry.path(),
+         .lastUsedTime = dirEntry.last_write_time(ec),
+         .size = dirEntry.file_size(ec)});
+  }
+  std::sort(entries.begin(), entries.end(), [](auto const& a, auto const& b) {
+    return a.lastUsedTime > b.lastUsedTime;
+  });
+  uintmax_t totalSize = 0;
+  size_t entriesCount = 0;
+  for (auto const& entry : entries) {
+    totalSize += entry.size;
+    if (totalSize > m_maxSizeInBytes) {
+      fs::remove(entry.path, ec);
+    } else {
+      entriesCount++;
+    }
+  }
+  m_entriesCount = entriesCount;
+}
+
+} // namespace rnoh
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cxxreact/JSBigString.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include "RNOH/TaskExecutor/TaskExecutor.h"
+
+namespace rnoh {
+
+/**
+ * On-disk cache of Hermes bytecode compiled from JS source bundles. Entries
+ * are keyed by the hash of the source and the Hermes bytecode version, so
+ * updating either of them invalidates the entry. Cached bytecode is
+ * memory-mapped. When the cache grows over its size limit, least recently
+ * used entries are removed.
+ *
+ * On a miss, the source is compiled on the BACKGROUND thread if the loaded
+ * libhermes exports the compiler API, which is detected at runtime. Without
+ * the compiler, the cache serves bytecode that was precompiled and stored
+ * with `store`, e.g. by an OTA update, and the source isn't hashed as long as
+ * the cache is empty.
+ */
+class HermesCodeCache : public std::enable_shared_from_this<HermesCodeCache> {
+  static std::shared_ptr<HermesCodeCache> instance;
+
+ public:
+  using Shared = std::shared_ptr<HermesCodeCache>;
+  /**
+   * Compiles JS source to Hermes bytecode. Returns false on failure.
+   */
+  using Compiler = std::function<bool(
+      std::string const& source,
+      std::string const& sourceURL,
+      std::string& bytecode)>;
+
+  /**
+   * Returns hermes::compileJS if libhermes exports it, or an empty function.
+   */
+  static Compiler getHermesCompiler();
+
+  /**
+   * `bytecodeVersion` is the version of bytecode accepted by the Hermes
+   * runtime. Entries of other versions are removed.
+   */
+  static void initializeInstance(
+      std::string dirPath,
+      size_t maxSizeInBytes,
+      uint32_t bytecodeVersion);
+
+  /**
+   * Returns nullptr if the cache wasn't initialized.
+   */
+  static HermesCodeCache::Shared getInstance();
+
+  HermesCodeCache(
+      std::string dirPath,
+      size_t maxSizeInBytes,
+      uint32_t bytecodeVersion,
+      Compiler compiler = getHermesCompiler());
+
+  HermesCodeCache(HermesCodeCache const&) = delete;
+  HermesCodeCache& operator=(HermesCodeCache const&) = delete;
+
+  std::string getKey(facebook::react::JSBigString const& source) const;
+
+  /**
+   * Returns cached bytecode for the source bundle. On a cache miss, returns the
+   * source and, if there's a compiler, compiles it on the BACKGROUND thread of
+   * `taskExecutor`, so that the next launch can use the bytecode.
+   */
+  std::unique_ptr<const facebook::react::JSBigString> prepareBundle(
+      std::unique_ptr<const facebook::react::JSBigString> source,
+      std::string const& sourceURL,
+      TaskExecutor::Shared const& taskExecutor);
+
+  /**
+   * Stores bytecode compiled from the source with the given key. Returns false
+   * if the entry couldn't be written.
+   */
+  bool store(std::string const& key, std::string_view bytecode);
+
+ private:
+  std::string getEntrySuffix() const;
+  std::string getEntryPath(std::string const& key) const;
+  std::unique_ptr<const facebook::react::JSBigString> load(
+      std::string const& key);
+  void compileAndStore(
+      std::string const& key,
+      std::shared_ptr<const facebook::react::JSBigString> source,
+      std::string const& sourceURL);
+  /**
+   * Removes entries of other bytecode versions and least recently used entries
+   * over the size limit, and updates the number of entries.
+   */
+  void trim();
+
+  std::string m_dirPath;
+  size_t m_maxSizeInBytes;
+  uint32_t m_bytecodeVersion;
+  Compiler m_compiler;
+  std::atomic<size_t> m_entriesCount = 0;
+  std::mutex m_mutex;
+};
+
+} // namespace rnoh
@@ -0,0 +1,37 @@
+#include "RNOH/ImageLoader/FileImageFetcher.h"
+#include <fstream>
+#include <string_view>
+#include "RNOH/RNOHError.h"
+
+namespace rnoh {
+
+using namespace std::literals;
+constexpr std::string_view FILE_PREFIX = "file://"sv;
+
+std::string FileImageFetcher::getPath(std::string const& uri) {
+  if (uri.rfind(FILE_PREFIX, 0) == 0) {
+    return uri.substr(FILE_PREFIX.size());
+  }
+  return uri;
+}
+
+bool FileImageFetcher::canFetch(std::string const& uri) const {
+  return uri.rfind(FILE_PREFIX, 0) == 0 || uri.rfind("/", 0) == 0;
+}
+
+std::vector<uint8_t> FileImageFetcher::fetch(std::string const& uri) {
+  auto path = getPath(uri);
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    throw RNOHError("Couldn't open the image file: " + path);
+  }
+  std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(data.data()), data.size());
+  if (!file) {
+    throw RNOHError("Couldn't read the image file: " + path);
+  }
+  return data;
+}
+
+} // namespace rnoh
@@ -0,0 +1,20 @@
+#pragma once
+#include "RNOH/ImageLoader/ImageFetcher.h"
+
+namespace rnoh {
+
+/**
+ * Reads images from `file://` URIs and absolute paths.
+ */
+class FileImageFetcher : public ImageFetcher {
+ public:
+  bool canFetch(std::string const& uri) const override;
+  std::vector<uint8_t> fetch(std::string const& uri) override;
+  bool shouldCacheOnDisk() const override {
+    return false;
+  }
+
+  static std::string getPath(std::string const& uri);
+};
+
+} // namespace rnoh
@@ -0,0 +1,49 @@
+#include "RNOH/ImageLoader/ImageDecodeTarget.h"
+#include <algorithm>
+#include <cmath>
+
+namespace rnoh {
+
+static uint32_t roundUpToBucket(uint32_t size) {
+  auto bucketSize = ImageDecodeTarget::BUCKET_SIZE;
+  return std::max<uint32_t>(1, (size + bucketSize - 1) / bucketSize) *
+      bucketSize;
+}
+
+ImageDecodeTarget ImageDecodeTarget::getBucketed() const {
+  return {
+      .width = roundUpToBucket(width),
+      .height = roundUpToBucket(height),
+      .scaleMode = scaleMode};
+}
+
+DecodeSize ImageDecodeTarget::getDecodeSize(
+    uint32_t sourceWidth,
+    uint32_t sourceHeight) const {
+  if (sourceWidth == 0 || sourceHeight == 0 || width == 0 || height == 0) {
+    return {.width = sourceWidth, .height = sourceHeight};
+  }
+  auto widthScale = static_cast<double>(width) / sourceWidth;
+  auto heightScale = static_cast<double>(height) / sourceHeight;
+  // the image is scaled uniformly, so that it keeps its aspect ratio
+  auto scale = scaleMode == ScaleMode::COVER
+      ? std::max(widthScale, heightScale)
+      : std::min(widthScale, heightScale);
+  if (scale >= 1) {
+    return {.width = sourceWidth, .height = sourceHeight};
+  }
+  // rounded up, so that the decoded image isn't smaller than the target; the
+  // epsilon absorbs floating point errors, e.g. 4000 * (128 / 4000.0)
+  auto scaleSize = [scale](uint32_t size) {
+    return std::max<uint32_t>(
+        1, static_cast<uint32_t>(std::ceil(size * scale - 1e-6)));
+  };
+  return {.width = scaleSize(sourceWidth), .height = scaleSize(sourceHeight)};
+}
+
+std::string ImageDecodeTarget::getCacheKey() const {
+  return std::to_string(width) + "x" + std::to_string(height) +
+      (scaleMode == ScaleMode::COVER ? ":cover" : ":contain");
+}
+
+} // namespace rnoh
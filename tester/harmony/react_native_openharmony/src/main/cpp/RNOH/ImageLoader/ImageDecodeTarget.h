@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace rnoh {
+
+struct DecodeSize {
+  uint32_t width;
+  uint32_t height;
+};
+
+/**
+ * Size at which an image is displayed, in physical pixels. Images are decoded
+ * at the smallest size that fills the target with the image's aspect ratio,
+ * and they are never upscaled.
+ */
+struct ImageDecodeTarget {
+  /**
+   * Targets are rounded up to multiples of this size, so that images
+   * displayed at similar sizes share a decoded image.
+   */
+  static constexpr uint32_t BUCKET_SIZE = 64;
+
+  enum class ScaleMode {
+    /**
+     * The image covers the whole target, e.g. resizeMode "cover" or
+     * "stretch".
+     */
+    COVER,
+    /**
+     * The image fits inside the target, e.g. resizeMode "contain" or
+     * "center".
+     */
+    CONTAIN,
+  };
+
+  uint32_t width;
+  uint32_t height;
+  ScaleMode scaleMode;
+
+  ImageDecodeTarget getBucketed() const;
+
+  DecodeSize getDecodeSize(uint32_t sourceWidth, uint32_t sourceHeight) const;
+
+  /**
+   * Identifies images decoded for this target in the memory cache.
+   */
+  std::string getCacheKey() const;
+
+  bool operator==(ImageDecodeTarget const& other) const {
+    return width == other.width && height == other.height &&
+        scaleMode == other.scaleMode;
+  }
+
+  bool operator!=(ImageDecodeTarget const& other) const {
+    return !(*this == other);
+  }
+};
+
+} // namespace rnoh
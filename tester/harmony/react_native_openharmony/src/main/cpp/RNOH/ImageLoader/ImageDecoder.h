@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "RNOH/ImageLoader/ImageDecodeTarget.h"
+
+namespace rnoh {
+
+/**
+ * Bitmap ready to be displayed. Implementations are provided by the platform
+ * decoder.
+ */
+class DecodedImage {
+ public:
+  using Shared = std::shared_ptr<const DecodedImage>;
+
+  virtual ~DecodedImage() = default;
+
+  virtual uint32_t getWidth() const = 0;
+  virtual uint32_t getHeight() const = 0;
+
+  /**
+   * Size of the encoded image, which may be larger than the decoded one.
+   */
+  virtual uint32_t getSourceWidth() const = 0;
+  virtual uint32_t getSourceHeight() const = 0;
+
+  /**
+   * Memory occupied by the pixels, used to bound the memory cache.
+   */
+  virtual size_t getByteSize() const = 0;
+};
+
+class ImageDecoder {
+ public:
+  using Shared = std::shared_ptr<ImageDecoder>;
+
+  virtual ~ImageDecoder() = default;
+
+  /**
+   * Called on ImageLoader's worker threads. Without a target, the image is
+   * decoded at its source size. Returns nullptr if the image can't be
+   * represented by a single bitmap (e.g. an animated GIF), so that it's
+   * displayed from its file instead. Throws RNOHError if the data is invalid.
+   */
+  virtual DecodedImage::Shared decode(
+      std::vector<uint8_t> const& data,
+      std::optional<ImageDecodeTarget> const& target) = 0;
+};
+
+} // namespace rnoh
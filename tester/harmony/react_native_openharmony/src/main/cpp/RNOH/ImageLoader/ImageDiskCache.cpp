@@ -0,0 +1,258 @@
+#include "RNOH/ImageLoader/ImageDiskCache.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace rnoh {
+
+namespace fs = std::filesystem;
+
+static std::string const ENTRY_EXTENSION = ".img";
+
+ImageDiskCache::ImageDiskCache(std::string dirPath, size_t maxSizeInBytes)
+    : m_dirPath(std::move(dirPath)), m_maxSizeInBytes(maxSizeInBytes) {}
+
+static uint64_t rotateLeft(uint64_t value, int bitsCount) {
+  return (value << bitsCount) | (value >> (64 - bitsCount));
+}
+
+static uint64_t mixFinal(uint64_t value) {
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+// MurmurHash3_x64_128 with seed 0, for little-endian platforms
+static void murmurHash3(
+    uint8_t const* data,
+    size_t size,
+    uint64_t* hash1,
+    uint64_t* hash2) {
+  constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+  constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+  uint64_t h1 = 0;
+  uint64_t h2 = 0;
+  auto blocksCount = size / 16;
+  for (size_t i = 0; i < blocksCount; i++) {
+    uint64_t k1;
+    uint64_t k2;
+    std::memcpy(&k1, data + i * 16, sizeof(k1));
+    std::memcpy(&k2, data + i * 16 + 8, sizeof(k2));
+    h1 ^= rotateLeft(k1 * c1, 31) * c2;
+    h1 = (rotateLeft(h1, 27) + h2) * 5 + 0x52dce729;
+    h2 ^= rotateLeft(k2 * c2, 33) * c1;
+    h2 = (rotateLeft(h2, 31) + h1) * 5 + 0x38495ab5;
+  }
+  auto tail = data + blocksCount * 16;
+  auto tailSize = size % 16;
+  uint64_t k1 = 0;
+  uint64_t k2 = 0;
+  for (size_t i = 8; i < tailSize; i++) {
+    k2 ^= uint64_t(tail[i]) << ((i - 8) * 8);
+  }
+  if (tailSize > 8) {
+    h2 ^= rotateLeft(k2 * c2, 33) * c1;
+  }
+  for (size_t i = 0; i < tailSize && i < 8; i++) {
+    k1 ^= uint64_t(tail[i]) << (i * 8);
+  }
+  if (tailSize > 0) {
+    h1 ^= rotateLeft(k1 * c1, 31) * c2;
+  }
+  h1 ^= size;
+  h2 ^= size;
+  h1 += h2;
+  h2 += h1;
+  h1 = mixFinal(h1);
+  h2 = mixFinal(h2);
+  h1 += h2;
+  h2 += h1;
+  *hash1 = h1;
+  *hash2 = h2;
+}
+
+std::string ImageDiskCache::hash(uint8_t const* data, size_t size) {
+  uint64_t hash1 = 0;
+  uint64_t hash2 = 0;
+  murmurHash3(data, size, &hash1, &hash2);
+  char result[33];
+  std::snprintf(
+      result, sizeof(result), "%016" PRIx64 "%016" PRIx64, hash1, hash2);
+  return result;
+}
+
+std::string ImageDiskCache::getKey(std::string const& uri) {
+  return hash(reinterpret_cast<uint8_t const*>(uri.data()), uri.size());
+}
+
+bool ImageDiskCache::contains(std::string const& uri) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  maybeLoadEntries();
+  return m_entryByKey.count(getKey(uri)) > 0;
+}
+
+std::optional<std::string> ImageDiskCache::getPath(std::string const& uri) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  maybeLoadEntries();
+  auto it = m_entryByKey.find(getKey(uri));
+  if (it == m_entryByKey.end()) {
+    return std::nullopt;
+  }
+  return it->second.path.string();
+}
+
+std::optional<std::vector<uint8_t>> ImageDiskCache::read(
+    std::string const& uri) {
+  auto key = getKey(uri);
+  Entry entry;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    maybeLoadEntries();
+    auto it = m_entryByKey.find(key);
+    if (it == m_entryByKey.end()) {
+      return std::nullopt;
+    }
+    it->second.lastUsedTime = fs::file_time_type::clock::now();
+    entry = it->second;
+  }
+  // the file is read without holding the lock, so that workers don't wait for
+  // each other
+  std::ifstream file(entry.path, std::ios::binary);
+  std::vector<uint8_t> data(entry.size);
+  file.read(reinterpret_cast<char*>(data.data()), data.size());
+  if (!file || hash(data.data(), data.size()) != entry.contentHash) {
+    LOG(WARNING) << "Removing corrupted image cache entry: " << entry.path;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entryByKey.find(key);
+    // the entry may have been replaced in the meantime
+    if (it != m_entryByKey.end() && it->second.path == entry.path) {
+      removeEntry(key);
+    }
+    return std::nullopt;
+  }
+  // the modification time is used to find least recently used entries after
+  // a restart
+  std::error_code ec;
+  fs::last_write_time(entry.path, fs::file_time_type::clock::now(), ec);
+  return data;
+}
+
+std::optional<std::string> ImageDiskCache::store(
+    std::string const& uri,
+    std::vector<uint8_t> const& data) {
+  auto key = getKey(uri);
+  auto contentHash = hash(data.data(), data.size());
+  auto path = fs::path(m_dirPath) / (key + "." + contentHash + ENTRY_EXTENSION);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  maybeLoadEntries();
+  removeEntry(key);
+  std::error_code ec;
+  fs::create_directories(m_dirPath, ec);
+  // the entry is written under a temporary name, so that a partially written
+  // file is never read
+  auto tmpPath = path.string() + ".tmp";
+  {
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<char const*>(data.data()), data.size());
+    if (!file) {
+      LOG(ERROR) << "Couldn't write image cache entry: " << tmpPath;
+      fs::remove(tmpPath, ec);
+      return std::nullopt;
+    }
+  }
+  fs::rename(tmpPath, path, ec);
+  if (ec) {
+    LOG(ERROR) << "Couldn't store image cache entry: " << ec.message();
+    fs::remove(tmpPath, ec);
+    return std::nullopt;
+  }
+  m_entryByKey[key] = {
+      .path = path,
+      .contentHash = std::move(contentHash),
+      .size = data.size(),
+      .lastUsedTime = fs::file_time_type::clock::now()};
+  m_sizeInBytes += data.size();
+  trim();
+  if (m_entryByKey.count(key) == 0) {
+    return std::nullopt;
+  }
+  return path.string();
+}
+
+void ImageDiskCache::remove(std::string const& uri) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  maybeLoadEntries();
+  removeEntry(getKey(uri));
+}
+
+void ImageDiskCache::maybeLoadEntries() {
+  if (m_areEntriesLoaded) {
+    return;
+  }
+  m_areEntriesLoaded = true;
+  std::error_code ec;
+  for (auto const& dirEntry : fs::directory_iterator(m_dirPath, ec)) {
+    auto fileName = dirEntry.path().filename().string();
+    // <key>.<contentHash>.img
+    auto separatorPosition = fileName.find('.');
+    if (fileName.size() <= ENTRY_EXTENSION.size() ||
+        fileName.compare(
+            fileName.size() - ENTRY_EXTENSION.size(),
+            ENTRY_EXTENSION.size(),
+            ENTRY_EXTENSION) != 0 ||
+        separatorPosition == std::string::npos) {
+      // e.g. a temporary file left after a crash
+      fs::remove(dirEntry.path(), ec);
+      continue;
+    }
+    auto key = fileName.substr(0, separatorPosition);
+    auto contentHash = fileName.substr(
+        separatorPosition + 1,
+        fileName.size() - separatorPosition - 1 - ENTRY_EXTENSION.size());
+    Entry entry = {
+        .path = dirEntry.path(),
+        .contentHash = std::move(contentHash),
+        .size = dirEntry.file_size(ec),
+        .lastUsedTime = dirEntry.last_write_time(ec)};
+    m_sizeInBytes += entry.size;
+    m_entryByKey.emplace(std::move(key), std::move(entry));
+  }
+  trim();
+}
+
+void ImageDiskCache::removeEntry(std::string const& key) {
+  auto it = m_entryByKey.find(key);
+  if (it == m_entryByKey.end()) {
+    return;
+  }
+  std::error_code ec;
+  fs::remove(it->second.path, ec);
+  m_sizeInBytes -= it->second.size;
+  m_entryByKey.erase(it);
+}
+
+void ImageDiskCache::trim() {
+  if (m_sizeInBytes <= m_maxSizeInBytes) {
+    return;
+  }
+  std::vector<std::pair<fs::file_time_type, std::string>> keysByLastUsedTime;
+  keysByLastUsedTime.reserve(m_entryByKey.size());
+  for (auto const& [key, entry] : m_entryByKey) {
+    keysByLastUsedTime.emplace_back(entry.lastUsedTime, key);
+  }
+  std::sort(keysByLastUsedTime.begin(), keysByLastUsedTime.end());
+  for (auto const& [lastUsedTime, key] : keysByLastUsedTime) {
+    if (m_sizeInBytes <= m_maxSizeInBytes) {
+      break;
+    }
+    removeEntry(key);
+  }
+}
+
+} // namespace rnoh
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * Thread-safe on-disk cache of encoded images. Entry files are named after the
+ * hash of the URI and the hash of the content. The content hash is verified
+ * when an entry is read, so a corrupted entry is removed instead of being
+ * decoded. When the cache grows over its size limit, least recently used
+ * entries are removed.
+ */
+class ImageDiskCache {
+ public:
+  using Shared = std::shared_ptr<ImageDiskCache>;
+
+  ImageDiskCache(std::string dirPath, size_t maxSizeInBytes);
+
+  ImageDiskCache(ImageDiskCache const&) = delete;
+  ImageDiskCache& operator=(ImageDiskCache const&) = delete;
+
+  bool contains(std::string const& uri);
+
+  /**
+   * Returns the path of the entry, if the URI is cached.
+   */
+  std::optional<std::string> getPath(std::string const& uri);
+
+  std::optional<std::vector<uint8_t>> read(std::string const& uri);
+
+  /**
+   * Returns the path of the stored entry, or nullopt if it couldn't be
+   * written.
+   */
+  std::optional<std::string> store(
+      std::string const& uri,
+      std::vector<uint8_t> const& data);
+
+  void remove(std::string const& uri);
+
+ private:
+  struct Entry {
+    std::filesystem::path path;
+    std::string contentHash;
+    uintmax_t size;
+    std::filesystem::file_time_type lastUsedTime;
+  };
+
+  static std::string hash(uint8_t const* data, size_t size);
+  static std::string getKey(std::string const& uri);
+
+  /**
+   * The directory is scanned on first use, so that creating the cache doesn't
+   * block the thread.
+   */
+  void maybeLoadEntries();
+  void removeEntry(std::string const& key);
+  void trim();
+
+  std::string m_dirPath;
+  size_t m_maxSizeInBytes;
+  uintmax_t m_sizeInBytes = 0;
+  bool m_areEntriesLoaded = false;
+  std::unordered_map<std::string, Entry> m_entryByKey;
+  std::mutex m_mutex;
+};
+
+} // namespace rnoh
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rnoh {
+
+class ImageFetcher {
+ public:
+  using Shared = std::shared_ptr<ImageFetcher>;
+
+  virtual ~ImageFetcher() = default;
+
+  virtual bool canFetch(std::string const& uri) const = 0;
+
+  /**
+   * Called on ImageLoader's worker threads, so it may block. Throws RNOHError
+   * if the data can't be fetched.
+   */
+  virtual std::vector<uint8_t> fetch(std::string const& uri) = 0;
+
+  /**
+   * Local files don't need to be copied to the disk cache.
+   */
+  virtual bool shouldCacheOnDisk() const {
+    return true;
+  }
+};
+
+} // namespace rnoh
@@ -0,0 +1,425 @@
+#include "RNOH/ImageLoader/ImageLoader.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <optional>
+#include "RNOH/RNOHError.h"
+
+namespace rnoh {
+
+std::shared_ptr<ImageLoader> ImageLoader::instance = nullptr;
+
+void ImageLoader::initializeInstance(ImageLoader::Shared imageLoader) {
+  // the instance is read on the main and JS threads
+  auto previousInstance = std::atomic_exchange(&instance, imageLoader);
+  if (previousInstance != nullptr) {
+    stopInBackground(std::move(previousInstance));
+  }
+}
+
+void ImageLoader::destroyInstance() {
+  initializeInstance(nullptr);
+}
+
+ImageLoader::Shared ImageLoader::getInstance() {
+  return std::atomic_load(&instance);
+}
+
+void ImageLoader::stopInBackground(ImageLoader::Shared imageLoader) {
+  {
+    std::lock_guard<std::mutex> lock(imageLoader->m_mutex);
+    imageLoader->m_isStopped = true;
+    // running jobs finish without calling back, pending ones are skipped
+    for (auto& [uri, job] : imageLoader->m_jobByUri) {
+      job.listeners.clear();
+    }
+    imageLoader->m_uriByRequestId.clear();
+  }
+  imageLoader->m_cv.notify_all();
+  // workers may be in the middle of a fetch, so they are joined on another
+  // thread instead of blocking the caller, e.g. the UI thread
+  std::thread([imageLoader = std::move(imageLoader)] {
+    imageLoader->stop();
+  }).detach();
+}
+
+ImageLoader::ImageLoader(
+    std::vector<ImageFetcher::Shared> fetchers,
+    ImageDecoder::Shared decoder,
+    size_t memoryCacheMaxSizeInBytes,
+    ImageDiskCache::Shared diskCache,
+    size_t workersCount)
+    : m_fetchers(std::move(fetchers)),
+      m_decoder(std::move(decoder)),
+      m_memoryCache(memoryCacheMaxSizeInBytes),
+      m_diskCache(std::move(diskCache)),
+      m_maxRunningLowPriorityJobsCount(std::max<size_t>(1, workersCount / 2)) {
+  for (size_t i = 0; i < workersCount; i++) {
+    m_workers.emplace_back([this] { runWorker(); });
+  }
+}
+
+ImageLoader::~ImageLoader() {
+  stop();
+}
+
+void ImageLoader::stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopped = true;
+  }
+  m_cv.notify_all();
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+  m_workers.clear();
+}
+
+bool ImageLoader::canLoad(std::string const& uri) const {
+  return getFetcher(uri) != nullptr;
+}
+
+ImageLoader::RequestId ImageLoader::loadImage(
+    std::string const& uri,
+    std::optional<ImageDecodeTarget> const& target,
+    Priority priority,
+    OnLoad onLoad,
+    OnError onError) {
+  // bucketing lets images of similar sizes share a decoded bitmap
+  std::optional<ImageDecodeTarget> bucketedTarget;
+  if (target.has_value()) {
+    bucketedTarget = target->getBucketed();
+  }
+  if (auto decodedImage = m_memoryCache.get(uri, getVariant(bucketedTarget))) {
+    onLoad({.decodedImage = std::move(decodedImage), .uri = uri});
+    return 0;
+  }
+  return enqueueRequest(
+      uri,
+      {.shouldDecode = true,
+       .target = std::move(bucketedTarget),
+       .priority = priority,
+       .onLoad = std::move(onLoad),
+       .onError = std::move(onError)});
+}
+
+ImageLoader::RequestId ImageLoader::prefetchImage(
+    std::string const& uri,
+    OnLoad onLoad,
+    OnError onError) {
+  return enqueueRequest(
+      uri,
+      {.shouldDecode = false,
+       .priority = Priority::LOW,
+       .onLoad = std::move(onLoad),
+       .onError = std::move(onError)});
+}
+
+void ImageLoader::setRequestPriority(RequestId requestId, Priority priority) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto uriIt = m_uriByRequestId.find(requestId);
+  if (uriIt == m_uriByRequestId.end()) {
+    return;
+  }
+  auto jobIt = m_jobByUri.find(uriIt->second);
+  if (jobIt == m_jobByUri.end()) {
+    return;
+  }
+  auto& job = jobIt->second;
+  for (auto& listener : job.listeners) {
+    if (listener.requestId == requestId) {
+      listener.priority = priority;
+    }
+  }
+  updateJobPriority(jobIt->first, job);
+}
+
+void ImageLoader::cancelRequest(RequestId requestId) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto uriIt = m_uriByRequestId.find(requestId);
+  if (uriIt == m_uriByRequestId.end()) {
+    return;
+  }
+  auto jobIt = m_jobByUri.find(uriIt->second);
+  m_uriByRequestId.erase(uriIt);
+  if (jobIt == m_jobByUri.end()) {
+    return;
+  }
+  auto& job = jobIt->second;
+  job.listeners.erase(
+      std::remove_if(
+          job.listeners.begin(),
+          job.listeners.end(),
+          [requestId](auto const& listener) {
+            return listener.requestId == requestId;
+          }),
+      job.listeners.end());
+  // a running job is finished, so that its result is cached; a pending one is
+  // skipped by the workers
+  if (job.listeners.empty() && !job.isRunning) {
+    m_jobByUri.erase(jobIt);
+    return;
+  }
+  updateJobPriority(jobIt->first, job);
+}
+
+ImageLoader::CacheLocation ImageLoader::queryCache(std::string const& uri) {
+  if (m_memoryCache.contains(uri)) {
+    return CacheLocation::MEMORY;
+  }
+  if (m_diskCache != nullptr && m_diskCache->contains(uri)) {
+    return CacheLocation::DISK;
+  }
+  return CacheLocation::NONE;
+}
+
+ImageLoader::Stats ImageLoader::getStats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+std::string ImageLoader::getStatsJSON() const {
+  auto stats = getStats();
+  return "{\"decodedImagesCount\":" +
+      std::to_string(stats.decodedImagesCount) +
+      ",\"downsampledImagesCount\":" +
+      std::to_string(stats.downsampledImagesCount) +
+      ",\"savedBytesCount\":" + std::to_string(stats.savedBytesCount) + "}";
+}
+
+std::string ImageLoader::getVariant(
+    std::optional<ImageDecodeTarget> const& target) {
+  return target.has_value() ? target->getCacheKey() : "source";
+}
+
+ImageLoader::RequestId ImageLoader::enqueueRequest(
+    std::string const& uri,
+    Listener listener) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto requestId = m_nextRequestId++;
+  auto [it, isNewJob] = m_jobByUri.try_emplace(uri);
+  auto& job = it->second;
+  listener.requestId = requestId;
+  job.listeners.push_back(std::move(listener));
+  m_uriByRequestId.emplace(requestId, uri);
+  if (isNewJob) {
+    job.priority = job.listeners.back().priority;
+    getPendingUris(job.priority).push_back(uri);
+    m_cv.notify_one();
+  } else {
+    updateJobPriority(uri, job);
+  }
+  return requestId;
+}
+
+void ImageLoader::updateJobPriority(std::string const& uri, Job& job) {
+  if (job.isRunning || job.listeners.empty()) {
+    return;
+  }
+  auto priority = Priority::LOW;
+  for (auto const& listener : job.listeners) {
+    if (listener.priority == Priority::HIGH) {
+      priority = Priority::HIGH;
+      break;
+    }
+  }
+  if (priority == job.priority) {
+    return;
+  }
+  job.priority = priority;
+  getPendingUris(priority).push_back(uri);
+  m_cv.notify_one();
+}
+
+std::deque<std::string>& ImageLoader::getPendingUris(Priority priority) {
+  return priority == Priority::HIGH ? m_highPriorityPendingUris
+                                    : m_lowPriorityPendingUris;
+}
+
+std::optional<std::string> ImageLoader::takeNextPendingUri(
+    Priority& priority) {
+  for (auto candidatePriority : {Priority::HIGH, Priority::LOW}) {
+    if (candidatePriority == Priority::LOW &&
+        m_runningLowPriorityJobsCount >= m_maxRunningLowPriorityJobsCount) {
+      break;
+    }
+    auto& pendingUris = getPendingUris(candidatePriority);
+    while (!pendingUris.empty()) {
+      auto uri = std::move(pendingUris.front());
+      pendingUris.pop_front();
+      auto it = m_jobByUri.find(uri);
+      // the job was cancelled, it's queued with another priority, or it's
+      // already running if it was cancelled and requested again
+      if (it == m_jobByUri.end() || it->second.isRunning ||
+          it->second.priority != candidatePriority) {
+        continue;
+      }
+      it->second.isRunning = true;
+      priority = candidatePriority;
+      return uri;
+    }
+  }
+  return std::nullopt;
+}
+
+void ImageLoader::runWorker() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    if (m_isStopped) {
+      return;
+    }
+    auto priority = Priority::LOW;
+    auto uri = takeNextPendingUri(priority);
+    if (!uri.has_value()) {
+      m_cv.wait(lock);
+      continue;
+    }
+    if (priority == Priority::LOW) {
+      m_runningLowPriorityJobsCount++;
+    }
+    lock.unlock();
+    runJob(uri.value());
+    lock.lock();
+    if (priority == Priority::LOW) {
+      m_runningLowPriorityJobsCount--;
+    }
+  }
+}
+
+void ImageLoader::runJob(std::string const& uri) {
+  std::string localUri;
+  std::vector<uint8_t> data;
+  std::optional<std::string> fetchErrorMessage;
+  try {
+    data = fetchData(uri, localUri);
+  } catch (RNOHError const& e) {
+    fetchErrorMessage = e.getMessage();
+  } catch (std::exception const& e) {
+    fetchErrorMessage = e.what();
+  }
+
+  // listeners may join the job while it's running, so the targets to decode
+  // are checked again after each decode; a target which failed to decode
+  // fails only the listeners which requested it
+  std::unordered_map<std::string, DecodedImage::Shared> decodedImageByVariant;
+  std::unordered_map<std::string, std::string> errorMessageByVariant;
+  std::vector<Listener> listeners;
+  while (true) {
+    std::optional<std::optional<ImageDecodeTarget>> nextTarget;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_jobByUri.find(uri);
+      if (!fetchErrorMessage.has_value()) {
+        for (auto const& listener : it->second.listeners) {
+          auto variant = getVariant(listener.target);
+          if (listener.shouldDecode &&
+              decodedImageByVariant.count(variant) == 0 &&
+              errorMessageByVariant.count(variant) == 0) {
+            nextTarget = listener.target;
+            break;
+          }
+        }
+      }
+      if (!nextTarget.has_value()) {
+        listeners = std::move(it->second.listeners);
+        m_jobByUri.erase(it);
+        for (auto const& listener : listeners) {
+          m_uriByRequestId.erase(listener.requestId);
+        }
+        break;
+      }
+    }
+    auto const& target = nextTarget.value();
+    auto variant = getVariant(target);
+    try {
+      DecodedImage::Shared decodedImage;
+      if (m_decoder != nullptr) {
+        decodedImage = m_decoder->decode(data, target);
+      }
+      m_memoryCache.put(uri, variant, decodedImage);
+      updateStats(decodedImage);
+      decodedImageByVariant.emplace(variant, decodedImage);
+    } catch (RNOHError const& e) {
+      errorMessageByVariant.emplace(variant, e.getMessage());
+    } catch (std::exception const& e) {
+      errorMessageByVariant.emplace(variant, e.what());
+    }
+  }
+
+  for (auto const& listener : listeners) {
+    try {
+      if (fetchErrorMessage.has_value()) {
+        listener.onError(fetchErrorMessage.value());
+        continue;
+      }
+      Image image{.uri = localUri};
+      if (listener.shouldDecode) {
+        auto variant = getVariant(listener.target);
+        auto errorIt = errorMessageByVariant.find(variant);
+        if (errorIt != errorMessageByVariant.end()) {
+          listener.onError(errorIt->second);
+          continue;
+        }
+        image.decodedImage = decodedImageByVariant.at(variant);
+      }
+      listener.onLoad(image);
+    } catch (std::exception const& e) {
+      LOG(ERROR) << "Image loader callback failed: " << e.what();
+    }
+  }
+}
+
+void ImageLoader::updateStats(DecodedImage::Shared const& image) {
+  if (image == nullptr) {
+    return;
+  }
+  size_t pixelsCount = size_t(image->getWidth()) * image->getHeight();
+  size_t sourcePixelsCount =
+      size_t(image->getSourceWidth()) * image->getSourceHeight();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats.decodedImagesCount++;
+  if (pixelsCount == 0 || pixelsCount >= sourcePixelsCount) {
+    return;
+  }
+  m_stats.downsampledImagesCount++;
+  // estimated from the bytes per pixel of the decoded bitmap
+  auto sourceByteSize = static_cast<size_t>(
+      double(image->getByteSize()) * sourcePixelsCount / pixelsCount);
+  m_stats.savedBytesCount += sourceByteSize - image->getByteSize();
+}
+
+std::vector<uint8_t> ImageLoader::fetchData(
+    std::string const& uri,
+    std::string& localUri) {
+  if (m_diskCache != nullptr) {
+    auto path = m_diskCache->getPath(uri);
+    if (path.has_value()) {
+      if (auto data = m_diskCache->read(uri)) {
+        localUri = "file://" + path.value();
+        return std::move(data.value());
+      }
+    }
+  }
+  auto fetcher = getFetcher(uri);
+  if (fetcher == nullptr) {
+    throw RNOHError("Unsupported image URI: " + uri);
+  }
+  auto data = fetcher->fetch(uri);
+  localUri = uri;
+  if (m_diskCache != nullptr && fetcher->shouldCacheOnDisk()) {
+    if (auto path = m_diskCache->store(uri, data)) {
+      localUri = "file://" + path.value();
+    }
+  }
+  return data;
+}
+
+ImageFetcher::Shared ImageLoader::getFetcher(std::string const& uri) const {
+  for (auto const& fetcher : m_fetchers) {
+    if (fetcher->canFetch(uri)) {
+      return fetcher;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace rnoh
@@ -0,0 +1,198 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "RNOH/ImageLoader/ImageDecoder.h"
+#include "RNOH/ImageLoader/ImageDiskCache.h"
+#include "RNOH/ImageLoader/ImageFetcher.h"
+#include "RNOH/ImageLoader/ImageMemoryCache.h"
+
+namespace rnoh {
+
+/**
+ * Used only in C-API based Architecture.
+ *
+ * Loads images on a pool of worker threads. Decoded images are kept in a
+ * memory cache and fetched data is kept in a disk cache. Concurrent requests
+ * for the same URI share a single fetch. Images are decoded at the size they
+ * are displayed at, and each bucketed target size is cached separately.
+ * Prefetching stores the image in the disk cache without decoding it.
+ *
+ * High priority jobs run first. Low priority jobs occupy at most half of the
+ * workers, so that a high priority request never waits for all of them.
+ */
+class ImageLoader {
+  static std::shared_ptr<ImageLoader> instance;
+
+ public:
+  using Shared = std::shared_ptr<ImageLoader>;
+  using RequestId = uint64_t;
+
+  struct Image {
+    /**
+     * nullptr if the image should be displayed from `uri`, e.g. an animated
+     * image.
+     */
+    DecodedImage::Shared decodedImage;
+    /**
+     * Local copy of the image if it's cached on disk, otherwise the source
+     * URI.
+     */
+    std::string uri;
+  };
+
+  using OnLoad = std::function<void(Image const& image)>;
+  using OnError = std::function<void(std::string const& errorMessage)>;
+
+  enum class CacheLocation { NONE, MEMORY, DISK };
+
+  /**
+   * E.g. visible images are loaded with a high priority, and images scrolled
+   * out of view or prefetched ones with a low priority.
+   */
+  enum class Priority { LOW, HIGH };
+
+  struct Stats {
+    size_t decodedImagesCount = 0;
+    size_t downsampledImagesCount = 0;
+    /**
+     * Memory saved by decoding images below their source size.
+     */
+    size_t savedBytesCount = 0;
+  };
+
+  /**
+   * The loader with platform fetchers and decoder is created by
+   * `createPlatformImageLoader`.
+   */
+  static void initializeInstance(ImageLoader::Shared imageLoader);
+
+  /**
+   * Stops the loader, so that its workers aren't joined during static
+   * destruction, when the state they use may already be destroyed. Doesn't
+   * wait for running jobs, and their callbacks aren't called. Also applies
+   * to the previous loader replaced by `initializeInstance`.
+   */
+  static void destroyInstance();
+
+  /**
+   * Returns nullptr if the loader wasn't initialized or was destroyed.
+   */
+  static ImageLoader::Shared getInstance();
+
+  /**
+   * `decoder` and `diskCache` may be nullptr.
+   */
+  ImageLoader(
+      std::vector<ImageFetcher::Shared> fetchers,
+      ImageDecoder::Shared decoder,
+      size_t memoryCacheMaxSizeInBytes,
+      ImageDiskCache::Shared diskCache,
+      size_t workersCount);
+  ~ImageLoader();
+
+  ImageLoader(ImageLoader const&) = delete;
+  ImageLoader& operator=(ImageLoader const&) = delete;
+
+  /**
+   * Waits for the running jobs and stops the workers. Callbacks of pending
+   * requests aren't called, and requests made afterwards are never loaded.
+   * Mustn't be called from a callback.
+   */
+  void stop();
+
+  bool canLoad(std::string const& uri) const;
+
+  /**
+   * Without a target, the image is decoded at its source size. Callbacks are
+   * called on a worker thread, or synchronously if the image is in the memory
+   * cache.
+   */
+  RequestId loadImage(
+      std::string const& uri,
+      std::optional<ImageDecodeTarget> const& target,
+      Priority priority,
+      OnLoad onLoad,
+      OnError onError);
+
+  /**
+   * Prefetch requests have a low priority.
+   */
+  RequestId
+  prefetchImage(std::string const& uri, OnLoad onLoad, OnError onError);
+
+  /**
+   * A job shared by several requests runs with the highest of their
+   * priorities. Has no effect once the job is running.
+   */
+  void setRequestPriority(RequestId requestId, Priority priority);
+
+  /**
+   * Callbacks of the request won't be called. The image is fetched anyway if
+   * another request waits for it.
+   */
+  void cancelRequest(RequestId requestId);
+
+  CacheLocation queryCache(std::string const& uri);
+
+  Stats getStats() const;
+  std::string getStatsJSON() const;
+
+ private:
+  struct Listener {
+    RequestId requestId;
+    bool shouldDecode;
+    std::optional<ImageDecodeTarget> target;
+    Priority priority;
+    OnLoad onLoad;
+    OnError onError;
+  };
+
+  struct Job {
+    bool isRunning = false;
+    Priority priority = Priority::LOW;
+    std::vector<Listener> listeners;
+  };
+
+  static std::string getVariant(std::optional<ImageDecodeTarget> const& target);
+  static void stopInBackground(ImageLoader::Shared imageLoader);
+
+  RequestId enqueueRequest(std::string const& uri, Listener listener);
+  void updateJobPriority(std::string const& uri, Job& job);
+  std::deque<std::string>& getPendingUris(Priority priority);
+  std::optional<std::string> takeNextPendingUri(Priority& priority);
+  void runWorker();
+  void runJob(std::string const& uri);
+  void updateStats(DecodedImage::Shared const& image);
+  std::vector<uint8_t> fetchData(std::string const& uri, std::string& localUri);
+  ImageFetcher::Shared getFetcher(std::string const& uri) const;
+
+  std::vector<ImageFetcher::Shared> m_fetchers;
+  ImageDecoder::Shared m_decoder;
+  ImageMemoryCache m_memoryCache;
+  ImageDiskCache::Shared m_diskCache;
+
+  RequestId m_nextRequestId = 1;
+  std::unordered_map<std::string, Job> m_jobByUri;
+  std::unordered_map<RequestId, std::string> m_uriByRequestId;
+  // a URI is queued again when the priority of its pending job changes;
+  // outdated entries are skipped
+  std::deque<std::string> m_highPriorityPendingUris;
+  std::deque<std::string> m_lowPriorityPendingUris;
+  size_t m_runningLowPriorityJobsCount = 0;
+  size_t m_maxRunningLowPriorityJobsCount;
+  bool m_isStopped = false;
+  Stats m_stats;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<std::thread> m_workers;
+};
+
+} // namespace rnoh
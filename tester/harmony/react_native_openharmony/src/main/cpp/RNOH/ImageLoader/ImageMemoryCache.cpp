@@ -0,0 +1,91 @@
+#include "RNOH/ImageLoader/ImageMemoryCache.h"
+#include <iterator>
+
+namespace rnoh {
+
+ImageMemoryCache::ImageMemoryCache(size_t maxSizeInBytes)
+    : m_maxSizeInBytes(maxSizeInBytes) {}
+
+std::string ImageMemoryCache::getKey(
+    std::string const& uri,
+    std::string const& variant) {
+  // URIs can't contain whitespace, so the key is unambiguous
+  return uri + " " + variant;
+}
+
+DecodedImage::Shared ImageMemoryCache::get(
+    std::string const& uri,
+    std::string const& variant) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entryByKey.find(getKey(uri, variant));
+  if (it == m_entryByKey.end()) {
+    return nullptr;
+  }
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  return it->second->image;
+}
+
+void ImageMemoryCache::put(
+    std::string const& uri,
+    std::string const& variant,
+    DecodedImage::Shared image) {
+  if (image == nullptr) {
+    return;
+  }
+  auto key = getKey(uri, variant);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entryByKey.find(key);
+  if (it != m_entryByKey.end()) {
+    removeEntry(it->second);
+  }
+  if (image->getByteSize() > m_maxSizeInBytes) {
+    return;
+  }
+  m_sizeInBytes += image->getByteSize();
+  m_entries.push_front({.uri = uri, .key = key, .image = std::move(image)});
+  m_entryByKey.emplace(std::move(key), m_entries.begin());
+  m_variantsCountByUri[uri]++;
+  trim();
+}
+
+void ImageMemoryCache::remove(std::string const& uri) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_variantsCountByUri.count(uri) == 0) {
+    return;
+  }
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    auto next = std::next(it);
+    if (it->uri == uri) {
+      removeEntry(it);
+    }
+    it = next;
+  }
+}
+
+bool ImageMemoryCache::contains(std::string const& uri) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_variantsCountByUri.count(uri) > 0;
+}
+
+size_t ImageMemoryCache::getSizeInBytes() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_sizeInBytes;
+}
+
+void ImageMemoryCache::removeEntry(std::list<Entry>::iterator it) {
+  m_sizeInBytes -= it->image->getByteSize();
+  auto variantsCountIt = m_variantsCountByUri.find(it->uri);
+  if (--variantsCountIt->second == 0) {
+    m_variantsCountByUri.erase(variantsCountIt);
+  }
+  m_entryByKey.erase(it->key);
+  m_entries.erase(it);
+}
+
+void ImageMemoryCache::trim() {
+  while (m_sizeInBytes > m_maxSizeInBytes && !m_entries.empty()) {
+    removeEntry(std::prev(m_entries.end()));
+  }
+}
+
+} // namespace rnoh
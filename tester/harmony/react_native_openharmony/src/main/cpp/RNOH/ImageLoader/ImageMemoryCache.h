@@ -0,0 +1,62 @@
+#pragma once
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "RNOH/ImageLoader/ImageDecoder.h"
+
+namespace rnoh {
+
+/**
+ * Thread-safe LRU cache of decoded images, bounded by the size of their
+ * pixels. An image larger than the limit isn't cached. The same URI may be
+ * cached in several variants, e.g. decoded at different sizes.
+ */
+class ImageMemoryCache {
+ public:
+  explicit ImageMemoryCache(size_t maxSizeInBytes);
+
+  ImageMemoryCache(ImageMemoryCache const&) = delete;
+  ImageMemoryCache& operator=(ImageMemoryCache const&) = delete;
+
+  /**
+   * Returns nullptr on a cache miss.
+   */
+  DecodedImage::Shared get(std::string const& uri, std::string const& variant);
+  void put(
+      std::string const& uri,
+      std::string const& variant,
+      DecodedImage::Shared image);
+  /**
+   * Removes all variants of the URI.
+   */
+  void remove(std::string const& uri);
+  /**
+   * Whether any variant of the URI is cached.
+   */
+  bool contains(std::string const& uri) const;
+
+  size_t getSizeInBytes() const;
+
+ private:
+  struct Entry {
+    std::string uri;
+    std::string key;
+    DecodedImage::Shared image;
+  };
+
+  static std::string getKey(std::string const& uri, std::string const& variant);
+
+  void removeEntry(std::list<Entry>::iterator it);
+  void trim();
+
+  size_t m_maxSizeInBytes;
+  size_t m_sizeInBytes = 0;
+  // most recently used entries are at the front
+  std::list<Entry> m_entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> m_entryByKey;
+  std::unordered_map<std::string, size_t> m_variantsCountByUri;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace rnoh
@@ -0,0 +1,88 @@
+#include "RNOH/ImageLoader/PixelMapImageDecoder.h"
+#include "RNOH/RNOHError.h"
+#ifdef C_API_ARCH
+#include <multimedia/image_framework/image/image_source_native.h>
+#include <multimedia/image_framework/image/pixelmap_native.h>
+#endif
+
+namespace rnoh {
+
+PixelMapImage::PixelMapImage(
+    OH_PixelmapNative* pixelMap,
+    DecodeSize size,
+    DecodeSize sourceSize,
+    size_t byteSize)
+    : m_pixelMap(pixelMap),
+      m_size(size),
+      m_sourceSize(sourceSize),
+      m_byteSize(byteSize) {}
+
+PixelMapImage::~PixelMapImage() {
+#ifdef C_API_ARCH
+  OH_PixelmapNative_Release(m_pixelMap);
+#endif
+}
+
+DecodedImage::Shared PixelMapImageDecoder::decode(
+    std::vector<uint8_t> const& data,
+    std::optional<ImageDecodeTarget> const& target) {
+#ifdef C_API_ARCH
+  OH_ImageSourceNative* imageSource = nullptr;
+  // the data isn't modified, but the API takes a non-const pointer
+  auto errorCode = OH_ImageSourceNative_CreateFromData(
+      const_cast<uint8_t*>(data.data()), data.size(), &imageSource);
+  if (errorCode != IMAGE_SUCCESS || imageSource == nullptr) {
+    throw RNOHError(
+        "Couldn't create an image source, error code: " +
+        std::to_string(errorCode));
+  }
+  uint32_t frameCount = 0;
+  OH_ImageSourceNative_GetFrameCount(imageSource, &frameCount);
+  if (frameCount > 1) {
+    // a PixelMap would show only the first frame of an animated image
+    OH_ImageSourceNative_Release(imageSource);
+    return nullptr;
+  }
+  OH_ImageSource_Info* sourceInfo = nullptr;
+  OH_ImageSourceInfo_Create(&sourceInfo);
+  OH_ImageSourceNative_GetImageInfo(imageSource, 0, sourceInfo);
+  DecodeSize sourceSize = {.width = 0, .height = 0};
+  OH_ImageSourceInfo_GetWidth(sourceInfo, &sourceSize.width);
+  OH_ImageSourceInfo_GetHeight(sourceInfo, &sourceSize.height);
+  OH_ImageSourceInfo_Release(sourceInfo);
+  OH_DecodingOptions* options = nullptr;
+  OH_DecodingOptions_Create(&options);
+  if (target.has_value()) {
+    auto decodeSize =
+        target->getDecodeSize(sourceSize.width, sourceSize.height);
+    Image_Size desiredSize = {
+        .width = decodeSize.width, .height = decodeSize.height};
+    OH_DecodingOptions_SetDesiredSize(options, &desiredSize);
+  }
+  OH_PixelmapNative* pixelMap = nullptr;
+  errorCode =
+      OH_ImageSourceNative_CreatePixelmap(imageSource, options, &pixelMap);
+  OH_DecodingOptions_Release(options);
+  OH_ImageSourceNative_Release(imageSource);
+  if (errorCode != IMAGE_SUCCESS || pixelMap == nullptr) {
+    throw RNOHError(
+        "Couldn't decode the image, error code: " + std::to_string(errorCode));
+  }
+  OH_Pixelmap_ImageInfo* imageInfo = nullptr;
+  OH_PixelmapImageInfo_Create(&imageInfo);
+  OH_PixelmapNative_GetImageInfo(pixelMap, imageInfo);
+  DecodeSize size = {.width = 0, .height = 0};
+  uint32_t rowStride = 0;
+  OH_PixelmapImageInfo_GetWidth(imageInfo, &size.width);
+  OH_PixelmapImageInfo_GetHeight(imageInfo, &size.height);
+  OH_PixelmapImageInfo_GetRowStride(imageInfo, &rowStride);
+  OH_PixelmapImageInfo_Release(imageInfo);
+  return std::make_shared<PixelMapImage>(
+      pixelMap, size, sourceSize, static_cast<size_t>(rowStride) * size.height);
+#else
+  throw RNOHError(
+      "PixelMapImageDecoder is only available in C-API architecture");
+#endif
+}
+
+} // namespace rnoh
@@ -0,0 +1,61 @@
+#pragma once
+#include "RNOH/ImageLoader/ImageDecoder.h"
+
+struct OH_PixelmapNative;
+
+namespace rnoh {
+
+class PixelMapImage : public DecodedImage {
+ public:
+  PixelMapImage(
+      OH_PixelmapNative* pixelMap,
+      DecodeSize size,
+      DecodeSize sourceSize,
+      size_t byteSize);
+  ~PixelMapImage() override;
+
+  PixelMapImage(PixelMapImage const&) = delete;
+  PixelMapImage& operator=(PixelMapImage const&) = delete;
+
+  uint32_t getWidth() const override {
+    return m_size.width;
+  }
+
+  uint32_t getHeight() const override {
+    return m_size.height;
+  }
+
+  uint32_t getSourceWidth() const override {
+    return m_sourceSize.width;
+  }
+
+  uint32_t getSourceHeight() const override {
+    return m_sourceSize.height;
+  }
+
+  size_t getByteSize() const override {
+    return m_byteSize;
+  }
+
+  OH_PixelmapNative* getPixelMap() const {
+    return m_pixelMap;
+  }
+
+ private:
+  OH_PixelmapNative* m_pixelMap;
+  DecodeSize m_size;
+  DecodeSize m_sourceSize;
+  size_t m_byteSize;
+};
+
+/**
+ * Decodes images to PixelMaps, which can be displayed by ImageNode.
+ */
+class PixelMapImageDecoder : public ImageDecoder {
+ public:
+  DecodedImage::Shared decode(
+      std::vector<uint8_t> const& data,
+      std::optional<ImageDecodeTarget> const& target) override;
+};
+
+} // namespace rnoh
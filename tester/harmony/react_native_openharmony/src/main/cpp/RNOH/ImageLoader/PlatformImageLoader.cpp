@@ -0,0 +1,26 @@
+#include "RNOH/ImageLoader/PlatformImageLoader.h"
+#include "RNOH/ImageLoader/FileImageFetcher.h"
+#include "RNOH/ImageLoader/PixelMapImageDecoder.h"
+#include "RNOH/ImageLoader/RemoteImageFetcher.h"
+
+namespace rnoh {
+
+static constexpr size_t WORKERS_COUNT = 4;
+
+ImageLoader::Shared createPlatformImageLoader(
+    std::string diskCacheDirPath,
+    size_t diskCacheMaxSizeInBytes,
+    size_t memoryCacheMaxSizeInBytes) {
+  std::vector<ImageFetcher::Shared> fetchers = {
+      std::make_shared<FileImageFetcher>(),
+      std::make_shared<RemoteImageFetcher>()};
+  return std::make_shared<ImageLoader>(
+      std::move(fetchers),
+      std::make_shared<PixelMapImageDecoder>(),
+      memoryCacheMaxSizeInBytes,
+      std::make_shared<ImageDiskCache>(
+          std::move(diskCacheDirPath), diskCacheMaxSizeInBytes),
+      WORKERS_COUNT);
+}
+
+} // namespace rnoh
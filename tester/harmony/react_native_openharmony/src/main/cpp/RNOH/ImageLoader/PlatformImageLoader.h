@@ -0,0 +1,17 @@
+#pragma once
+#include <string>
+#include "RNOH/ImageLoader/ImageLoader.h"
+
+namespace rnoh {
+
+/**
+ * Creates an ImageLoader which reads local files, downloads remote images and
+ * decodes them with the platform's image framework. Kept apart from
+ * ImageLoader, so that the loader itself doesn't depend on platform APIs.
+ */
+ImageLoader::Shared createPlatformImageLoader(
+    std::string diskCacheDirPath,
+    size_t diskCacheMaxSizeInBytes,
+    size_t memoryCacheMaxSizeInBytes);
+
+} // namespace rnoh
@@ -0,0 +1,69 @@
+#include "RNOH/ImageLoader/RemoteImageFetcher.h"
+#include "RNOH/RNOHError.h"
+#ifdef C_API_ARCH
+#include <RemoteCommunicationKit/rcp.h>
+#endif
+
+namespace rnoh {
+
+RemoteImageFetcher::~RemoteImageFetcher() {
+#ifdef C_API_ARCH
+  if (m_session != nullptr) {
+    HMS_Rcp_CloseSession(&m_session);
+  }
+#endif
+}
+
+bool RemoteImageFetcher::canFetch(std::string const& uri) const {
+  return uri.rfind("http://", 0) == 0 || uri.rfind("https://", 0) == 0;
+}
+
+std::vector<uint8_t> RemoteImageFetcher::fetch(std::string const& uri) {
+#ifdef C_API_ARCH
+  auto session = getSession();
+  auto request = HMS_Rcp_CreateRequest(uri.c_str());
+  if (request == nullptr) {
+    throw RNOHError("Couldn't create a request for the image: " + uri);
+  }
+  uint32_t errorCode = 0;
+  auto response = HMS_Rcp_FetchSync(session, request, &errorCode);
+  HMS_Rcp_DestroyRequest(request);
+  if (response == nullptr || errorCode != 0) {
+    throw RNOHError(
+        "Failed to fetch the image: " + uri +
+        ", error code: " + std::to_string(errorCode));
+  }
+  auto statusCode = static_cast<int>(response->statusCode);
+  if (statusCode < 200 || statusCode >= 300) {
+    response->destroyResponse(response);
+    throw RNOHError(
+        "Failed to fetch the image: " + uri +
+        ", status code: " + std::to_string(statusCode));
+  }
+  auto body = reinterpret_cast<uint8_t const*>(response->body.buffer);
+  std::vector<uint8_t> data(body, body + response->body.length);
+  response->destroyResponse(response);
+  return data;
+#else
+  throw RNOHError(
+      "RemoteImageFetcher is only available in C-API architecture");
+#endif
+}
+
+Rcp_Session* RemoteImageFetcher::getSession() {
+  std::lock_guard<std::mutex> lock(m_sessionMutex);
+#ifdef C_API_ARCH
+  if (m_session == nullptr) {
+    uint32_t errorCode = 0;
+    m_session = HMS_Rcp_CreateSession(nullptr, &errorCode);
+    if (m_session == nullptr) {
+      throw RNOHError(
+          "Couldn't create an HTTP session, error code: " +
+          std::to_string(errorCode));
+    }
+  }
+#endif
+  return m_session;
+}
+
+} // namespace rnoh
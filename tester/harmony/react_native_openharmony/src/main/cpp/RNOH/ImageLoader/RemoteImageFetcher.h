@@ -0,0 +1,31 @@
+#pragma once
+#include <mutex>
+#include "RNOH/ImageLoader/ImageFetcher.h"
+
+struct Rcp_Session;
+
+namespace rnoh {
+
+/**
+ * Downloads images over HTTP(S) with Remote Communication Kit.
+ */
+class RemoteImageFetcher : public ImageFetcher {
+ public:
+  RemoteImageFetcher() = default;
+  ~RemoteImageFetcher() override;
+
+  RemoteImageFetcher(RemoteImageFetcher const&) = delete;
+  RemoteImageFetcher& operator=(RemoteImageFetcher const&) = delete;
+
+  bool canFetch(std::string const& uri) const override;
+  std::vector<uint8_t> fetch(std::string const& uri) override;
+
+ private:
+  Rcp_Session* getSession();
+
+  // requests of all workers share the session and its connections
+  Rcp_Session* m_session = nullptr;
+  std::mutex m_sessionMutex;
+};
+
+} // namespace rnoh
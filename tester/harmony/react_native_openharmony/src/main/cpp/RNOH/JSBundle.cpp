@@ -0,0 +1,170 @@
+#include "RNOH/JSBundle.h"
+#include <cxxreact/JSBundleType.h>
+#include <cxxreact/RAMBundleRegistry.h>
+#include <folly/Conv.h>
+#include <folly/lang/Bits.h>
+#include <algorithm>
+#include <cstring>
+#include <ios>
+#include <stdexcept>
+#include "RNOH/HermesCodeCache.h"
+#include "RNOH/Performance/HarmonyReactMarker.h"
+
+namespace rnoh {
+
+using namespace facebook;
+
+static react::BundleHeader readBundleHeader(react::JSBigString const& bundle) {
+  react::BundleHeader header;
+  std::memcpy(
+      &header,
+      bundle.c_str(),
+      std::min(sizeof(react::BundleHeader), bundle.size()));
+  return header;
+}
+
+static uint32_t readUInt32(const char* data) {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return folly::Endian::little(value);
+}
+
+bool isHermesBytecodeBundle(react::JSBigString const& bundle) {
+  return react::isHermesBytecodeBundle(readBundleHeader(bundle));
+}
+
+// magic number, number of modules, startup code size
+static constexpr size_t RAM_BUNDLE_HEADER_SIZE = 3 * sizeof(uint32_t);
+
+IndexedRAMBundle::Factory IndexedRAMBundle::buildFactory() {
+  return [](std::string path) -> std::unique_ptr<JSModulesUnbundle> {
+    return std::make_unique<IndexedRAMBundle>(
+        react::JSBigFileString::fromPath(path));
+  };
+}
+
+IndexedRAMBundle::IndexedRAMBundle(
+    std::unique_ptr<const react::JSBigString> bundle)
+    : m_bundle(std::move(bundle)) {
+  auto size = m_bundle->size();
+  if (size < RAM_BUNDLE_HEADER_SIZE ||
+      react::parseTypeFromHeader(readBundleHeader(*m_bundle)) !=
+          react::ScriptTag::RAMBundle) {
+    throw std::invalid_argument("Bundle is not an indexed RAM bundle");
+  }
+  auto data = m_bundle->c_str();
+  m_modulesCount = readUInt32(data + sizeof(uint32_t));
+  m_startupCodeSize = readUInt32(data + 2 * sizeof(uint32_t));
+  m_baseOffset =
+      RAM_BUNDLE_HEADER_SIZE + size_t(m_modulesCount) * sizeof(ModuleData);
+  if (m_startupCodeSize == 0 || m_baseOffset + m_startupCodeSize > size) {
+    throw std::invalid_argument("Indexed RAM bundle is truncated");
+  }
+}
+
+std::unique_ptr<const react::JSBigString> IndexedRAMBundle::getStartupCode()
+    const {
+  auto startupCode = m_bundle->c_str() + m_baseOffset;
+  auto startupCodeLength = m_startupCodeSize - 1;
+  // Metro terminates the startup section with a NUL byte, so usually it can be
+  // passed to the runtime as is
+  if (startupCode[startupCodeLength] == '\0') {
+    return std::make_unique<JSBigStringView>(
+        m_bundle, startupCode, startupCodeLength);
+  }
+  auto copy = std::make_unique<react::JSBigBufferString>(startupCodeLength);
+  std::memcpy(copy->data(), startupCode, startupCodeLength);
+  return copy;
+}
+
+IndexedRAMBundle::Module IndexedRAMBundle::getModule(uint32_t moduleId) const {
+  auto moduleData = getModuleData(moduleId);
+  // modules without code have both the offset and the length set to 0, the
+  // length includes the NUL terminator
+  if (moduleData.length == 0) {
+    throw ModuleNotFound(moduleId);
+  }
+  auto codeOffset = m_baseOffset + moduleData.offset;
+  if (codeOffset + moduleData.length > m_bundle->size()) {
+    throw std::ios_base::failure(folly::to<std::string>(
+        "Error loading module ", moduleId, " from RAM bundle"));
+  }
+  return {
+      .name = folly::to<std::string>(moduleId, ".js"),
+      .code = std::string(
+          m_bundle->c_str() + codeOffset, moduleData.length - 1)};
+}
+
+IndexedRAMBundle::ModuleData IndexedRAMBundle::getModuleData(
+    uint32_t moduleId) const {
+  if (moduleId >= m_modulesCount) {
+    throw ModuleNotFound(moduleId);
+  }
+  auto entry = m_bundle->c_str() + RAM_BUNDLE_HEADER_SIZE +
+      size_t(moduleId) * sizeof(ModuleData);
+  return {
+      .offset = readUInt32(entry),
+      .length = readUInt32(entry + sizeof(uint32_t))};
+}
+
+std::unique_ptr<const react::JSBigString> loadJSBundleFromFile(
+    std::string const& path) {
+  // the file is mapped lazily: source bundles are read from the disk by the
+  // copy below, while bytecode and RAM bundles are read by the JS engine when
+  // executed, so only the mapping is marked for them
+  HarmonyReactMarker::logMarkerStart("READ_JS_BUNDLE", path);
+  auto fileBundle = react::JSBigFileString::fromPath(path);
+  auto header = readBundleHeader(*fileBundle);
+  if (react::isHermesBytecodeBundle(header) ||
+      react::parseTypeFromHeader(header) == react::ScriptTag::RAMBundle) {
+    HarmonyReactMarker::logMarkerFinish("READ_JS_BUNDLE", path);
+    return fileBundle;
+  }
+  // JS source needs to be NUL terminated, which the mapped file isn't
+  // guaranteed to be
+  auto bundle = std::make_unique<react::JSBigBufferString>(fileBundle->size());
+  std::memcpy(bundle->data(), fileBundle->c_str(), fileBundle->size());
+  HarmonyReactMarker::logMarkerFinish("READ_JS_BUNDLE", path);
+  return bundle;
+}
+
+std::string runJSBundle(
+    react::Instance& instance,
+    std::unique_ptr<const react::JSBigString> bundle,
+    std::string const& sourceURL,
+    TaskExecutor::Shared const& taskExecutor) {
+  // NOTE: Hermes bytecode bundles are treated as String bundles,
+  // and don't throw an error here.
+  auto scriptTag = react::parseTypeFromHeader(readBundleHeader(*bundle));
+  if (scriptTag == react::ScriptTag::MetroHBCBundle) {
+    return "Metro Hermes bytecode bundles are not supported";
+  }
+  try {
+    if (scriptTag == react::ScriptTag::RAMBundle) {
+      auto ramBundle = std::make_unique<IndexedRAMBundle>(std::move(bundle));
+      auto startupCode = ramBundle->getStartupCode();
+      auto registry = react::RAMBundleRegistry::multipleBundlesRegistry(
+          std::move(ramBundle), IndexedRAMBundle::buildFactory());
+      instance.loadRAMBundle(
+          std::move(registry), std::move(startupCode), sourceURL, true);
+    } else {
+      auto codeCache = HermesCodeCache::getInstance();
+      if (codeCache != nullptr &&
+          !react::isHermesBytecodeBundle(readBundleHeader(*bundle))) {
+        bundle = codeCache->prepareBundle(
+            std::move(bundle), sourceURL, taskExecutor);
+      }
+      instance.loadScriptFromString(std::move(bundle), sourceURL, true);
+    }
+    return "";
+  } catch (std::exception const& e) {
+    try {
+      std::rethrow_if_nested(e);
+      return e.what();
+    } catch (const std::exception& nested) {
+      return e.what() + std::string("\n") + nested.what();
+    }
+  }
+}
+
+} // namespace rnoh
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cxxreact/Instance.h>
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSModulesUnbundle.h>
+#include <folly/Range.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RNOH/TaskExecutor/TaskExecutor.h"
+
+namespace rnoh {
+
+/**
+ * NUL terminated copy of a byte range, made with a single allocation.
+ */
+class JSBigVectorString : public facebook::react::JSBigString {
+ public:
+  static std::unique_ptr<JSBigVectorString> copyFrom(folly::ByteRange bytes) {
+    std::vector<uint8_t> terminatedBytes;
+    // reserved up front, so appending the terminator doesn't reallocate
+    terminatedBytes.reserve(bytes.size() + 1);
+    terminatedBytes.assign(bytes.begin(), bytes.end());
+    terminatedBytes.push_back('\0');
+    return std::unique_ptr<JSBigVectorString>(
+        new JSBigVectorString(std::move(terminatedBytes)));
+  }
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char* c_str() const override {
+    return reinterpret_cast<const char*>(m_bytes.data());
+  }
+
+  size_t size() const override {
+    return m_bytes.size() - 1;
+  }
+
+ private:
+  explicit JSBigVectorString(std::vector<uint8_t>&& terminatedBytes)
+      : m_bytes(std::move(terminatedBytes)) {}
+
+  std::vector<uint8_t> m_bytes;
+};
+
+/**
+ * Part of memory owned by another object, usually another JSBigString, which
+ * is kept alive for as long as the view is. The part must be NUL terminated,
+ * unless the view holds Hermes bytecode.
+ */
+class JSBigStringView : public facebook::react::JSBigString {
+ public:
+  JSBigStringView(
+      std::shared_ptr<const void> owner,
+      const char* data,
+      size_t size)
+      : m_owner(std::move(owner)), m_data(data), m_size(size) {}
+
+  bool isAscii() const override {
+    return false;
+  }
+
+  const char* c_str() const override {
+    return m_data;
+  }
+
+  size_t size() const override {
+    return m_size;
+  }
+
+ private:
+  std::shared_ptr<const void> m_owner;
+  const char* m_data;
+  size_t m_size;
+};
+
+/**
+ * Indexed RAM bundle which reads modules directly from the bundle's memory,
+ * usually a memory-mapped file. Nothing is parsed or copied up front, the code
+ * of a module is copied only when the module is required for the first time.
+ */
+class IndexedRAMBundle : public facebook::react::JSModulesUnbundle {
+ public:
+  using Factory =
+      std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>;
+
+  /**
+   * Creates a factory which memory-maps RAM bundle segments registered with
+   * `RNInstanceInternal::registerSegment`.
+   */
+  static Factory buildFactory();
+
+  IndexedRAMBundle(std::unique_ptr<const facebook::react::JSBigString> bundle);
+
+  /**
+   * Returns the startup code as a view into the bundle, the bundle stays
+   * alive for as long as the returned string does.
+   */
+  std::unique_ptr<const facebook::react::JSBigString> getStartupCode() const;
+
+  Module getModule(uint32_t moduleId) const override;
+
+ private:
+  struct ModuleData {
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  ModuleData getModuleData(uint32_t moduleId) const;
+
+  std::shared_ptr<const facebook::react::JSBigString> m_bundle;
+  uint32_t m_modulesCount;
+  size_t m_baseOffset;
+  size_t m_startupCodeSize;
+};
+
+bool isHermesBytecodeBundle(facebook::react::JSBigString const& bundle);
+
+/**
+ * Loads a bundle from a file. Hermes bytecode bundles and RAM bundles are
+ * memory-mapped and passed to the runtime without copying, other bundles are
+ * read into memory once.
+ */
+std::unique_ptr<const facebook::react::JSBigString> loadJSBundleFromFile(
+    std::string const& path);
+
+/**
+ * Checks the bundle header and runs the bundle. Indexed RAM bundles are
+ * loaded with a registry that allows registering additional segments later
+ * on. Source bundles missing in the Hermes code cache are compiled on the
+ * BACKGROUND thread of `taskExecutor`. Must be called on the JS thread.
+ * Returns an error message, or an empty string on success.
+ */
+std::string runJSBundle(
+    facebook::react::Instance& instance,
+    std::unique_ptr<const facebook::react::JSBigString> bundle,
+    std::string const& sourceURL,
+    TaskExecutor::Shared const& taskExecutor);
+
+} // namespace rnoh
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <ReactCommon/CallInvoker.h>
+#include <jsi/jsi.h>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include "RNOH/ArkJS.h"
+
+namespace rnoh {
+
+/**
+ * Base of objects which receive data from the ArkTS side through napi
+ * functions and pass it on to JS with the JS call invoker, bypassing the
+ * folly::dynamic conversions of ArkTS calls.
+ *
+ * The napi functions are created by `Derived::createHandler(arkJs, data)`,
+ * which must pass `data` to them as callback data. The functions get the sink
+ * back with `getSink`. `data` holds a weak pointer to the sink and is freed
+ * when the handler returned by `createHandler` is garbage collected, so the
+ * ArkTS side must keep the handler while it uses the functions.
+ */
+template <typename Derived>
+class JSEventSink : public std::enable_shared_from_this<Derived> {
+ public:
+  JSEventSink(
+      std::shared_ptr<facebook::react::CallInvoker> jsInvoker,
+      facebook::jsi::Runtime& runtime)
+      : m_jsInvoker(jsInvoker), m_runtime(runtime) {}
+
+  virtual ~JSEventSink() = default;
+
+  /**
+   * Returns the handler passed to the ArkTS side, creating it on the first
+   * call. MAIN thread only.
+   */
+  napi_value getHandler(ArkJS& arkJs) {
+    if (m_handlerRef != nullptr) {
+      return arkJs.getReferenceValue(m_handlerRef);
+    }
+    auto weakSink = new std::weak_ptr<Derived>(this->shared_from_this());
+    napi_value handler;
+    try {
+      handler = Derived::createHandler(arkJs, weakSink);
+    } catch (...) {
+      delete weakSink;
+      throw;
+    }
+    napi_wrap(
+        arkJs.getEnv(),
+        handler,
+        weakSink,
+        [](napi_env, void* data, void*) {
+          delete static_cast<std::weak_ptr<Derived>*>(data);
+        },
+        nullptr,
+        nullptr);
+    m_handlerRef = arkJs.createReference(handler);
+    return handler;
+  }
+
+  /**
+   * MAIN thread only.
+   */
+  virtual void releaseHandler(ArkJS& arkJs) {
+    if (m_handlerRef != nullptr) {
+      arkJs.deleteReference(m_handlerRef);
+      m_handlerRef = nullptr;
+    }
+  }
+
+  /**
+   * Reads the arguments of a call to one of the handler's functions and
+   * returns the sink it belongs to, or nullptr if the sink is gone or fewer
+   * than `minArgsCount` arguments were passed.
+   */
+  template <size_t ArgsCount>
+  static std::shared_ptr<Derived> getSink(
+      napi_env env,
+      napi_callback_info info,
+      std::array<napi_value, ArgsCount>& args,
+      size_t minArgsCount = ArgsCount) {
+    size_t argc = ArgsCount;
+    void* data = nullptr;
+    napi_get_cb_info(env, info, &argc, args.data(), nullptr, &data);
+    auto weakSink = static_cast<std::weak_ptr<Derived>*>(data);
+    if (weakSink == nullptr || argc < minArgsCount) {
+      return nullptr;
+    }
+    return weakSink->lock();
+  }
+
+ protected:
+  void runOnJSThread(std::function<void(facebook::jsi::Runtime&)>&& task) {
+    auto jsInvoker = m_jsInvoker.lock();
+    if (!jsInvoker) {
+      return;
+    }
+    jsInvoker->invokeAsync(
+        [&rt = m_runtime, task = std::move(task)]() { task(rt); });
+  }
+
+  /**
+   * Emits an event through RCTDeviceEventEmitter. JS thread only.
+   */
+  static void emitDeviceEvent(
+      facebook::jsi::Runtime& rt,
+      std::string const& eventName,
+      facebook::jsi::Value payload) {
+    auto emitter = rt.global().getProperty(rt, "__rctDeviceEventEmitter");
+    if (emitter.isUndefined()) {
+      return;
+    }
+    auto emitterObject = emitter.asObject(rt);
+    emitterObject.getPropertyAsFunction(rt, "emit")
+        .callWithThis(
+            rt,
+            emitterObject,
+            facebook::jsi::String::createFromUtf8(rt, eventName),
+            std::move(payload));
+  }
+
+ private:
+  std::weak_ptr<facebook::react::CallInvoker> m_jsInvoker;
+  facebook::jsi::Runtime& m_runtime;
+  napi_ref m_handlerRef = nullptr;
+};
+
+} // namespace rnoh
@@ -1,80 +1,216 @@
 #include "JsiConversions.h"
+#include <cstring>
 #include "RNOH/ArkJS.h"
 
 namespace rnoh {
 
-napi_value jsiToNapi(napi_env env, jsi::Runtime& rt, const jsi::Value& value) {
-  ArkJS arkJs(env);
+namespace {
 
-  if (value.isUndefined()) {
-    return arkJs.getUndefined();
-  } else if (value.isNull()) {
-    return arkJs.getNull();
+TransferableValue jsiArrayToTransferable(
+    jsi::Runtime& rt,
+    jsi::Array const& array) {
+  auto length = array.size(rt);
+  TransferableValue::Array result;
+  result.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    auto item = array.getValueAtIndex(rt, i);
+    // arrays of numbers are the most common case (e.g. transforms, colors)
+    if (item.isNumber()) {
+      result.emplace_back(item.getNumber());
+    } else {
+      result.push_back(jsiToTransferable(rt, item));
+    }
+  }
+  return result;
+}
+
+TransferableValue jsiObjectToTransferable(
+    jsi::Runtime& rt,
+    jsi::Object const& object) {
+  auto propertyNames = object.getPropertyNames(rt);
+  auto length = propertyNames.size(rt);
+  TransferableValue::Object result;
+  result.keys.reserve(length);
+  result.values.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    auto name = propertyNames.getValueAtIndex(rt, i).getString(rt);
+    auto value = object.getProperty(rt, jsi::PropNameID::forString(rt, name));
+    result.keys.push_back(name.utf8(rt));
+    result.values.push_back(jsiToTransferable(rt, value));
+  }
+  return result;
+}
+
+napi_value transferableArrayToNapi(
+    napi_env env,
+    TransferableValue::Array const& array) {
+  napi_value result;
+  napi_create_array_with_length(env, array.size(), &result);
+  for (size_t i = 0; i < array.size(); i++) {
+    napi_set_element(env, result, i, transferableToNapi(env, array[i]));
+  }
+  return result;
+}
+
+napi_value transferableObjectToNapi(
+    napi_env env,
+    TransferableValue::Object const& object) {
+  std::vector<napi_property_descriptor> descriptors;
+  descriptors.reserve(object.keys.size());
+  for (size_t i = 0; i < object.keys.size(); i++) {
+    descriptors.push_back(napi_property_descriptor{
+        object.keys[i].c_str(),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        transferableToNapi(env, object.values[i]),
+        napi_default_jsproperty,
+        nullptr});
+  }
+  napi_value result;
+  napi_create_object(env, &result);
+  if (!descriptors.empty()) {
+    napi_define_properties(env, result, descriptors.size(), descriptors.data());
+  }
+  return result;
+}
+
+} // namespace
+
+TransferableValue jsiToTransferable(jsi::Runtime& rt, const jsi::Value& value) {
+  if (value.isNull()) {
+    return nullptr;
   } else if (value.isBool()) {
-    return arkJs.createBoolean(value.getBool());
+    return value.getBool();
   } else if (value.isNumber()) {
-    return arkJs.createDouble(value.getNumber());
+    return value.getNumber();
   } else if (value.isString()) {
-    return arkJs.createString(value.getString(rt).utf8(rt));
+    return value.getString(rt).utf8(rt);
   } else if (value.isObject()) {
     auto object = value.getObject(rt);
     if (object.isArray(rt)) {
-      auto array = object.getArray(rt);
-      auto arrayValues = std::vector<napi_value>();
-      for (size_t i = 0; i < array.size(rt); i++) {
-        auto item = array.getValueAtIndex(rt, i);
-        auto napiItem = jsiToNapi(env, rt, item);
-        arrayValues.push_back(napiItem);
-      }
-      auto napiArray = arkJs.createArray(arrayValues);
-      return napiArray;
+      return jsiArrayToTransferable(rt, object.getArray(rt));
+    } else if (object.isArrayBuffer(rt)) {
+      // copied once, the JS heap can't be shared with the ArkTS runtime
+      auto arrayBuffer = object.getArrayBuffer(rt);
+      return SharedByteBuffer::copyFrom(
+          folly::ByteRange(arrayBuffer.data(rt), arrayBuffer.size(rt)));
     } else if (object.isFunction(rt)) {
-      // TODO: Implement
-      return arkJs.getUndefined();
+      return TransferableValue::Undefined{};
     } else {
-      auto propertyNames = object.getPropertyNames(rt);
-      auto napiObject = arkJs.createObjectBuilder();
-      for (size_t i = 0; i < propertyNames.size(rt); i++) {
-        auto propertyName =
-            propertyNames.getValueAtIndex(rt, i).asString(rt).utf8(rt);
-        auto propertyValue = object.getProperty(rt, propertyName.c_str());
-        auto napiPropertyValue = jsiToNapi(env, rt, propertyValue);
-        napiObject.addProperty(propertyName.c_str(), napiPropertyValue);
-      }
-      return napiObject.build();
+      return jsiObjectToTransferable(rt, object);
     }
   }
-  return napi_value();
+  return TransferableValue::Undefined{};
 }
 
-jsi::Value napiToJsi(napi_env env, jsi::Runtime& rt, napi_value value) {
+jsi::Value transferableToJsi(jsi::Runtime& rt, TransferableValue const& value) {
+  if (value.is<std::nullptr_t>()) {
+    return jsi::Value::null();
+  } else if (value.is<bool>()) {
+    return jsi::Value(value.get<bool>());
+  } else if (value.is<double>()) {
+    return jsi::Value(value.get<double>());
+  } else if (value.is<std::string>()) {
+    return jsi::Value(
+        rt, jsi::String::createFromUtf8(rt, value.get<std::string>()));
+  } else if (value.is<SharedByteBuffer::Shared>()) {
+    return jsi::Value(
+        jsi::ArrayBuffer(rt, value.get<SharedByteBuffer::Shared>()));
+  } else if (value.is<TransferableValue::Array>()) {
+    auto const& array = value.get<TransferableValue::Array>();
+    jsi::Array result(rt, array.size());
+    for (size_t i = 0; i < array.size(); i++) {
+      result.setValueAtIndex(rt, i, transferableToJsi(rt, array[i]));
+    }
+    return jsi::Value(std::move(result));
+  } else if (value.is<TransferableValue::Object>()) {
+    auto const& object = value.get<TransferableValue::Object>();
+    jsi::Object result(rt);
+    for (size_t i = 0; i < object.keys.size(); i++) {
+      result.setProperty(
+          rt,
+          jsi::PropNameID::forUtf8(rt, object.keys[i]),
+          transferableToJsi(rt, object.values[i]));
+    }
+    return jsi::Value(std::move(result));
+  }
+  return jsi::Value::undefined();
+}
+
+TransferableValue napiToTransferable(napi_env env, napi_value value) {
   ArkJS arkJs(env);
 
   switch (arkJs.getType(value)) {
-    case napi_undefined:
-      return jsi::Value::undefined();
     case napi_null:
-      return jsi::Value::null();
+      return nullptr;
     case napi_boolean:
-      return jsi::Value(arkJs.getBoolean(value));
+      return arkJs.getBoolean(value);
     case napi_number:
-      return jsi::Value(arkJs.getDouble(value));
+      return arkJs.getDouble(value);
     case napi_string:
-      return jsi::Value(
-          rt, jsi::String::createFromUtf8(rt, arkJs.getString(value)));
+      return arkJs.getString(value);
     case napi_object: {
-      jsi::Object result(rt);
-      auto properties = arkJs.getObjectProperties(value);
-      for (auto [key, value] : properties) {
-        auto stringKey = arkJs.getString(key);
-        auto jsiValue = napiToJsi(env, rt, value);
-        result.setProperty(rt, stringKey.c_str(), jsiValue);
+      bool isArray = false;
+      napi_is_array(env, value, &isArray);
+      if (isArray) {
+        auto length = arkJs.getArrayLength(value);
+        TransferableValue::Array result;
+        result.reserve(length);
+        for (uint32_t i = 0; i < length; i++) {
+          result.push_back(
+              napiToTransferable(env, arkJs.getArrayElement(value, i)));
+        }
+        return result;
+      }
+      bool isArrayBuffer = false;
+      napi_is_arraybuffer(env, value, &isArrayBuffer);
+      if (isArrayBuffer) {
+        // copied once, the ArkTS heap can't be shared with the JS runtime
+        return SharedByteBuffer::copyFrom(arkJs.getArrayBufferRange(value));
+      }
+      TransferableValue::Object result;
+      for (auto [key, propertyValue] : arkJs.getObjectProperties(value)) {
+        result.keys.push_back(arkJs.getString(key));
+        result.values.push_back(napiToTransferable(env, propertyValue));
       }
-      return jsi::Value(std::move(result));
+      return result;
     }
     default:
-      return jsi::Value::undefined();
+      return TransferableValue::Undefined{};
+  }
+}
+
+napi_value transferableToNapi(napi_env env, TransferableValue const& value) {
+  ArkJS arkJs(env);
+
+  if (value.is<std::nullptr_t>()) {
+    return arkJs.getNull();
+  } else if (value.is<bool>()) {
+    return arkJs.createBoolean(value.get<bool>());
+  } else if (value.is<double>()) {
+    return arkJs.createDouble(value.get<double>());
+  } else if (value.is<std::string>()) {
+    return arkJs.createString(value.get<std::string>());
+  } else if (value.is<SharedByteBuffer::Shared>()) {
+    return arkJs.createArrayBuffer(value.get<SharedByteBuffer::Shared>());
+  } else if (value.is<TransferableValue::Array>()) {
+    return transferableArrayToNapi(
+        env, value.get<TransferableValue::Array>());
+  } else if (value.is<TransferableValue::Object>()) {
+    return transferableObjectToNapi(
+        env, value.get<TransferableValue::Object>());
   }
+  return arkJs.getUndefined();
+}
+
+napi_value jsiToNapi(napi_env env, jsi::Runtime& rt, const jsi::Value& value) {
+  return transferableToNapi(env, jsiToTransferable(rt, value));
+}
+
+jsi::Value napiToJsi(napi_env env, jsi::Runtime& rt, napi_value value) {
+  return transferableToJsi(rt, napiToTransferable(env, value));
 }
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
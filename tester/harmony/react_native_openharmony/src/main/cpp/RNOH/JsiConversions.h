@@ -2,13 +2,99 @@
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 #include <napi/native_api.h>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+#include "RNOH/SharedByteBuffer.h"
 
 namespace rnoh {
 
 using namespace facebook;
 
-napi_value jsiToNapi(napi_env env, jsi::Runtime& rt, const jsi::Value& value);
+/**
+ * A JS value detached from any runtime, so it can be passed between the JS
+ * and MAIN threads. jsi values may only be accessed on the JS thread and napi
+ * values only on the MAIN thread, so each side converts to and from this
+ * type on its own thread.
+ *
+ * Unlike folly::dynamic, object properties are kept in insertion order in a
+ * vector (no hashing), `undefined` is distinguished from `null`, and
+ * ArrayBuffers are kept in a SharedByteBuffer which backs the resulting
+ * ArrayBuffer without another copy.
+ *
+ * Only synchronous TurboModule calls (ArkTSTurboModule::call) use it so far.
+ * Async and scheduled calls, the Animated module and events emitted from
+ * ArkTS still convert through folly::dynamic.
+ */
+class TransferableValue {
+ public:
+  struct Undefined {};
+  using Array = std::vector<TransferableValue>;
+  struct Object {
+    std::vector<std::string> keys;
+    std::vector<TransferableValue> values;
+  };
 
-jsi::Value napiToJsi(napi_env env, jsi::Runtime& rt, napi_value value);
+  using Variant = std::variant<
+      Undefined,
+      std::nullptr_t,
+      bool,
+      double,
+      std::string,
+      SharedByteBuffer::Shared,
+      Array,
+      Object>;
+
+  TransferableValue() = default;
+
+  template <
+      typename T,
+      typename = std::enable_if_t<
+          !std::is_same_v<std::decay_t<T>, TransferableValue> &&
+          std::is_constructible_v<Variant, T>>>
+  TransferableValue(T&& value) : m_value(std::forward<T>(value)) {}
+
+  template <typename T>
+  bool is() const {
+    return std::holds_alternative<T>(m_value);
+  }
+
+  template <typename T>
+  T const& get() const {
+    return std::get<T>(m_value);
+  }
+
+ private:
+  Variant m_value;
+};
+
+// JS thread only. Functions are converted to `undefined`.
+TransferableValue jsiToTransferable(jsi::Runtime& rt, const jsi::Value& value);
+
+// JS thread only
+jsi::Value transferableToJsi(jsi::Runtime& rt, TransferableValue const& value);
+
+// MAIN thread only. Functions are converted to `undefined`.
+TransferableValue napiToTransferable(napi_env env, napi_value value);
+
+// MAIN thread only
+napi_value transferableToNapi(napi_env env, TransferableValue const& value);
+
+/**
+ * @deprecated Accesses the runtime and the napi env from one thread. Convert
+ * with `jsiToTransferable` on the JS thread and `transferableToNapi` on the
+ * MAIN thread instead.
+ */
+[[deprecated("Use jsiToTransferable and transferableToNapi")]] napi_value
+jsiToNapi(napi_env env, jsi::Runtime& rt, const jsi::Value& value);
+
+/**
+ * @deprecated Accesses the runtime and the napi env from one thread. Convert
+ * with `napiToTransferable` on the MAIN thread and `transferableToJsi` on the
+ * JS thread instead.
+ */
+[[deprecated("Use napiToTransferable and transferableToJsi")]] jsi::Value
+napiToJsi(napi_env env, jsi::Runtime& rt, napi_value value);
 
 } // namespace rnoh
@@ -0,0 +1,79 @@
+#include "RNOH/LogRateLimiter.h"
+
+namespace rnoh {
+
+static_assert(
+    (LogRateLimiter::FILES_CAPACITY & (LogRateLimiter::FILES_CAPACITY - 1)) ==
+        0,
+    "FILES_CAPACITY must be a power of 2");
+
+LogRateLimiter::LogRateLimiter(
+    size_t maxMessagesPerFileInWindow,
+    std::chrono::milliseconds window)
+    : m_maxMessagesPerFileInWindow(maxMessagesPerFileInWindow),
+      m_window(window) {}
+
+bool LogRateLimiter::tryAcquire(const char* file, Clock::time_point now) {
+  auto slot = findSlot(file);
+  if (slot == nullptr) {
+    return true;
+  }
+  auto window = getWindowIndex(now);
+  auto state = slot->windowAndCount.load(std::memory_order_relaxed);
+  while (true) {
+    auto stateWindow = static_cast<uint32_t>(state >> 32);
+    auto count = static_cast<uint32_t>(state);
+    uint64_t nextState;
+    // a thread which read the clock earlier may come after the window was
+    // moved forward, it's counted in the newer window then
+    if (static_cast<int32_t>(window - stateWindow) > 0) {
+      nextState = (static_cast<uint64_t>(window) << 32) | 1;
+    } else if (count < m_maxMessagesPerFileInWindow) {
+      nextState = state + 1;
+    } else {
+      slot->droppedMessagesCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    if (slot->windowAndCount.compare_exchange_weak(
+            state, nextState, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+}
+
+LogRateLimiter::Clock::time_point LogRateLimiter::getWindowEndTime(
+    Clock::time_point now) const {
+  auto windowsCount = now.time_since_epoch() / m_window;
+  return Clock::time_point(std::chrono::duration_cast<Clock::duration>(
+      m_window * (windowsCount + 1)));
+}
+
+LogRateLimiter::Slot* LogRateLimiter::findSlot(const char* file) {
+  // Fibonacci hashing, so that nearby pointers spread over the table
+  auto hash =
+      (reinterpret_cast<uintptr_t>(file) * 0x9E3779B97F4A7C15ULL) >> 32;
+  for (size_t i = 0; i < FILES_CAPACITY; i++) {
+    auto& slot = m_slots[(hash + i) & (FILES_CAPACITY - 1)];
+    auto slotFile = slot.file.load(std::memory_order_acquire);
+    if (slotFile == file) {
+      return &slot;
+    }
+    if (slotFile == nullptr) {
+      if (slot.file.compare_exchange_strong(
+              slotFile, file, std::memory_order_acq_rel)) {
+        return &slot;
+      }
+      // another thread claimed the slot, maybe for the same file
+      if (slotFile == file) {
+        return &slot;
+      }
+    }
+  }
+  return nullptr;
+}
+
+uint32_t LogRateLimiter::getWindowIndex(Clock::time_point time) const {
+  return static_cast<uint32_t>(time.time_since_epoch() / m_window);
+}
+
+} // namespace rnoh
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace rnoh {
+
+/**
+ * Limits the number of messages logged from each source file in fixed time
+ * windows. Checked by the logging threads before a message is formatted, so
+ * dropped messages cost a few atomic operations and never reach the ring
+ * buffer. Files are tracked in a fixed-size table without locks; if more
+ * files log than the table fits, the remaining files aren't limited. Doesn't
+ * depend on platform APIs, so it can be used in host builds.
+ */
+class LogRateLimiter {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr size_t FILES_CAPACITY = 128;
+
+  LogRateLimiter(
+      size_t maxMessagesPerFileInWindow,
+      std::chrono::milliseconds window);
+
+  /**
+   * Any thread. Returns false and counts the message as dropped if the file
+   * already logged the maximum number of messages in the current window.
+   * `file` is compared by pointer, producers pass string literals.
+   */
+  bool tryAcquire(const char* file, Clock::time_point now = Clock::now());
+
+  /**
+   * Returns the time when the window containing `now` ends.
+   */
+  Clock::time_point getWindowEndTime(Clock::time_point now) const;
+
+  /**
+   * Calls `onDropped(const char* file, size_t count)` for each file with
+   * messages dropped since the last call.
+   */
+  template <typename OnDroppedFn>
+  void takeDroppedMessagesCounts(OnDroppedFn&& onDropped) {
+    for (auto& slot : m_slots) {
+      auto file = slot.file.load(std::memory_order_acquire);
+      if (file == nullptr) {
+        continue;
+      }
+      auto count =
+          slot.droppedMessagesCount.exchange(0, std::memory_order_relaxed);
+      if (count > 0) {
+        onDropped(file, count);
+      }
+    }
+  }
+
+ private:
+  struct Slot {
+    std::atomic<const char*> file{nullptr};
+    // the window index in the upper half, the number of messages logged in
+    // it in the lower half, so both are updated with a single CAS
+    std::atomic<uint64_t> windowAndCount{0};
+    std::atomic<size_t> droppedMessagesCount{0};
+  };
+
+  Slot* findSlot(const char* file);
+  uint32_t getWindowIndex(Clock::time_point time) const;
+
+  size_t m_maxMessagesPerFileInWindow;
+  std::chrono::milliseconds m_window;
+  std::array<Slot, FILES_CAPACITY> m_slots;
+};
+
+} // namespace rnoh
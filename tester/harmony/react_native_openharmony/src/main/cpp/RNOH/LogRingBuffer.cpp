@@ -0,0 +1,68 @@
+#include "RNOH/LogRingBuffer.h"
+
+namespace rnoh {
+
+LogRingBuffer::LogRingBuffer(size_t entriesCount)
+    : m_entriesCount(entriesCount), m_slots(new Slot[entriesCount]) {
+  for (size_t i = 0; i < m_entriesCount; i++) {
+    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+void LogRingBuffer::waitForMessages(
+    std::optional<std::chrono::milliseconds> timeout) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_isConsumerWaiting.store(true, std::memory_order_relaxed);
+  // pairs with the fence in `wakeUpConsumer`: either the producer sees that
+  // the consumer is waiting, or the consumer sees the pushed message
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto predicate = [this] {
+    return hasMessages() ||
+        m_droppedMessagesCount.load(std::memory_order_relaxed) > 0;
+  };
+  if (timeout.has_value()) {
+    m_messagesCondition.wait_for(lock, timeout.value(), predicate);
+  } else {
+    m_messagesCondition.wait(lock, predicate);
+  }
+  m_isConsumerWaiting.store(false, std::memory_order_relaxed);
+}
+
+size_t LogRingBuffer::takeDroppedMessagesCount() {
+  return m_droppedMessagesCount.exchange(0, std::memory_order_relaxed);
+}
+
+bool LogRingBuffer::waitUntilConsumed(std::chrono::milliseconds timeout) {
+  auto targetPosition = m_enqueuePosition.load(std::memory_order_acquire);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  return m_consumedCondition.wait_for(lock, timeout, [&] {
+    return m_consumedPosition >= targetPosition;
+  });
+}
+
+bool LogRingBuffer::hasMessages() const {
+  auto& slot = m_slots[m_dequeuePosition & (m_entriesCount - 1)];
+  return slot.sequence.load(std::memory_order_acquire) ==
+      m_dequeuePosition + 1;
+}
+
+void LogRingBuffer::wakeUpConsumer() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!m_isConsumerWaiting.load(std::memory_order_relaxed)) {
+    return;
+  }
+  // the consumer holds the mutex until it waits, so the notification can't
+  // be missed
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_messagesCondition.notify_one();
+}
+
+void LogRingBuffer::onConsumed() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_consumedPosition = m_dequeuePosition;
+  }
+  m_consumedCondition.notify_all();
+}
+
+} // namespace rnoh
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace rnoh {
+
+/**
+ * Bounded multi-producer single-consumer queue of log messages. Producers
+ * write messages straight into preallocated entries without taking a lock,
+ * and wake up the consumer only if it's waiting for messages. Messages which
+ * don't fit in the buffer are dropped and counted. Doesn't depend on platform
+ * APIs, so it can be used in host builds.
+ */
+class LogRingBuffer {
+ public:
+  static constexpr size_t ENTRY_TEXT_CAPACITY = 1024;
+
+  struct Entry {
+    int severity;
+    // producers pass pointers to string literals, so they stay valid
+    const char* file;
+    size_t length;
+    char text[ENTRY_TEXT_CAPACITY];
+  };
+
+  /**
+   * `entriesCount` must be a power of 2.
+   */
+  explicit LogRingBuffer(size_t entriesCount);
+
+  /**
+   * Claims an entry and calls `write(Entry&)` to fill it in. Returns false if
+   * the buffer is full.
+   */
+  template <typename WriteFn>
+  bool push(WriteFn&& write) {
+    // bounded multi-producer queue, see
+    // https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+    Slot* slot = nullptr;
+    auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+    while (true) {
+      slot = &m_slots[position & (m_entriesCount - 1)];
+      auto sequence = slot->sequence.load(std::memory_order_acquire);
+      auto difference =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (m_enqueuePosition.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        m_droppedMessagesCount.fetch_add(1, std::memory_order_relaxed);
+        wakeUpConsumer();
+        return false;
+      } else {
+        position = m_enqueuePosition.load(std::memory_order_relaxed);
+      }
+    }
+    write(slot->entry);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    wakeUpConsumer();
+    return true;
+  }
+
+  /**
+   * Consumer only. Calls `onEntry(Entry const&)` for each message in the
+   * buffer, in the order in which they were pushed. Returns the number of
+   * consumed messages.
+   */
+  template <typename OnEntryFn>
+  size_t consume(OnEntryFn&& onEntry) {
+    size_t consumedEntriesCount = 0;
+    while (true) {
+      auto& slot = m_slots[m_dequeuePosition & (m_entriesCount - 1)];
+      if (slot.sequence.load(std::memory_order_acquire) !=
+          m_dequeuePosition + 1) {
+        break;
+      }
+      onEntry(static_cast<Entry const&>(slot.entry));
+      slot.sequence.store(
+          m_dequeuePosition + m_entriesCount, std::memory_order_release);
+      m_dequeuePosition++;
+      consumedEntriesCount++;
+    }
+    if (consumedEntriesCount > 0) {
+      onConsumed();
+    }
+    return consumedEntriesCount;
+  }
+
+  /**
+   * Consumer only. Blocks until a message is pushed or dropped, or the
+   * timeout passes, if provided.
+   */
+  void waitForMessages(std::optional<std::chrono::milliseconds> timeout);
+
+  size_t takeDroppedMessagesCount();
+
+  /**
+   * Any thread but the consumer's. Blocks until the messages pushed before
+   * this call are consumed, or the timeout passes. Returns false on timeout.
+   */
+  bool waitUntilConsumed(std::chrono::milliseconds timeout);
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    Entry entry;
+  };
+
+  bool hasMessages() const;
+  void wakeUpConsumer();
+  void onConsumed();
+
+  size_t m_entriesCount;
+  std::unique_ptr<Slot[]> m_slots;
+  alignas(64) std::atomic<size_t> m_enqueuePosition{0};
+  alignas(64) size_t m_dequeuePosition = 0;
+  std::atomic<size_t> m_droppedMessagesCount{0};
+  std::atomic<bool> m_isConsumerWaiting{false};
+  std::mutex m_mutex;
+  std::condition_variable m_messagesCondition;
+  std::condition_variable m_consumedCondition;
+  size_t m_consumedPosition = 0;
+};
+
+} // namespace rnoh
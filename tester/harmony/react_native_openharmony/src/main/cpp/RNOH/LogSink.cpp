@@ -1,51 +1,64 @@
 #include "RNOH/LogSink.h"
 #include <hilog/log.h>
 #include <pthread.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <thread>
 
 #define LOG_DOMAIN 0xBEEF
 #define LOG_TAG "#RNOH_CPP"
 
+using rnoh::LogRateLimiter;
+using rnoh::LogRingBuffer;
+
+// must be a power of 2
+static constexpr size_t ENTRIES_COUNT = 256;
+static constexpr auto RATE_LIMIT_WINDOW = std::chrono::milliseconds(1000);
+static constexpr size_t MAX_MESSAGES_PER_FILE_IN_WINDOW = 200;
+static constexpr auto FATAL_FLUSH_TIMEOUT = std::chrono::milliseconds(500);
+
 LogSink* LogSink::instance = nullptr;
 
-std::string getThreadSymbol() {
-  char c_threadName[16] = {0};
-  pthread_getname_np(pthread_self(), c_threadName, sizeof(c_threadName));
-  auto threadName = std::string(c_threadName);
-  if (threadName == "RNOH_JS") {
-    return "__█";
-  } else if (threadName == "RNOH_BACKGROUND") {
-    return "_█_";
-  } else if (threadName == "RNOH_CLEANUP") {
-    return "___█";
-  } else {
-    return "█__";
-  }
+static const char* getThreadSymbol() {
+  // thread names are set when threads start, so the symbol can be cached
+  thread_local const char* threadSymbol = []() -> const char* {
+    char c_threadName[16] = {0};
+    pthread_getname_np(pthread_self(), c_threadName, sizeof(c_threadName));
+    if (std::strcmp(c_threadName, "RNOH_JS") == 0) {
+      return "__█";
+    } else if (std::strcmp(c_threadName, "RNOH_BACKGROUND") == 0) {
+      return "_█_";
+    } else if (std::strcmp(c_threadName, "RNOH_CLEANUP") == 0) {
+      return "___█";
+    } else {
+      return "█__";
+    }
+  }();
+  return threadSymbol;
 }
 
-void LogSink::initializeLogging() {
-  if (!instance) {
-    instance = new LogSink();
-    google::AddLogSink(instance);
-    FLAGS_logtostderr = true;
-    google::InitGoogleLogging("[RNOH]");
+static LogLevel getLogLevel(google::LogSeverity severity) {
+  switch (severity) {
+    case google::GLOG_INFO:
+      return LOG_INFO;
+    case google::GLOG_WARNING:
+      return LOG_WARN;
+    case google::GLOG_ERROR:
+      return LOG_ERROR;
+    case google::GLOG_FATAL:
+      return LOG_FATAL;
+    default:
+      return LOG_WARN;
   }
 }
 
-void LogSink::send(
-    google::LogSeverity severity,
-    const char* /*full_filename*/,
-    const char* base_filename,
-    int line,
-    const ::tm* /*tm_time*/,
-    const char* message,
-    size_t message_len) {
-  std::ostringstream stream;
-
-  stream << getThreadSymbol() << " " << base_filename << ':' << line << "> "
-         << std::string(message, message_len);
-  auto messageString = stream.str();
-  auto c_str = messageString.c_str();
-
+static void writeToHilog(google::LogSeverity severity, const char* c_str) {
   switch (severity) {
     case google::GLOG_INFO:
       OH_LOG_INFO(LOG_APP, "%{public}s", c_str);
@@ -63,4 +76,170 @@ void LogSink::send(
       OH_LOG_WARN(LOG_APP, "%{public}s", c_str);
       break;
   }
-}
\ No newline at end of file
+}
+
+static size_t formatMessage(
+    char* buffer,
+    size_t capacity,
+    const char* base_filename,
+    int line,
+    const char* message,
+    size_t message_len) {
+  auto length = std::snprintf(
+      buffer,
+      capacity,
+      "%s %s:%d> %.*s",
+      getThreadSymbol(),
+      base_filename,
+      line,
+      static_cast<int>(message_len),
+      message);
+  if (length < 0) {
+    buffer[0] = '\0';
+    return 0;
+  }
+  // longer messages are truncated
+  return std::min(static_cast<size_t>(length), capacity - 1);
+}
+
+LogSink::LogSink()
+    : m_ringBuffer(ENTRIES_COUNT),
+      m_rateLimiter(MAX_MESSAGES_PER_FILE_IN_WINDOW, RATE_LIMIT_WINDOW) {}
+
+LogSink::~LogSink() = default;
+
+void LogSink::initializeLogging() {
+  if (!instance) {
+    instance = new LogSink();
+    // the sink is never destroyed, so the thread can't outlive it
+    std::thread([sink = instance] { sink->runFlushLoop(); }).detach();
+    google::AddLogSink(instance);
+    // messages are written only by the sink, glog's own stderr and file
+    // output would format and write every message on the logging thread
+    FLAGS_logtostderr = false;
+    FLAGS_stderrthreshold = google::GLOG_FATAL;
+    // the prefix is formatted by glog on the logging thread, but sinks don't
+    // receive it
+    FLAGS_log_prefix = false;
+    // glog still formats streamed values on the logging thread, but below
+    // minloglevel it skips the sinks and its global lock, so levels which
+    // hilog doesn't print at startup are skipped there
+    for (auto severity = google::GLOG_INFO; severity < google::GLOG_FATAL;
+         severity++) {
+      if (OH_LOG_IsLoggable(LOG_DOMAIN, LOG_TAG, getLogLevel(severity))) {
+        break;
+      }
+      FLAGS_minloglevel = severity + 1;
+    }
+    for (auto severity = 0; severity < google::NUM_SEVERITIES; severity++) {
+      google::SetLogDestination(severity, "");
+    }
+    google::InitGoogleLogging("[RNOH]");
+  }
+}
+
+LogSink* LogSink::getInstance() {
+  return instance;
+}
+
+bool LogSink::waitUntilFlushed(std::chrono::milliseconds timeout) {
+  return m_ringBuffer.waitUntilConsumed(timeout);
+}
+
+void LogSink::send(
+    google::LogSeverity severity,
+    const char* /*full_filename*/,
+    const char* base_filename,
+    int line,
+    const ::tm* /*tm_time*/,
+    const char* message,
+    size_t message_len) {
+  // skip formatting messages which hilog would filter out anyway
+  if (!OH_LOG_IsLoggable(LOG_DOMAIN, LOG_TAG, getLogLevel(severity))) {
+    return;
+  }
+  // errors are never limited
+  if (severity < google::GLOG_ERROR &&
+      !m_rateLimiter.tryAcquire(base_filename)) {
+    return;
+  }
+  if (severity >= google::GLOG_FATAL) {
+    // the process aborts right after, so messages logged before are flushed
+    // first and the message isn't deferred
+    waitUntilFlushed(FATAL_FLUSH_TIMEOUT);
+    char text[LogRingBuffer::ENTRY_TEXT_CAPACITY];
+    formatMessage(
+        text, sizeof(text), base_filename, line, message, message_len);
+    writeToHilog(severity, text);
+    return;
+  }
+  m_ringBuffer.push([&](LogRingBuffer::Entry& entry) {
+    entry.severity = severity;
+    entry.file = base_filename;
+    entry.length = formatMessage(
+        entry.text,
+        LogRingBuffer::ENTRY_TEXT_CAPACITY,
+        base_filename,
+        line,
+        message,
+        message_len);
+  });
+}
+
+void LogSink::runFlushLoop() {
+  pthread_setname_np(pthread_self(), "RNOH_LOG");
+  setpriority(PRIO_PROCESS, syscall(SYS_gettid), 10);
+
+  std::optional<LogRateLimiter::Clock::time_point> rateLimitWindowEndTime;
+  char summary[128];
+
+  while (true) {
+    auto now = LogRateLimiter::Clock::now();
+    if (rateLimitWindowEndTime.has_value() &&
+        now >= rateLimitWindowEndTime.value()) {
+      m_rateLimiter.takeDroppedMessagesCounts(
+          [&](const char* file, size_t droppedMessagesCount) {
+            std::snprintf(
+                summary,
+                sizeof(summary),
+                "%zu messages from %s were dropped by the rate limit",
+                droppedMessagesCount,
+                file);
+            writeToHilog(google::GLOG_WARNING, summary);
+          });
+      rateLimitWindowEndTime = std::nullopt;
+    }
+
+    auto consumedMessagesCount =
+        m_ringBuffer.consume([&](LogRingBuffer::Entry const& entry) {
+          writeToHilog(entry.severity, entry.text);
+        });
+    // messages are dropped only after their file logged the maximum number
+    // of messages in the window, so the window needs to be reported only if
+    // messages were logged in it
+    if (consumedMessagesCount > 0 && !rateLimitWindowEndTime.has_value()) {
+      rateLimitWindowEndTime = m_rateLimiter.getWindowEndTime(now);
+    }
+
+    auto droppedMessagesCount = m_ringBuffer.takeDroppedMessagesCount();
+    if (droppedMessagesCount > 0) {
+      std::snprintf(
+          summary,
+          sizeof(summary),
+          "%zu messages were dropped because the log buffer was full",
+          droppedMessagesCount);
+      writeToHilog(google::GLOG_WARNING, summary);
+    }
+    // sleeps until a message is logged, waking up only to report messages
+    // dropped by the rate limit in the window
+    if (!rateLimitWindowEndTime.has_value()) {
+      m_ringBuffer.waitForMessages(std::nullopt);
+    } else {
+      m_ringBuffer.waitForMessages(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              rateLimitWindowEndTime.value() -
+              LogRateLimiter::Clock::now()) +
+          std::chrono::milliseconds(1));
+    }
+  }
+}
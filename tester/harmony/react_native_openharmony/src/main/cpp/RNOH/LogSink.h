@@ -1,11 +1,30 @@
 #pragma once
 
 #include <glog/logging.h>
+#include <chrono>
+#include "RNOH/LogRateLimiter.h"
+#include "RNOH/LogRingBuffer.h"
 
+/**
+ * Forwards glog messages to hilog. Messages are formatted on the logging
+ * thread into a preallocated lock-free ring buffer and written to hilog in
+ * batches by a low priority thread, so logging doesn't block the JS and MAIN
+ * threads. Messages which exceed the rate limit of their source file are
+ * dropped by the logging thread before they are formatted. They, and
+ * messages which don't fit in the buffer, are reported. FATAL messages are
+ * written after the buffered messages are flushed.
+ */
 class LogSink : public google::LogSink {
  public:
   static void initializeLogging();
 
+  /**
+   * Returns the sink installed by `initializeLogging`, or nullptr.
+   */
+  static LogSink* getInstance();
+
+  ~LogSink() override;
+
   void send(
       google::LogSeverity severity,
       const char* full_filename,
@@ -15,6 +34,19 @@ class LogSink : public google::LogSink {
       const char* message,
       size_t message_len) override;
 
+  /**
+   * Blocks until the messages sent before this call are written, or the
+   * timeout passes. Returns false on timeout.
+   */
+  bool waitUntilFlushed(std::chrono::milliseconds timeout);
+
  private:
+  LogSink();
+
+  void runFlushLoop();
+
   static LogSink* instance;
-};
\ No newline at end of file
+
+  rnoh::LogRingBuffer m_ringBuffer;
+  rnoh::LogRateLimiter m_rateLimiter;
+};
@@ -0,0 +1,107 @@
+#include "RNOH/MapBufferValidation.h"
+#include <react/renderer/mapbuffer/MapBuffer.h>
+#include <cstring>
+
+using MapBuffer = facebook::react::MapBuffer;
+
+namespace rnoh {
+
+// payloads are built by RNOH, so deeper nesting means the data is corrupted
+static constexpr size_t MAX_NESTING_DEPTH = 16;
+
+static bool isWellFormedMapBuffer(
+    uint8_t const* data,
+    size_t size,
+    size_t depth);
+
+/**
+ * Reads the int32 length prefix at `offset` and returns the size of the
+ * payload following it, or -1 if the payload doesn't fit in `size`.
+ */
+static int64_t getPayloadSize(uint8_t const* data, size_t size, size_t offset) {
+  int32_t length;
+  if (offset > size || size - offset < sizeof(length)) {
+    return -1;
+  }
+  std::memcpy(&length, data + offset, sizeof(length));
+  if (length < 0 ||
+      static_cast<size_t>(length) > size - offset - sizeof(length)) {
+    return -1;
+  }
+  return length;
+}
+
+static bool isWellFormedMapBufferList(
+    uint8_t const* data,
+    size_t size,
+    size_t depth) {
+  size_t offset = 0;
+  while (offset < size) {
+    auto itemSize = getPayloadSize(data, size, offset);
+    if (itemSize < 0) {
+      return false;
+    }
+    offset += sizeof(int32_t);
+    if (!isWellFormedMapBuffer(data + offset, itemSize, depth)) {
+      return false;
+    }
+    offset += itemSize;
+  }
+  return true;
+}
+
+static bool isWellFormedMapBuffer(
+    uint8_t const* data,
+    size_t size,
+    size_t depth) {
+  if (depth > MAX_NESTING_DEPTH) {
+    return false;
+  }
+  MapBuffer::Header header;
+  if (size < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data, sizeof(header));
+  size_t dynamicDataOffset =
+      sizeof(header) + header.count * sizeof(MapBuffer::Bucket);
+  if (header.alignment != MapBuffer::HEADER_ALIGNMENT ||
+      header.bufferSize != size || dynamicDataOffset > size) {
+    return false;
+  }
+  // MapBuffer reads strings and nested maps without bounds checks
+  for (size_t i = 0; i < header.count; i++) {
+    MapBuffer::Bucket bucket(0, 0, 0);
+    std::memcpy(
+        &bucket,
+        data + sizeof(header) + i * sizeof(MapBuffer::Bucket),
+        sizeof(bucket));
+    if (bucket.type != MapBuffer::String && bucket.type != MapBuffer::Map) {
+      continue;
+    }
+    // MapBuffer reads offsets as int32
+    auto relativeOffset = static_cast<int32_t>(bucket.data);
+    if (relativeOffset < 0) {
+      return false;
+    }
+    auto offset = dynamicDataOffset + relativeOffset;
+    auto payloadSize = getPayloadSize(data, size, offset);
+    if (payloadSize < 0) {
+      return false;
+    }
+    if (bucket.type == MapBuffer::String) {
+      continue;
+    }
+    auto payload = data + offset + sizeof(int32_t);
+    if (!isWellFormedMapBuffer(payload, payloadSize, depth + 1) &&
+        !isWellFormedMapBufferList(payload, payloadSize, depth + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isWellFormedMapBuffer(uint8_t const* data, size_t size) {
+  return isWellFormedMapBuffer(data, size, 0);
+}
+
+} // namespace rnoh
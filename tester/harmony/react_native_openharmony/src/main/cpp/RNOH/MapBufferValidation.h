@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rnoh {
+
+/**
+ * Checks whether `data` holds a MapBuffer which
+ * facebook::react::MapBuffer can read without going out of bounds. The
+ * payloads of Map buckets are checked recursively. A Map bucket may contain
+ * a nested MapBuffer or a list of MapBuffers. The bucket type doesn't say
+ * which, so a payload is accepted if it's well-formed as either.
+ */
+bool isWellFormedMapBuffer(uint8_t const* data, size_t size);
+
+} // namespace rnoh
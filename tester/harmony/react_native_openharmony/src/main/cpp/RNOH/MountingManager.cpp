@@ -2,6 +2,7 @@
 
 #include <glog/logging.h>
 #include "MountingManager.h"
+#include "RNOH/Performance/HarmonyReactMarker.h"
 
 namespace rnoh {
 
@@ -65,23 +66,73 @@ void MountingManager::performTransaction(
         // Mounting
         performMountInstructions(transaction.getMutations(), surfaceId);
       },
-      [this](
+      [this, surfaceId](
           react::MountingTransaction const& transaction,
           react::SurfaceTelemetry const& surfaceTelemetry) {
         // Did mount
-        this->processMutations(transaction.getMutations());
+        this->processMutations(
+            transaction.getMutations(),
+            surfaceTelemetryAggregator->sampleTransaction(transaction));
+        this->finishTransaction(surfaceId);
       });
 }
 
 void MountingManager::processMutations(
-    facebook::react::ShadowViewMutationList mutations) {
+    facebook::react::ShadowViewMutationList mutations,
+    std::optional<SurfaceTelemetryAggregator::TransactionSample> sample) {
+  // the list is moved into the callback, so it's released as soon as the
+  // mutations are mounted
   taskExecutor->runTask(
       TaskThread::MAIN,
-      [triggerUICallback = this->triggerUICallback, mutations = mutations] {
-        triggerUICallback(mutations);
+      [triggerUICallback = this->triggerUICallback,
+       surfaceTelemetryAggregator = this->surfaceTelemetryAggregator,
+       mutations = std::move(mutations),
+       sample = std::move(sample)]() mutable {
+        if (!sample.has_value()) {
+          triggerUICallback(std::move(mutations));
+          return;
+        }
+        auto mountStartTime = react::telemetryTimePointNow();
+        triggerUICallback(std::move(mutations));
+        surfaceTelemetryAggregator->recordMount(
+            sample.value(), mountStartTime, react::telemetryTimePointNow());
       });
 }
 
+void MountingManager::finishTransaction(react::SurfaceId surfaceId) {
+  {
+    std::lock_guard<std::mutex> lock(mountedSurfaceIdsMutex);
+    if (!mountedSurfaceIds.insert(surfaceId).second) {
+      return;
+    }
+  }
+  // MAIN thread tasks are executed in order, so this runs after the mutations
+  // were applied
+  taskExecutor->runTask(TaskThread::MAIN, [surfaceId] {
+    auto markerTag = std::to_string(surfaceId);
+    HarmonyReactMarker::logMarker("FIRST_SURFACE_MOUNT", markerTag);
+    HarmonyReactMarker::logMarkerOnNextFrame("FIRST_FRAME", markerTag);
+  });
+}
+
+void MountingManager::clearSurface(react::SurfaceId surfaceId) {
+  {
+    std::lock_guard<std::mutex> lock(mountedSurfaceIdsMutex);
+    mountedSurfaceIds.erase(surfaceId);
+  }
+  // sampled mounts are recorded on the MAIN thread, so the stats are removed
+  // there, after the mounts of the last transactions
+  taskExecutor->runTask(
+      TaskThread::MAIN,
+      [surfaceTelemetryAggregator = this->surfaceTelemetryAggregator,
+       surfaceId] { surfaceTelemetryAggregator->removeSurface(surfaceId); });
+}
+
+SurfaceTelemetryAggregator::Shared const&
+MountingManager::getSurfaceTelemetryAggregator() {
+  return surfaceTelemetryAggregator;
+}
+
 void MountingManager::dispatchCommand(
     facebook::react::Tag tag,
     std::string const& commandName,
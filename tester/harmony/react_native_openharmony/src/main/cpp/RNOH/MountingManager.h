@@ -1,6 +1,9 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
 
 #include <react/renderer/components/modal/ModalHostViewState.h>
 #include <react/renderer/components/root/RootShadowNode.h>
@@ -11,6 +14,7 @@
 #include <react/renderer/mounting/TelemetryController.h>
 
 #include "RNOH/MutationsToNapiConverter.h"
+#include "RNOH/Performance/SurfaceTelemetryAggregator.h"
 #include "RNOH/ShadowViewRegistry.h"
 #include "RNOH/TaskExecutor/TaskExecutor.h"
 
@@ -30,11 +34,13 @@ class MountingManager {
       TaskExecutor::Shared taskExecutor,
       ShadowViewRegistry::Shared shadowViewRegistry,
       TriggerUICallback&& triggerUICallback,
-      CommandDispatcher&& commandDispatcher)
+      CommandDispatcher&& commandDispatcher,
+      SurfaceTelemetryAggregator::Shared surfaceTelemetryAggregator)
       : taskExecutor(std::move(taskExecutor)),
         shadowViewRegistry(std::move(shadowViewRegistry)),
         triggerUICallback(std::move(triggerUICallback)),
-        commandDispatcher(std::move(commandDispatcher)) {}
+        commandDispatcher(std::move(commandDispatcher)),
+        surfaceTelemetryAggregator(std::move(surfaceTelemetryAggregator)) {}
 
   void performMountInstructions(
       facebook::react::ShadowViewMutationList const& mutations,
@@ -51,13 +57,38 @@ class MountingManager {
       std::string const& commandName,
       folly::dynamic const args);
 
-  void processMutations(facebook::react::ShadowViewMutationList mutations);
+  /**
+   * If the transaction was sampled, the MAIN thread mount is recorded in the
+   * surface telemetry.
+   */
+  void processMutations(
+      facebook::react::ShadowViewMutationList mutations,
+      std::optional<SurfaceTelemetryAggregator::TransactionSample> sample =
+          std::nullopt);
+
+  /**
+   * Must be called after the mutations of a transaction were scheduled on the
+   * MAIN thread. Logs markers for the first mount of the surface.
+   */
+  void finishTransaction(facebook::react::SurfaceId surfaceId);
+
+  /**
+   * Called when the surface is stopped or destroyed. Its first mount is
+   * logged again if it's restarted, and its telemetry is removed after the
+   * mutations scheduled before were applied.
+   */
+  void clearSurface(facebook::react::SurfaceId surfaceId);
+
+  SurfaceTelemetryAggregator::Shared const& getSurfaceTelemetryAggregator();
 
  private:
   TaskExecutor::Shared taskExecutor;
   ShadowViewRegistry::Shared shadowViewRegistry;
   TriggerUICallback triggerUICallback;
   CommandDispatcher commandDispatcher;
+  SurfaceTelemetryAggregator::Shared surfaceTelemetryAggregator;
+  std::mutex mountedSurfaceIdsMutex;
+  std::unordered_set<facebook::react::SurfaceId> mountedSurfaceIds;
 };
 
 } // namespace rnoh
\ No newline at end of file
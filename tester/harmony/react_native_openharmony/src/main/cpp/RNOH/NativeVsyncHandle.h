@@ -36,8 +36,12 @@ class NativeVsyncHandle {
     }
   }
 
-  void requestFrame(OH_NativeVSync_FrameCallback callback, void* data) {
-    OH_NativeVSync_RequestFrame(m_nativeVSync, callback, data);
+  /**
+   * Returns false if the frame couldn't be requested, in which case the
+   * callback is never called.
+   */
+  bool requestFrame(OH_NativeVSync_FrameCallback callback, void* data) {
+    return OH_NativeVSync_RequestFrame(m_nativeVSync, callback, data) == 0;
   }
 
   std::string m_name;
@@ -1,4 +1,6 @@
 #include "HarmonyReactMarker.h"
+#include <glog/logging.h>
+#include "RNOH/NativeVsyncHandle.h"
 
 namespace rnoh {
 void HarmonyReactMarker::setLogPerfMarkerIfNeeded() {
@@ -28,23 +30,50 @@ int32_t getMessageId(const std::string& message) {
   return small_hash;
 };
 
-void HarmonyReactMarker::logMarker(const std::string& marker) {
-  OH_HiTrace_StartTrace(makeMessage(marker, "").c_str());
+void HarmonyReactMarker::logMarker(
+    const std::string& marker,
+    const std::string& tag) {
+  StartupTimeline::getInstance().markPoint(marker, tag);
+  OH_HiTrace_StartTrace(makeMessage(marker, tag).c_str());
   OH_HiTrace_FinishTrace();
 }
 
 void HarmonyReactMarker::logMarkerStart(
     const std::string& marker,
     const std::string& tag) {
-  auto message = makeMessage(marker, tag).c_str();
-  OH_HiTrace_StartAsyncTrace(message, getMessageId(message));
+  StartupTimeline::getInstance().markPhaseStart(marker, tag);
+  auto message = makeMessage(marker, tag);
+  OH_HiTrace_StartAsyncTrace(message.c_str(), getMessageId(message));
 }
 
 void HarmonyReactMarker::logMarkerFinish(
     const std::string& marker,
     const std::string& tag) {
-  auto message = makeMessage(marker, tag).c_str();
-  OH_HiTrace_FinishAsyncTrace(message, getMessageId(message));
+  StartupTimeline::getInstance().markPhaseFinish(marker, tag);
+  auto message = makeMessage(marker, tag);
+  OH_HiTrace_FinishAsyncTrace(message.c_str(), getMessageId(message));
+}
+
+void HarmonyReactMarker::logMarkerOnNextFrame(
+    const std::string& marker,
+    const std::string& tag) {
+  // never destroyed, so pending frame callbacks can't outlive it
+  static auto vsyncHandle = new NativeVsyncHandle("HarmonyReactMarker");
+  auto markerAndTag = new std::pair<std::string, std::string>(marker, tag);
+  auto requested = vsyncHandle->requestFrame(
+      [](long long timestamp, void* data) {
+        auto markerAndTag =
+            static_cast<std::pair<std::string, std::string>*>(data);
+        HarmonyReactMarker::logMarker(
+            markerAndTag->first, markerAndTag->second);
+        delete markerAndTag;
+      },
+      markerAndTag);
+  if (!requested) {
+    // the callback won't run, so it can't free the pair
+    delete markerAndTag;
+    LOG(WARNING) << "Couldn't request a frame for marker " << marker;
+  }
 }
 
 void HarmonyReactMarker::logPerfMarker(
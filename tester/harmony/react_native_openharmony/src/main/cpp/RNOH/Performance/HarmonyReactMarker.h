@@ -4,23 +4,34 @@
 #include <string>
 
 #include <cxxreact/ReactMarker.h>
+#include "RNOH/Performance/StartupTimeline.h"
 #include "hitrace/trace.h"
 
 using namespace facebook::react;
 
 namespace rnoh {
+/**
+ * Forwards markers to HiTrace and records them in the StartupTimeline.
+ */
 class HarmonyReactMarker {
  public:
   static void setLogPerfMarkerIfNeeded();
-  static void logMarker(const std::string& marker);
-  static void setAppStartTime(double startTime);
-
- private:
-  static inline double sAppStartTime = 0.0;
+  static void logMarker(const std::string& marker, const std::string& tag = "");
   static void logMarkerStart(const std::string& marker, const std::string& tag);
   static void logMarkerFinish(
       const std::string& marker,
       const std::string& tag);
+  /**
+   * Logs the marker on the next vsync, which approximates the time at which
+   * changes made in the current MAIN thread task are displayed.
+   */
+  static void logMarkerOnNextFrame(
+      const std::string& marker,
+      const std::string& tag);
+  static void setAppStartTime(double startTime);
+
+ private:
+  static inline double sAppStartTime = 0.0;
 
   static void logPerfMarker(
       const ReactMarker::ReactMarkerId markerId,
@@ -0,0 +1,72 @@
+#include "RNOH/Performance/Histogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace rnoh {
+
+void Histogram::record(uint64_t value) {
+  m_countByBucket[getBucketIndex(value)]++;
+  m_count++;
+  m_sum += value;
+  m_min = std::min(m_min, value);
+  m_max = std::max(m_max, value);
+}
+
+uint64_t Histogram::getPercentile(double percentile) const {
+  if (m_count == 0) {
+    return 0;
+  }
+  auto rank = std::max<uint64_t>(
+      static_cast<uint64_t>(std::ceil(percentile / 100 * m_count)), 1);
+  uint64_t cumulativeCount = 0;
+  for (size_t i = 0; i < BUCKETS_COUNT; i++) {
+    cumulativeCount += m_countByBucket[i];
+    if (cumulativeCount >= rank) {
+      // the last bucket is unbounded, values above UINT32_MAX fall into it
+      if (i == BUCKETS_COUNT - 1) {
+        return m_max;
+      }
+      return std::clamp(getBucketUpperBound(i), m_min, m_max);
+    }
+  }
+  return m_max;
+}
+
+uint64_t Histogram::getCount() const {
+  return m_count;
+}
+
+uint64_t Histogram::getMin() const {
+  return m_count == 0 ? 0 : m_min;
+}
+
+uint64_t Histogram::getMax() const {
+  return m_max;
+}
+
+double Histogram::getMean() const {
+  return m_count == 0 ? 0 : static_cast<double>(m_sum) / m_count;
+}
+
+size_t Histogram::getBucketIndex(uint64_t value) {
+  value = std::min<uint64_t>(value, UINT32_MAX);
+  if (value < 4) {
+    return value;
+  }
+  // the two bits after the most significant one select one of four buckets
+  // of the power of two
+  size_t exponent = 63 - __builtin_clzll(value);
+  size_t subBucketIndex = (value >> (exponent - 2)) & 3;
+  return 4 * (exponent - 1) + subBucketIndex;
+}
+
+uint64_t Histogram::getBucketUpperBound(size_t bucketIndex) {
+  if (bucketIndex < 4) {
+    return bucketIndex;
+  }
+  size_t exponent = bucketIndex / 4 + 1;
+  size_t subBucketIndex = bucketIndex % 4;
+  return ((5 + static_cast<uint64_t>(subBucketIndex)) << (exponent - 2)) - 1;
+}
+
+} // namespace rnoh
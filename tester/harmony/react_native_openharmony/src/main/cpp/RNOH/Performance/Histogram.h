@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace rnoh {
+
+/**
+ * Values are bucketed logarithmically, with four buckets per power of two,
+ * so percentiles are approximated with an error of at most 25%. Values above
+ * UINT32_MAX fall into the last bucket, whose percentiles are reported as the
+ * max. Doesn't depend on platform APIs, so it can be used in host builds.
+ */
+class Histogram {
+ public:
+  void record(uint64_t value);
+  uint64_t getPercentile(double percentile) const;
+  uint64_t getCount() const;
+  uint64_t getMin() const;
+  uint64_t getMax() const;
+  double getMean() const;
+
+ private:
+  static constexpr size_t BUCKETS_COUNT = 124;
+
+  static size_t getBucketIndex(uint64_t value);
+  static uint64_t getBucketUpperBound(size_t bucketIndex);
+
+  std::array<uint32_t, BUCKETS_COUNT> m_countByBucket{};
+  uint64_t m_count = 0;
+  uint64_t m_sum = 0;
+  uint64_t m_min = UINT64_MAX;
+  uint64_t m_max = 0;
+};
+
+} // namespace rnoh
@@ -1,4 +1,5 @@
 #include "RNOH/Performance/NativeTracing.h"
+#include "RNOH/Performance/StartupTimeline.h"
 #include "hitrace/trace.h"
 
 using namespace facebook::jsi;
@@ -100,6 +101,19 @@ void rnoh::setupTracing(jsi::Runtime& runtime) {
         OH_HiTrace_CountTrace(traceMessage.c_str(), value);
         return Value::undefined();
       });
+  auto nativeGetStartupTimeline = Function::createFromHostFunction(
+      runtime,
+      PropNameID::forAscii(runtime, "nativeGetStartupTimeline"),
+      0,
+      [](jsi::Runtime& runtime,
+         const jsi::Value&,
+         const jsi::Value* args,
+         size_t count) {
+        return Value(
+            runtime,
+            String::createFromUtf8(
+                runtime, StartupTimeline::getInstance().toJSON()));
+      });
   runtime.global().setProperty(
       runtime, "nativeTraceIsTracing", nativeTraceIsTracing);
   runtime.global().setProperty(
@@ -112,4 +126,6 @@ void rnoh::setupTracing(jsi::Runtime& runtime) {
       runtime, "nativeTraceEndAsyncSection", nativeTraceEndAsyncSection);
   runtime.global().setProperty(
       runtime, "nativeTraceCounter", nativeTraceCounter);
+  runtime.global().setProperty(
+      runtime, "nativeGetStartupTimeline", nativeGetStartupTimeline);
 }
@@ -0,0 +1,201 @@
+#include "RNOH/Performance/StartupTimeline.h"
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace rnoh {
+
+static uint64_t getCurrentThreadId() {
+  static thread_local uint64_t threadId = syscall(SYS_gettid);
+  return threadId;
+}
+
+static void appendJSONString(std::string& json, std::string const& str) {
+  json += '"';
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        json += "\\\"";
+        break;
+      case '\\':
+        json += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[7];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          json += escaped;
+        } else {
+          json += c;
+        }
+    }
+  }
+  json += '"';
+}
+
+static void appendMilliseconds(
+    std::string& json,
+    StartupTimeline::Clock::time_point time,
+    StartupTimeline::Clock::time_point originTime) {
+  std::chrono::duration<double, std::milli> milliseconds = time - originTime;
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f", milliseconds.count());
+  json += buffer;
+}
+
+size_t StartupTimeline::readPeakRSSInKB() {
+  auto file = std::fopen("/proc/self/status", "r");
+  if (file == nullptr) {
+    return 0;
+  }
+  size_t peakRSSInKB = 0;
+  char line[128];
+  while (std::fgets(line, sizeof(line), file) != nullptr) {
+    if (std::strncmp(line, "VmHWM:", 6) == 0) {
+      peakRSSInKB = std::strtoull(line + 6, nullptr, 10);
+      break;
+    }
+  }
+  std::fclose(file);
+  return peakRSSInKB;
+}
+
+StartupTimeline& StartupTimeline::getInstance() {
+  static StartupTimeline instance;
+  return instance;
+}
+
+StartupTimeline::StartupTimeline() : m_originTime(Clock::now()) {}
+
+void StartupTimeline::markPhaseStart(
+    std::string const& name,
+    std::string const& tag) {
+  auto now = Clock::now();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_phases.size() >= MAX_PHASES_COUNT || findPhase(name, tag) != nullptr) {
+    return;
+  }
+  addPhase(
+      {.name = name,
+       .tag = tag,
+       .startTime = now,
+       .finishTime = now,
+       .startThreadId = getCurrentThreadId(),
+       .finishThreadId = 0,
+       .finishPeakRSSInKB = 0,
+       .isFinished = false});
+}
+
+void StartupTimeline::markPhaseFinish(
+    std::string const& name,
+    std::string const& tag) {
+  auto now = Clock::now();
+  // read outside of the lock, it's a file read
+  auto peakRSSInKB = readPeakRSSInKB();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto phase = findPhase(name, tag);
+  if (phase == nullptr || phase->isFinished) {
+    return;
+  }
+  phase->finishTime = now;
+  phase->finishThreadId = getCurrentThreadId();
+  phase->finishPeakRSSInKB = peakRSSInKB;
+  phase->isFinished = true;
+}
+
+void StartupTimeline::markPoint(
+    std::string const& name,
+    std::string const& tag) {
+  auto now = Clock::now();
+  auto peakRSSInKB = readPeakRSSInKB();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_phases.size() >= MAX_PHASES_COUNT || findPhase(name, tag) != nullptr) {
+    return;
+  }
+  auto threadId = getCurrentThreadId();
+  addPhase(
+      {.name = name,
+       .tag = tag,
+       .startTime = now,
+       .finishTime = now,
+       .startThreadId = threadId,
+       .finishThreadId = threadId,
+       .finishPeakRSSInKB = peakRSSInKB,
+       .isFinished = true});
+}
+
+std::vector<StartupTimeline::Phase> StartupTimeline::getPhases() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_phases;
+}
+
+std::string StartupTimeline::toJSON() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::string json = "[";
+  for (size_t i = 0; i < m_phases.size(); i++) {
+    auto const& phase = m_phases[i];
+    if (i > 0) {
+      json += ',';
+    }
+    json += "{\"name\":";
+    appendJSONString(json, phase.name);
+    json += ",\"tag\":";
+    appendJSONString(json, phase.tag);
+    json += ",\"startTime\":";
+    appendMilliseconds(json, phase.startTime, m_originTime);
+    json += ",\"startThreadId\":" + std::to_string(phase.startThreadId);
+    if (phase.isFinished) {
+      json += ",\"finishTime\":";
+      appendMilliseconds(json, phase.finishTime, m_originTime);
+      json += ",\"finishThreadId\":" + std::to_string(phase.finishThreadId);
+      json += ",\"finishPeakRSSInKB\":" +
+          std::to_string(phase.finishPeakRSSInKB);
+    } else {
+      json +=
+          ",\"finishTime\":null,\"finishThreadId\":null"
+          ",\"finishPeakRSSInKB\":null";
+    }
+    json += '}';
+  }
+  json += ']';
+  return json;
+}
+
+void StartupTimeline::reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_phases.clear();
+  m_phaseIndexByKey.clear();
+  m_originTime = Clock::now();
+}
+
+std::string StartupTimeline::getPhaseKey(
+    std::string const& name,
+    std::string const& tag) {
+  // marker names don't contain NUL characters, so keys are unique
+  std::string key;
+  key.reserve(name.size() + tag.size() + 1);
+  key += name;
+  key += '\0';
+  key += tag;
+  return key;
+}
+
+StartupTimeline::Phase* StartupTimeline::findPhase(
+    std::string const& name,
+    std::string const& tag) {
+  auto it = m_phaseIndexByKey.find(getPhaseKey(name, tag));
+  if (it == m_phaseIndexByKey.end()) {
+    return nullptr;
+  }
+  return &m_phases[it->second];
+}
+
+void StartupTimeline::addPhase(Phase phase) {
+  m_phaseIndexByKey.emplace(
+      getPhaseKey(phase.name, phase.tag), m_phases.size());
+  m_phases.push_back(std::move(phase));
+}
+
+} // namespace rnoh
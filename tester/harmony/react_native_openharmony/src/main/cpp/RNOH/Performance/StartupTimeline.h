@@ -0,0 +1,83 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * Records startup phases with monotonic timestamps and ids of the threads on
+ * which they started and finished. Phases are identified by their name and
+ * tag, and only the first occurrence of a phase is recorded, so the timeline
+ * describes the startup even if markers keep being logged afterwards. The
+ * process's peak resident set size is sampled when phases finish, so the
+ * memory cost of each phase can be told apart. Doesn't depend on platform
+ * APIs, so it can be used in host builds.
+ */
+class StartupTimeline {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Phase {
+    std::string name;
+    std::string tag;
+    Clock::time_point startTime;
+    Clock::time_point finishTime;
+    uint64_t startThreadId;
+    uint64_t finishThreadId;
+    /**
+     * Peak resident set size of the process when the phase finished, 0 if it
+     * couldn't be read.
+     */
+    size_t finishPeakRSSInKB;
+    bool isFinished;
+  };
+
+  /**
+   * Reads VmHWM from /proc/self/status. Returns 0 if it isn't available.
+   */
+  static size_t readPeakRSSInKB();
+
+  static StartupTimeline& getInstance();
+
+  StartupTimeline();
+
+  void markPhaseStart(std::string const& name, std::string const& tag);
+  void markPhaseFinish(std::string const& name, std::string const& tag);
+
+  /**
+   * Records a phase which starts and finishes at the same time.
+   */
+  void markPoint(std::string const& name, std::string const& tag);
+
+  std::vector<Phase> getPhases() const;
+
+  /**
+   * Serializes phases in the order in which they started. Times are in
+   * milliseconds since the timeline was created or reset, unfinished phases
+   * have the finish time and peak RSS set to null.
+   */
+  std::string toJSON() const;
+
+  void reset();
+
+ private:
+  static constexpr size_t MAX_PHASES_COUNT = 512;
+
+  static std::string getPhaseKey(
+      std::string const& name,
+      std::string const& tag);
+
+  Phase* findPhase(std::string const& name, std::string const& tag);
+  void addPhase(Phase phase);
+
+  mutable std::mutex m_mutex;
+  Clock::time_point m_originTime;
+  std::vector<Phase> m_phases;
+  std::unordered_map<std::string, size_t> m_phaseIndexByKey;
+};
+
+} // namespace rnoh
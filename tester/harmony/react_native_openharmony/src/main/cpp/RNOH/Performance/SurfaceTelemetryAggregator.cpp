@@ -0,0 +1,168 @@
+#include "RNOH/Performance/SurfaceTelemetryAggregator.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace rnoh {
+
+using namespace facebook;
+
+static uint64_t toMicroseconds(react::TelemetryDuration duration) {
+  return std::max<int64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count(),
+      0);
+}
+
+static react::TelemetryDuration getDuration(
+    react::TelemetryTimePoint startTime,
+    react::TelemetryTimePoint endTime) {
+  if (startTime == react::kTelemetryUndefinedTimePoint ||
+      endTime == react::kTelemetryUndefinedTimePoint) {
+    return react::TelemetryDuration{0};
+  }
+  return endTime - startTime;
+}
+
+static void appendMilliseconds(std::string& json, double microseconds) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.3f", microseconds / 1000);
+  json += buffer;
+}
+
+static void appendHistogram(
+    std::string& json,
+    char const* name,
+    SurfaceTelemetryAggregator::Histogram const& histogram,
+    bool isDuration) {
+  auto appendValue = [&](double value) {
+    if (isDuration) {
+      appendMilliseconds(json, value);
+    } else {
+      char buffer[32];
+      std::snprintf(buffer, sizeof(buffer), "%.0f", value);
+      json += buffer;
+    }
+  };
+  json += ",\"";
+  json += name;
+  json += "\":{\"count\":" + std::to_string(histogram.getCount());
+  if (histogram.getCount() == 0) {
+    json += '}';
+    return;
+  }
+  json += ",\"min\":";
+  appendValue(histogram.getMin());
+  json += ",\"max\":";
+  appendValue(histogram.getMax());
+  json += ",\"mean\":";
+  if (isDuration) {
+    appendMilliseconds(json, histogram.getMean());
+  } else {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.2f", histogram.getMean());
+    json += buffer;
+  }
+  json += ",\"p50\":";
+  appendValue(histogram.getPercentile(50));
+  json += ",\"p95\":";
+  appendValue(histogram.getPercentile(95));
+  json += ",\"p99\":";
+  appendValue(histogram.getPercentile(99));
+  json += '}';
+}
+
+void SurfaceTelemetryAggregator::setSamplingInterval(size_t samplingInterval) {
+  m_samplingInterval.store(samplingInterval, std::memory_order_relaxed);
+}
+
+std::optional<SurfaceTelemetryAggregator::TransactionSample>
+SurfaceTelemetryAggregator::sampleTransaction(
+    react::MountingTransaction const& transaction) {
+  auto samplingInterval = m_samplingInterval.load(std::memory_order_relaxed);
+  if (samplingInterval == 0) {
+    return std::nullopt;
+  }
+  if (m_transactionsCount.fetch_add(1, std::memory_order_relaxed) %
+          samplingInterval !=
+      0) {
+    return std::nullopt;
+  }
+  auto const& telemetry = transaction.getTelemetry();
+  return TransactionSample{
+      .surfaceId = transaction.getSurfaceId(),
+      .commitEndTime = telemetry.getCommitEndTime(),
+      .commitTime = getDuration(
+          telemetry.getCommitStartTime(), telemetry.getCommitEndTime()),
+      .diffTime = getDuration(
+          telemetry.getDiffStartTime(), telemetry.getDiffEndTime()),
+      .layoutTime = getDuration(
+          telemetry.getLayoutStartTime(), telemetry.getLayoutEndTime()),
+      .textMeasureTime = telemetry.getTextMeasureTime(),
+      .mutationsCount = transaction.getMutations().size()};
+}
+
+void SurfaceTelemetryAggregator::recordMount(
+    TransactionSample const& sample,
+    react::TelemetryTimePoint mountStartTime,
+    react::TelemetryTimePoint mountEndTime) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& stats = m_statsBySurfaceId[sample.surfaceId];
+  if (sample.commitEndTime != react::kTelemetryUndefinedTimePoint) {
+    stats.commitToMountLatency.record(
+        toMicroseconds(mountEndTime - sample.commitEndTime));
+  }
+  stats.commitTime.record(toMicroseconds(sample.commitTime));
+  stats.diffTime.record(toMicroseconds(sample.diffTime));
+  stats.layoutTime.record(toMicroseconds(sample.layoutTime));
+  stats.textMeasureTime.record(toMicroseconds(sample.textMeasureTime));
+  stats.mainThreadMountTime.record(
+      toMicroseconds(mountEndTime - mountStartTime));
+  stats.mutationsCount.record(sample.mutationsCount);
+}
+
+std::string SurfaceTelemetryAggregator::toJSON() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::string json = "[";
+  for (auto const& [surfaceId, stats] : m_statsBySurfaceId) {
+    if (json.size() > 1) {
+      json += ',';
+    }
+    json += "{\"surfaceId\":" + std::to_string(surfaceId);
+    appendHistogram(
+        json, "commitToMountLatency", stats.commitToMountLatency, true);
+    appendHistogram(json, "commitTime", stats.commitTime, true);
+    appendHistogram(json, "diffTime", stats.diffTime, true);
+    appendHistogram(json, "layoutTime", stats.layoutTime, true);
+    appendHistogram(json, "textMeasureTime", stats.textMeasureTime, true);
+    appendHistogram(
+        json, "mainThreadMountTime", stats.mainThreadMountTime, true);
+    appendHistogram(json, "mutationsCount", stats.mutationsCount, false);
+    json += '}';
+  }
+  json += ']';
+  return json;
+}
+
+bool SurfaceTelemetryAggregator::dumpToFile(std::string const& path) const {
+  auto json = toJSON();
+  std::ofstream file(path, std::ios::trunc);
+  file << json;
+  if (!file) {
+    LOG(ERROR) << "Couldn't dump surface telemetry to: " << path;
+    return false;
+  }
+  return true;
+}
+
+void SurfaceTelemetryAggregator::removeSurface(react::SurfaceId surfaceId) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_statsBySurfaceId.erase(surfaceId);
+}
+
+void SurfaceTelemetryAggregator::reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_statsBySurfaceId.clear();
+}
+
+} // namespace rnoh
@@ -0,0 +1,95 @@
+#pragma once
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/mounting/MountingTransaction.h>
+#include <react/utils/Telemetry.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include "RNOH/Performance/Histogram.h"
+
+namespace rnoh {
+
+/**
+ * Aggregates telemetry of mounting transactions per surface: commit-to-mount
+ * latency, mutations per transaction, layout, text measurement and MAIN thread
+ * mount durations. Sampling is disabled by default, in which case checking
+ * whether a transaction should be sampled is the only cost.
+ */
+class SurfaceTelemetryAggregator {
+ public:
+  using Shared = std::shared_ptr<SurfaceTelemetryAggregator>;
+
+  using Histogram = rnoh::Histogram;
+
+  /**
+   * Telemetry of a transaction which was picked for sampling. Copied out of
+   * the transaction, because the MAIN thread mount finishes after the
+   * transaction is destroyed.
+   */
+  struct TransactionSample {
+    facebook::react::SurfaceId surfaceId;
+    facebook::react::TelemetryTimePoint commitEndTime;
+    facebook::react::TelemetryDuration commitTime;
+    facebook::react::TelemetryDuration diffTime;
+    facebook::react::TelemetryDuration layoutTime;
+    facebook::react::TelemetryDuration textMeasureTime;
+    size_t mutationsCount;
+  };
+
+  struct SurfaceStats {
+    Histogram commitToMountLatency;
+    Histogram commitTime;
+    Histogram diffTime;
+    Histogram layoutTime;
+    Histogram textMeasureTime;
+    Histogram mainThreadMountTime;
+    Histogram mutationsCount;
+  };
+
+  /**
+   * Samples every n-th transaction, 0 disables sampling.
+   */
+  void setSamplingInterval(size_t samplingInterval);
+
+  /**
+   * Returns nullopt if the transaction isn't sampled.
+   */
+  std::optional<TransactionSample> sampleTransaction(
+      facebook::react::MountingTransaction const& transaction);
+
+  /**
+   * Called on the MAIN thread, after mutations of the sampled transaction
+   * were applied.
+   */
+  void recordMount(
+      TransactionSample const& sample,
+      facebook::react::TelemetryTimePoint mountStartTime,
+      facebook::react::TelemetryTimePoint mountEndTime);
+
+  /**
+   * Serializes stats of each surface. Durations are in milliseconds.
+   */
+  std::string toJSON() const;
+
+  bool dumpToFile(std::string const& path) const;
+
+  /**
+   * Removes stats of a stopped surface.
+   */
+  void removeSurface(facebook::react::SurfaceId surfaceId);
+
+  void reset();
+
+ private:
+  std::atomic<size_t> m_samplingInterval{0};
+  std::atomic<size_t> m_transactionsCount{0};
+  mutable std::mutex m_mutex;
+  std::unordered_map<facebook::react::SurfaceId, SurfaceStats>
+      m_statsBySurfaceId;
+};
+
+} // namespace rnoh
@@ -17,6 +17,7 @@
 #include "RNOH/EventEmitRequestHandler.h"
 #include "RNOH/GlobalJSIBinder.h"
 #include "RNOH/MessageQueueThread.h"
+#include "RNOH/Performance/SurfaceTelemetryAggregator.h"
 #include "RNOH/SchedulerDelegateArkTS.h"
 #include "RNOH/TaskExecutor/TaskExecutor.h"
 #include "RNOH/TurboModule.h"
@@ -57,11 +58,22 @@ class RNInstanceInternal : public RNInstance,
   virtual ~RNInstanceInternal() = default;
 
   virtual TaskExecutor::Shared getTaskExecutor() = 0;
+  virtual SurfaceTelemetryAggregator::Shared
+  getSurfaceTelemetryAggregator() = 0;
   virtual void start() = 0;
   virtual void loadScript(
-      std::vector<uint8_t>&& bundle,
+      std::unique_ptr<const facebook::react::JSBigString> bundle,
       std::string const sourceURL,
       std::function<void(const std::string)>&& onFinish) = 0;
+  virtual void loadScriptFromFile(
+      std::string const path,
+      std::string const sourceURL,
+      std::function<void(const std::string)>&& onFinish) = 0;
+  /**
+   * Registers a bundle segment, which is evaluated, or, if the main bundle is
+   * an indexed RAM bundle, from which modules are read on demand.
+   */
+  virtual void registerSegment(uint32_t segmentId, std::string const path) = 0;
   virtual void createSurface(
       facebook::react::Tag surfaceId,
       std::string const& moduleName) = 0;
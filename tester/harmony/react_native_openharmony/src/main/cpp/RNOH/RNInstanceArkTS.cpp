@@ -7,7 +7,9 @@
 #include <react/renderer/scheduler/Scheduler.h>
 #include "NativeLogger.h"
 #include "RNOH/EventBeat.h"
+#include "RNOH/JSBundle.h"
 #include "RNOH/MessageQueueThread.h"
+#include "RNOH/Performance/HarmonyReactMarker.h"
 #include "RNOH/Performance/NativeTracing.h"
 #include "RNOH/ShadowViewRegistry.h"
 #include "RNOH/TurboModuleFactory.h"
@@ -21,10 +23,22 @@ TaskExecutor::Shared RNInstanceArkTS::getTaskExecutor() {
   return taskExecutor;
 };
 
+SurfaceTelemetryAggregator::Shared
+RNInstanceArkTS::getSurfaceTelemetryAggregator() {
+  return m_mountingManager->getSurfaceTelemetryAggregator();
+}
+
 void RNInstanceArkTS::start() {
+  auto markerTag = std::to_string(m_id);
   this->initialize();
+  HarmonyReactMarker::logMarkerStart(
+      "CREATE_TURBO_MODULE_PROVIDER", markerTag);
   m_turboModuleProvider = this->createTurboModuleProvider();
+  HarmonyReactMarker::logMarkerFinish(
+      "CREATE_TURBO_MODULE_PROVIDER", markerTag);
+  HarmonyReactMarker::logMarkerStart("INITIALIZE_SCHEDULER", markerTag);
   this->initializeScheduler(m_turboModuleProvider);
+  HarmonyReactMarker::logMarkerFinish("INITIALIZE_SCHEDULER", markerTag);
   this->instance->getRuntimeExecutor()(
       [binders = this->m_globalJSIBinders,
        turboModuleProvider =
@@ -119,7 +133,7 @@ RNInstanceArkTS::createTurboModuleProvider() {
 }
 
 void RNInstanceArkTS::loadScript(
-    std::vector<uint8_t>&& bundle,
+    std::unique_ptr<const react::JSBigString> bundle,
     std::string const sourceURL,
     std::function<void(const std::string)>&& onFinish) {
   this->taskExecutor->runTask(
@@ -128,33 +142,44 @@ void RNInstanceArkTS::loadScript(
        bundle = std::move(bundle),
        sourceURL,
        onFinish = std::move(onFinish)]() mutable {
-        std::unique_ptr<react::JSBigBufferString> jsBundle;
-        jsBundle = std::make_unique<react::JSBigBufferString>(bundle.size());
-        memcpy(jsBundle->data(), bundle.data(), bundle.size());
-
-        react::BundleHeader header;
-        memcpy(&header, bundle.data(), sizeof(react::BundleHeader));
-        react::ScriptTag scriptTag = react::parseTypeFromHeader(header);
-        // NOTE: Hermes bytecode bundles are treated as String bundles,
-        // and don't throw an error here.
-        if (scriptTag != react::ScriptTag::String) {
-          throw new std::runtime_error("RAM bundles are not yet supported");
-        }
+        onFinish(runJSBundle(
+            *this->instance,
+            std::move(bundle),
+            sourceURL,
+            this->taskExecutor));
+      });
+}
+
+void RNInstanceArkTS::loadScriptFromFile(
+    std::string const path,
+    std::string const sourceURL,
+    std::function<void(const std::string)>&& onFinish) {
+  this->taskExecutor->runTask(
+      TaskThread::JS,
+      [this, path, sourceURL, onFinish = std::move(onFinish)]() {
+        std::unique_ptr<const react::JSBigString> jsBundle;
         try {
-          this->instance->loadScriptFromString(
-              std::move(jsBundle), sourceURL, true);
-          onFinish("");
+          jsBundle = loadJSBundleFromFile(path);
         } catch (std::exception const& e) {
-          try {
-            std::rethrow_if_nested(e);
-            onFinish(e.what());
-          } catch (const std::exception& nested) {
-            onFinish(e.what() + std::string("\n") + nested.what());
-          }
+          onFinish(e.what());
+          return;
         }
+        onFinish(runJSBundle(
+            *this->instance,
+            std::move(jsBundle),
+            sourceURL,
+            this->taskExecutor));
       });
 }
 
+void RNInstanceArkTS::registerSegment(
+    uint32_t segmentId,
+    std::string const path) {
+  this->taskExecutor->runTask(TaskThread::JS, [this, segmentId, path]() {
+    this->instance->registerBundle(segmentId, path);
+  });
+}
+
 void rnoh::RNInstanceArkTS::createSurface(
     react::Tag surfaceId,
     std::string const& appKey) {
@@ -234,6 +259,7 @@ void rnoh::RNInstanceArkTS::stopSurface(react::Tag surfaceId) {
     LOG(INFO) << "stopSurface: stopping " << surfaceId;
     try {
       surfaceHandle->stop();
+      m_mountingManager->clearSurface(surfaceId);
       LOG(INFO) << "stopSurface: stopped " << surfaceId;
     } catch (const std::exception& e) {
       LOG(ERROR) << "stopSurface: failed - " << e.what() << "\n";
@@ -251,6 +277,7 @@ void rnoh::RNInstanceArkTS::destroySurface(react::Tag surfaceId) {
     }
     scheduler->unregisterSurface(*it->second);
     surfaceHandlers.erase(it);
+    m_mountingManager->clearSurface(surfaceId);
   });
 }
 
@@ -331,9 +358,7 @@ void rnoh::RNInstanceArkTS::emitComponentEvent(
     m_eventDispatcher->sendEvent(ctx);
   }
 
-  for (auto& eventEmitRequestHandler : m_eventEmitRequestHandlers) {
-    eventEmitRequestHandler->handleEvent(ctx);
-  }
+  m_eventEmitRequestHandlerRegistry.handleEvent(ctx);
 }
 
 void rnoh::RNInstanceArkTS::onMemoryLevel(size_t memoryLevel) {
@@ -20,8 +20,11 @@
 #include "RNOH/ArkTSMessageHandler.h"
 #include "RNOH/EventDispatcher.h"
 #include "RNOH/EventEmitRequestHandler.h"
+#include "RNOH/EventEmitRequestHandlerRegistry.h"
 #include "RNOH/GlobalJSIBinder.h"
 #include "RNOH/MessageQueueThread.h"
+#include "RNOH/MountingManager.h"
+#include "RNOH/Performance/SurfaceTelemetryAggregator.h"
 #include "RNOH/RNInstance.h"
 #include "RNOH/SchedulerDelegateArkTS.h"
 #include "RNOH/ShadowViewRegistry.h"
@@ -50,6 +53,7 @@ class RNInstanceArkTS : public RNInstanceInternal,
       GlobalJSIBinders globalJSIBinders,
       UITicker::Shared uiTicker,
       ShadowViewRegistry::Shared shadowViewRegistry,
+      MountingManager::Shared mountingManager,
       ArkTSChannel::Shared arkTSChannel,
       std::unique_ptr<facebook::react::SchedulerDelegate> schedulerDelegate,
       std::vector<ArkTSMessageHandler::Shared> arkTSMessageHandlers,
@@ -62,11 +66,12 @@ class RNInstanceArkTS : public RNInstanceInternal,
         scheduler(nullptr),
         taskExecutor(taskExecutor),
         m_shadowViewRegistry(shadowViewRegistry),
+        m_mountingManager(std::move(mountingManager)),
         m_turboModuleFactory(std::move(turboModuleFactory)),
         m_componentDescriptorProviderRegistry(
             componentDescriptorProviderRegistry),
         m_mutationsToNapiConverter(mutationsToNapiConverter),
-        m_eventEmitRequestHandlers(eventEmitRequestHandlers),
+        m_eventEmitRequestHandlerRegistry(eventEmitRequestHandlers),
         m_globalJSIBinders(globalJSIBinders),
         m_shouldRelayUITick(false),
         m_uiTicker(uiTicker),
@@ -111,12 +116,18 @@ class RNInstanceArkTS : public RNInstanceInternal,
   }
 
   TaskExecutor::Shared getTaskExecutor() override;
+  SurfaceTelemetryAggregator::Shared getSurfaceTelemetryAggregator() override;
 
   void start() override;
   void loadScript(
-      std::vector<uint8_t>&& bundle,
+      std::unique_ptr<const facebook::react::JSBigString> bundle,
       std::string const sourceURL,
       std::function<void(const std::string)>&& onFinish) override;
+  void loadScriptFromFile(
+      std::string const path,
+      std::string const sourceURL,
+      std::function<void(const std::string)>&& onFinish) override;
+  void registerSegment(uint32_t segmentId, std::string const path) override;
   void createSurface(
       facebook::react::Tag surfaceId,
       std::string const& moduleName) override;
@@ -187,10 +198,11 @@ class RNInstanceArkTS : public RNInstanceInternal,
   std::shared_ptr<facebook::react::ComponentDescriptorProviderRegistry>
       m_componentDescriptorProviderRegistry;
   ShadowViewRegistry::Shared m_shadowViewRegistry;
+  MountingManager::Shared m_mountingManager;
   TurboModuleFactory m_turboModuleFactory;
   std::shared_ptr<EventDispatcher> m_eventDispatcher;
   MutationsToNapiConverter::Shared m_mutationsToNapiConverter;
-  EventEmitRequestHandlers m_eventEmitRequestHandlers;
+  EventEmitRequestHandlerRegistry m_eventEmitRequestHandlerRegistry;
   GlobalJSIBinders m_globalJSIBinders;
   std::shared_ptr<facebook::react::LayoutAnimationDriver> m_animationDriver;
   UITicker::Shared m_uiTicker;
@@ -4,11 +4,15 @@
 #include <react/renderer/animations/LayoutAnimationDriver.h>
 #include <react/renderer/componentregistry/ComponentDescriptorProvider.h>
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
 #include <react/renderer/scheduler/Scheduler.h>
 #include "NativeLogger.h"
 #include "RNInstanceArkTS.h"
 #include "RNOH/EventBeat.h"
+#include "RNOH/JSBundle.h"
 #include "RNOH/MessageQueueThread.h"
+#include "RNOH/Performance/HarmonyReactMarker.h"
 #include "RNOH/Performance/NativeTracing.h"
 #include "RNOH/ShadowViewRegistry.h"
 #include "RNOH/TurboModuleFactory.h"
@@ -23,11 +27,31 @@ TaskExecutor::Shared RNInstanceCAPI::getTaskExecutor() {
   return taskExecutor;
 };
 
+SurfaceTelemetryAggregator::Shared
+RNInstanceCAPI::getSurfaceTelemetryAggregator() {
+  return m_mountingManager->getSurfaceTelemetryAggregator();
+}
+
+ContinuousEventCoalescer::Shared
+RNInstanceCAPI::getContinuousEventCoalescer() {
+  return m_continuousEventCoalescer;
+}
+
 void RNInstanceCAPI::start() {
   DLOG(INFO) << "RNInstanceCAPI::start";
+  auto markerTag = std::to_string(m_id);
   this->initialize();
+  this->initializeRuntimeScheduler();
+  m_continuousEventCoalescer->setRuntimeExecutor(
+      this->createRuntimeExecutor());
+  HarmonyReactMarker::logMarkerStart(
+      "CREATE_TURBO_MODULE_PROVIDER", markerTag);
   m_turboModuleProvider = this->createTurboModuleProvider();
+  HarmonyReactMarker::logMarkerFinish(
+      "CREATE_TURBO_MODULE_PROVIDER", markerTag);
+  HarmonyReactMarker::logMarkerStart("INITIALIZE_SCHEDULER", markerTag);
   this->initializeScheduler(m_turboModuleProvider);
+  HarmonyReactMarker::logMarkerFinish("INITIALIZE_SCHEDULER", markerTag);
   this->instance->getRuntimeExecutor()(
       [binders = this->m_globalJSIBinders,
        turboModuleProvider =
@@ -65,6 +89,34 @@ void RNInstanceCAPI::initialize() {
       std::move(moduleRegistry));
 }
 
+void RNInstanceCAPI::initializeRuntimeScheduler() {
+  DLOG(INFO) << "RNInstanceCAPI::initializeRuntimeScheduler";
+  m_runtimeScheduler = std::make_shared<react::RuntimeScheduler>(
+      m_runtimeSchedulerFrameDeadline->wrapRuntimeExecutor(
+          this->instance->getRuntimeExecutor()));
+  m_runtimeSchedulerFrameDeadline->setRuntimeScheduler(m_runtimeScheduler);
+  // react::Scheduler looks it up to call expired tasks after dispatching
+  // events and to schedule mounting
+  m_contextContainer->insert(
+      "RuntimeScheduler",
+      std::weak_ptr<react::RuntimeScheduler>(m_runtimeScheduler));
+  this->instance->getRuntimeExecutor()(
+      [runtimeScheduler = m_runtimeScheduler](jsi::Runtime& rt) {
+        // exposes `nativeRuntimeScheduler`, used by React's scheduler
+        react::RuntimeSchedulerBinding::createAndInstallIfNeeded(
+            rt, runtimeScheduler);
+      });
+}
+
+react::RuntimeExecutor RNInstanceCAPI::createRuntimeExecutor() {
+  return [weakRuntimeScheduler = std::weak_ptr(m_runtimeScheduler)](
+             std::function<void(jsi::Runtime&)>&& callback) {
+    if (auto runtimeScheduler = weakRuntimeScheduler.lock()) {
+      runtimeScheduler->scheduleWork(std::move(callback));
+    }
+  };
+}
+
 void RNInstanceCAPI::initializeScheduler(
     std::shared_ptr<TurboModuleProvider> turboModuleProvider) {
   DLOG(INFO) << "RNInstanceCAPI::initializeScheduler";
@@ -73,7 +125,7 @@ void RNInstanceCAPI::initializeScheduler(
 
   react::EventBeat::Factory eventBeatFactory =
       [taskExecutor = std::weak_ptr(taskExecutor),
-       runtimeExecutor = this->instance->getRuntimeExecutor()](auto ownerBox) {
+       runtimeExecutor = this->createRuntimeExecutor()](auto ownerBox) {
         return std::make_unique<EventBeat>(
             taskExecutor, runtimeExecutor, ownerBox);
       };
@@ -88,7 +140,7 @@ void RNInstanceCAPI::initializeScheduler(
   react::SchedulerToolbox schedulerToolbox{
       .contextContainer = m_contextContainer,
       .componentRegistryFactory = componentRegistryFactory,
-      .runtimeExecutor = this->instance->getRuntimeExecutor(),
+      .runtimeExecutor = this->createRuntimeExecutor(),
       .asynchronousEventBeatFactory = eventBeatFactory,
       .synchronousEventBeatFactory = eventBeatFactory,
   };
@@ -106,7 +158,7 @@ void RNInstanceCAPI::initializeScheduler(
   }
 
   m_animationDriver = std::make_shared<react::LayoutAnimationDriver>(
-      this->instance->getRuntimeExecutor(), m_contextContainer, this);
+      this->createRuntimeExecutor(), m_contextContainer, this);
   this->scheduler = std::make_shared<react::Scheduler>(
       schedulerToolbox, m_animationDriver.get(), m_schedulerDelegate.get());
   turboModuleProvider->setScheduler(this->scheduler);
@@ -117,8 +169,10 @@ std::shared_ptr<TurboModuleProvider>
 RNInstanceCAPI::createTurboModuleProvider() {
   DLOG(INFO) << "RNInstanceCAPI::createTurboModuleProvider";
   auto sharedInstance = shared_from_this();
+  // callbacks and promises of TurboModules are resolved through
+  // RuntimeScheduler, like the rest of the runtime work
   auto turboModuleProvider = std::make_shared<TurboModuleProvider>(
-      this->instance->getJSCallInvoker(),
+      std::make_shared<react::RuntimeSchedulerCallInvoker>(m_runtimeScheduler),
       std::move(m_turboModuleFactory),
       m_eventDispatcher,
       std::move(m_jsQueue),
@@ -128,7 +182,7 @@ RNInstanceCAPI::createTurboModuleProvider() {
 }
 
 void RNInstanceCAPI::loadScript(
-    std::vector<uint8_t>&& bundle,
+    std::unique_ptr<const react::JSBigString> bundle,
     std::string const sourceURL,
     std::function<void(const std::string)>&& onFinish) {
   DLOG(INFO) << "RNInstanceCAPI::loadScript";
@@ -138,33 +192,46 @@ void RNInstanceCAPI::loadScript(
        bundle = std::move(bundle),
        sourceURL,
        onFinish = std::move(onFinish)]() mutable {
-        std::unique_ptr<react::JSBigBufferString> jsBundle;
-        jsBundle = std::make_unique<react::JSBigBufferString>(bundle.size());
-        memcpy(jsBundle->data(), bundle.data(), bundle.size());
-
-        react::BundleHeader header;
-        memcpy(&header, bundle.data(), sizeof(react::BundleHeader));
-        react::ScriptTag scriptTag = react::parseTypeFromHeader(header);
-        // NOTE: Hermes bytecode bundles are treated as String bundles,
-        // and don't throw an error here.
-        if (scriptTag != react::ScriptTag::String) {
-          throw new std::runtime_error("RAM bundles are not yet supported");
-        }
+        onFinish(runJSBundle(
+            *this->instance,
+            std::move(bundle),
+            sourceURL,
+            this->taskExecutor));
+      });
+}
+
+void RNInstanceCAPI::loadScriptFromFile(
+    std::string const path,
+    std::string const sourceURL,
+    std::function<void(const std::string)>&& onFinish) {
+  DLOG(INFO) << "RNInstanceCAPI::loadScriptFromFile";
+  this->taskExecutor->runTask(
+      TaskThread::JS,
+      [this, path, sourceURL, onFinish = std::move(onFinish)]() {
+        std::unique_ptr<const react::JSBigString> jsBundle;
         try {
-          this->instance->loadScriptFromString(
-              std::move(jsBundle), sourceURL, true);
-          onFinish("");
+          jsBundle = loadJSBundleFromFile(path);
         } catch (std::exception const& e) {
-          try {
-            std::rethrow_if_nested(e);
-            onFinish(e.what());
-          } catch (const std::exception& nested) {
-            onFinish(e.what() + std::string("\n") + nested.what());
-          }
+          onFinish(e.what());
+          return;
         }
+        onFinish(runJSBundle(
+            *this->instance,
+            std::move(jsBundle),
+            sourceURL,
+            this->taskExecutor));
       });
 }
 
+void RNInstanceCAPI::registerSegment(
+    uint32_t segmentId,
+    std::string const path) {
+  DLOG(INFO) << "RNInstanceCAPI::registerSegment";
+  this->taskExecutor->runTask(TaskThread::JS, [this, segmentId, path]() {
+    this->instance->registerBundle(segmentId, path);
+  });
+}
+
 void rnoh::RNInstanceCAPI::emitComponentEvent(
     napi_env env,
     react::Tag tag,
@@ -183,9 +250,7 @@ void rnoh::RNInstanceCAPI::emitComponentEvent(
     m_eventDispatcher->sendEvent(ctx);
   }
 
-  for (auto& eventEmitRequestHandler : m_eventEmitRequestHandlers) {
-    eventEmitRequestHandler->handleEvent(ctx);
-  }
+  m_eventEmitRequestHandlerRegistry.handleEvent(ctx);
 }
 
 void rnoh::RNInstanceCAPI::onMemoryLevel(size_t memoryLevel) {
@@ -331,6 +396,7 @@ void RNInstanceCAPI::createSurface(
           scheduler,
           m_componentInstanceRegistry,
           m_componentInstanceFactory,
+          m_continuousEventCoalescer,
           surfaceId,
           moduleName));
 }
@@ -395,6 +461,7 @@ void RNInstanceCAPI::stopSurface(facebook::react::Tag surfaceId) {
     return;
   }
   it->second.stop();
+  m_mountingManager->clearSurface(surfaceId);
 }
 
 void RNInstanceCAPI::destroySurface(facebook::react::Tag surfaceId) {
@@ -404,6 +471,7 @@ void RNInstanceCAPI::destroySurface(facebook::react::Tag surfaceId) {
     return;
   }
   m_surfaceById.erase(it);
+  m_mountingManager->clearSurface(surfaceId);
 }
 
 void RNInstanceCAPI::setSurfaceDisplayMode(
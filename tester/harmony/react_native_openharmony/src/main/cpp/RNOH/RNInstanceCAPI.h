@@ -14,15 +14,21 @@
 #include <folly/dynamic.h>
 #include <react/renderer/animations/LayoutAnimationDriver.h>
 #include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/renderer/scheduler/Scheduler.h>
 #include <react/renderer/uimanager/LayoutAnimationStatusDelegate.h>
 
 #include "RNOH/ArkTSChannel.h"
+#include "RNOH/ContinuousEventCoalescer.h"
 #include "RNOH/EventDispatcher.h"
 #include "RNOH/EventEmitRequestHandler.h"
+#include "RNOH/EventEmitRequestHandlerRegistry.h"
 #include "RNOH/GlobalJSIBinder.h"
 #include "RNOH/MessageQueueThread.h"
+#include "RNOH/MountingManager.h"
+#include "RNOH/Performance/SurfaceTelemetryAggregator.h"
 #include "RNOH/RNInstance.h"
+#include "RNOH/RuntimeSchedulerFrameDeadline.h"
 #include "RNOH/SchedulerDelegateArkTS.h"
 #include "RNOH/ShadowViewRegistry.h"
 #include "RNOH/TaskExecutor/TaskExecutor.h"
@@ -55,11 +61,13 @@ class RNInstanceCAPI : public RNInstanceInternal,
       GlobalJSIBinders globalJSIBinders,
       UITicker::Shared uiTicker,
       ShadowViewRegistry::Shared shadowViewRegistry,
+      MountingManager::Shared mountingManager,
       std::unique_ptr<facebook::react::SchedulerDelegate> schedulerDelegate,
       std::vector<ArkTSMessageHandler::Shared> arkTSMessageHandlers,
       ArkTSChannel::Shared arkTSChannel,
       ComponentInstanceRegistry::Shared componentInstanceRegistry,
       ComponentInstanceFactory::Shared componentInstanceFactory,
+      ContinuousEventCoalescer::Shared continuousEventCoalescer,
       bool shouldEnableDebugger,
       bool shouldEnableBackgroundExecutor)
       : RNInstanceInternal(),
@@ -69,11 +77,12 @@ class RNInstanceCAPI : public RNInstanceInternal,
         scheduler(nullptr),
         taskExecutor(taskExecutor),
         m_shadowViewRegistry(shadowViewRegistry),
+        m_mountingManager(std::move(mountingManager)),
         m_turboModuleFactory(std::move(turboModuleFactory)),
         m_componentDescriptorProviderRegistry(
             componentDescriptorProviderRegistry),
         m_mutationsToNapiConverter(mutationsToNapiConverter),
-        m_eventEmitRequestHandlers(eventEmitRequestHandlers),
+        m_eventEmitRequestHandlerRegistry(eventEmitRequestHandlers),
         m_globalJSIBinders(globalJSIBinders),
         m_shouldRelayUITick(false),
         m_uiTicker(uiTicker),
@@ -82,10 +91,12 @@ class RNInstanceCAPI : public RNInstanceInternal,
         m_shouldEnableBackgroundExecutor(shouldEnableBackgroundExecutor),
         m_componentInstanceRegistry(componentInstanceRegistry),
         m_componentInstanceFactory(componentInstanceFactory),
+        m_continuousEventCoalescer(std::move(continuousEventCoalescer)),
         m_arkTSChannel(std::move(arkTSChannel)),
         m_arkTSMessageHandlers(std::move(arkTSMessageHandlers)) {
     this->unsubscribeUITickListener =
         this->m_uiTicker->subscribe(m_id, [this]() {
+          m_runtimeSchedulerFrameDeadline->onVsync();
           this->taskExecutor->runTask(
               TaskThread::MAIN, [this]() { this->onUITick(); });
         });
@@ -109,12 +120,19 @@ class RNInstanceCAPI : public RNInstanceInternal,
   }
 
   TaskExecutor::Shared getTaskExecutor() override;
+  SurfaceTelemetryAggregator::Shared getSurfaceTelemetryAggregator() override;
+  ContinuousEventCoalescer::Shared getContinuousEventCoalescer();
 
   void start() override;
   void loadScript(
-      std::vector<uint8_t>&& bundle,
+      std::unique_ptr<const facebook::react::JSBigString> bundle,
       std::string const sourceURL,
       std::function<void(const std::string)>&& onFinish) override;
+  void loadScriptFromFile(
+      std::string const path,
+      std::string const sourceURL,
+      std::function<void(const std::string)>&& onFinish) override;
+  void registerSegment(uint32_t segmentId, std::string const path) override;
   void createSurface(
       facebook::react::Tag surfaceId,
       std::string const& moduleName) override;
@@ -196,11 +214,12 @@ class RNInstanceCAPI : public RNInstanceInternal,
   std::shared_ptr<facebook::react::ComponentDescriptorProviderRegistry>
       m_componentDescriptorProviderRegistry;
   ShadowViewRegistry::Shared m_shadowViewRegistry;
+  MountingManager::Shared m_mountingManager;
   TurboModuleFactory m_turboModuleFactory;
   TurboModuleProvider::Shared m_turboModuleProvider;
   std::shared_ptr<EventDispatcher> m_eventDispatcher;
   MutationsToNapiConverter::Shared m_mutationsToNapiConverter;
-  EventEmitRequestHandlers m_eventEmitRequestHandlers;
+  EventEmitRequestHandlerRegistry m_eventEmitRequestHandlerRegistry;
   GlobalJSIBinders m_globalJSIBinders;
   std::shared_ptr<facebook::react::LayoutAnimationDriver> m_animationDriver;
   UITicker::Shared m_uiTicker;
@@ -213,13 +232,22 @@ class RNInstanceCAPI : public RNInstanceInternal,
       m_surfaceById;
   ComponentInstanceRegistry::Shared m_componentInstanceRegistry;
   ComponentInstanceFactory::Shared m_componentInstanceFactory;
+  ContinuousEventCoalescer::Shared m_continuousEventCoalescer;
   std::unique_ptr<facebook::react::SchedulerDelegate> m_schedulerDelegate;
   std::shared_ptr<facebook::react::Scheduler> scheduler;
   std::shared_ptr<facebook::react::Instance> instance;
+  std::shared_ptr<facebook::react::RuntimeScheduler> m_runtimeScheduler;
+  RuntimeSchedulerFrameDeadline::Shared m_runtimeSchedulerFrameDeadline =
+      std::make_shared<RuntimeSchedulerFrameDeadline>();
   std::vector<ArkTSMessageHandler::Shared> m_arkTSMessageHandlers;
   ArkTSChannel::Shared m_arkTSChannel;
 
   void initialize();
+  void initializeRuntimeScheduler();
+  /**
+   * Schedules work through RuntimeScheduler, so that React yields to it.
+   */
+  facebook::react::RuntimeExecutor createRuntimeExecutor();
   void initializeScheduler(
       std::shared_ptr<TurboModuleProvider> turboModuleProvider);
   std::shared_ptr<TurboModuleProvider> createTurboModuleProvider();
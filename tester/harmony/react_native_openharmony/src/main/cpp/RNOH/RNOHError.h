@@ -3,6 +3,7 @@
 #include <exception>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace rnoh {
 
@@ -21,7 +22,7 @@ class RNOHError : public std::exception {
         m_suggestions(std::move(howCanItBeFixed)) {
     m_stacktrace = boost::stacktrace::stacktrace();
 
-    std::vector<const std::string> lines = {m_message};
+    std::vector<std::string> lines = {m_message};
     if (!m_suggestions.empty()) {
       lines.emplace_back("Suggestions:");
     }
@@ -0,0 +1,68 @@
+#include "RNOH/RuntimeSchedulerFrameDeadline.h"
+
+namespace rnoh {
+
+using namespace facebook;
+
+react::RuntimeExecutor RuntimeSchedulerFrameDeadline::wrapRuntimeExecutor(
+    react::RuntimeExecutor runtimeExecutor) {
+  return [weakSelf = weak_from_this(),
+          runtimeExecutor = std::move(runtimeExecutor)](
+             std::function<void(jsi::Runtime&)>&& callback) {
+    runtimeExecutor([weakSelf, callback = std::move(callback)](
+                        jsi::Runtime& runtime) {
+      auto self = weakSelf.lock();
+      if (self == nullptr) {
+        callback(runtime);
+        return;
+      }
+      // cleared even if the callback throws
+      struct WorkInProgressScope {
+        RuntimeSchedulerFrameDeadline& deadline;
+        ~WorkInProgressScope() {
+          deadline.m_workStartFrameNumber.store(NO_WORK_IN_PROGRESS);
+        }
+      } scope{*self};
+      self->m_workStartFrameNumber.store(self->m_frameNumber.load());
+      callback(runtime);
+    });
+  };
+}
+
+void RuntimeSchedulerFrameDeadline::setRuntimeScheduler(
+    std::weak_ptr<react::RuntimeScheduler> runtimeScheduler) {
+  std::lock_guard<std::mutex> lock(m_runtimeSchedulerMutex);
+  m_runtimeScheduler = std::move(runtimeScheduler);
+}
+
+void RuntimeSchedulerFrameDeadline::onVsync() {
+  auto frameNumber = m_frameNumber.fetch_add(1) + 1;
+  auto workStartFrameNumber = m_workStartFrameNumber.load();
+  if (workStartFrameNumber == NO_WORK_IN_PROGRESS ||
+      workStartFrameNumber >= frameNumber) {
+    return;
+  }
+  // the work started before this vsync, so it missed the frame deadline
+  if (m_isYieldRequested.exchange(true)) {
+    return;
+  }
+  std::shared_ptr<react::RuntimeScheduler> runtimeScheduler;
+  {
+    std::lock_guard<std::mutex> lock(m_runtimeSchedulerMutex);
+    runtimeScheduler = m_runtimeScheduler.lock();
+  }
+  if (runtimeScheduler == nullptr) {
+    m_isYieldRequested.store(false);
+    return;
+  }
+  // a pending runtime access makes RuntimeScheduler::getShouldYield return
+  // true, the work loop resumes after this callback
+  runtimeScheduler->scheduleWork(
+      [weakSelf = weak_from_this()](jsi::Runtime& /*runtime*/) {
+        if (auto self = weakSelf.lock()) {
+          self->m_isYieldRequested.store(false);
+        }
+      });
+}
+
+} // namespace rnoh
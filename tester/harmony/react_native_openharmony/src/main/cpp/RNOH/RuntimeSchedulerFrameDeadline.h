@@ -0,0 +1,49 @@
+#pragma once
+#include <ReactCommon/RuntimeExecutor.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace rnoh {
+
+/**
+ * RuntimeScheduler yields only when the host requests access to the runtime,
+ * so a long render would block the JS thread until it finishes. This class
+ * tracks whether the runtime is performing work and, if the work is still in
+ * progress when a vsync arrives, requests access to the runtime, which makes
+ * RuntimeScheduler::getShouldYield return true. Only the C-API architecture
+ * uses it, and its effect on input-to-handler latency hasn't been measured.
+ */
+class RuntimeSchedulerFrameDeadline
+    : public std::enable_shared_from_this<RuntimeSchedulerFrameDeadline> {
+ public:
+  using Shared = std::shared_ptr<RuntimeSchedulerFrameDeadline>;
+
+  /**
+   * Wraps the executor used by RuntimeScheduler, to know when it performs
+   * work.
+   */
+  facebook::react::RuntimeExecutor wrapRuntimeExecutor(
+      facebook::react::RuntimeExecutor runtimeExecutor);
+
+  void setRuntimeScheduler(
+      std::weak_ptr<facebook::react::RuntimeScheduler> runtimeScheduler);
+
+  /**
+   * Can be called from any thread.
+   */
+  void onVsync();
+
+ private:
+  static constexpr uint64_t NO_WORK_IN_PROGRESS = 0;
+
+  std::atomic<uint64_t> m_frameNumber{1};
+  std::atomic<uint64_t> m_workStartFrameNumber{NO_WORK_IN_PROGRESS};
+  std::atomic<bool> m_isYieldRequested{false};
+  std::mutex m_runtimeSchedulerMutex;
+  std::weak_ptr<facebook::react::RuntimeScheduler> m_runtimeScheduler;
+};
+
+} // namespace rnoh
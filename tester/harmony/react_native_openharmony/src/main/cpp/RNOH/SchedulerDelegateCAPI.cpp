@@ -71,42 +71,41 @@ void SchedulerDelegateCAPI::synchronouslyUpdateViewOnUIThread(
 
 void SchedulerDelegateCAPI::finalizeMutationUpdates(
     facebook::react::ShadowViewMutationList const& mutations) {
-  std::unordered_set<ComponentInstance::Shared> componentInstancesToFinalize;
-
+  // a component is usually affected by several mutations, so tags are
+  // deduplicated before looking up their instances
+  std::unordered_set<react::Tag> affectedTags;
+  affectedTags.reserve(mutations.size());
   for (const auto& mutation : mutations) {
-    std::shared_ptr<ComponentInstance> componentInstance = nullptr;
+    std::optional<react::Tag> tag;
     switch (mutation.type) {
       case facebook::react::ShadowViewMutation::Create: {
-        componentInstance = m_componentInstanceRegistry->findByTag(
-            mutation.newChildShadowView.tag);
+        tag = mutation.newChildShadowView.tag;
         break;
       }
       case facebook::react::ShadowViewMutation::Delete: {
         break;
       }
       case facebook::react::ShadowViewMutation::Insert: {
-        componentInstance = m_componentInstanceRegistry->findByTag(
-            mutation.parentShadowView.tag);
+        tag = mutation.parentShadowView.tag;
         break;
       }
       case facebook::react::ShadowViewMutation::Remove: {
-        componentInstance = m_componentInstanceRegistry->findByTag(
-            mutation.parentShadowView.tag);
+        tag = mutation.parentShadowView.tag;
         break;
       }
       case facebook::react::ShadowViewMutation::Update: {
-        componentInstance = m_componentInstanceRegistry->findByTag(
-            mutation.newChildShadowView.tag);
+        tag = mutation.newChildShadowView.tag;
         break;
       }
     }
+    if (!tag.has_value() || !affectedTags.insert(tag.value()).second) {
+      continue;
+    }
+    auto componentInstance = m_componentInstanceRegistry->findByTag(*tag);
     if (componentInstance != nullptr) {
-      componentInstancesToFinalize.insert(componentInstance);
+      componentInstance->finalizeUpdates();
     }
   }
-  for (const auto& componentInstance : componentInstancesToFinalize) {
-    componentInstance->finalizeUpdates();
-  }
 }
 
 } // namespace rnoh
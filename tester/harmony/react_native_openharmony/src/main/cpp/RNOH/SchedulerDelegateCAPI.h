@@ -58,20 +58,36 @@ class SchedulerDelegateCAPI : public facebook::react::SchedulerDelegate {
             facebook::react::MountingTransaction const& transaction,
             facebook::react::SurfaceTelemetry const& surfaceTelemetry) {
           // Did mount
+          auto sample =
+              m_mountingManager->getSurfaceTelemetryAggregator()
+                  ->sampleTransaction(transaction);
           auto mutations = transaction.getMutations();
           m_mountingManager->processMutations(mutations);
-          m_taskExecutor->runTask(TaskThread::MAIN, [this, mutations] {
-            for (auto mutation : mutations) {
-              try {
-                this->handleMutation(mutation);
-              } catch (std::runtime_error& e) {
-                LOG(ERROR) << "Mutation "
-                           << this->getMutationNameFromType(mutation.type)
-                           << " failed: " << e.what();
-              }
-            }
-            finalizeMutationUpdates(mutations);
-          });
+          // the task owns its copy of the list, which is released once the
+          // mutations are mounted
+          m_taskExecutor->runTask(
+              TaskThread::MAIN,
+              [this, mutations = std::move(mutations), sample] {
+                auto mountStartTime = facebook::react::telemetryTimePointNow();
+                for (auto const& mutation : mutations) {
+                  try {
+                    this->handleMutation(mutation);
+                  } catch (std::runtime_error& e) {
+                    LOG(ERROR) << "Mutation "
+                               << this->getMutationNameFromType(mutation.type)
+                               << " failed: " << e.what();
+                  }
+                }
+                finalizeMutationUpdates(mutations);
+                if (sample.has_value()) {
+                  m_mountingManager->getSurfaceTelemetryAggregator()
+                      ->recordMount(
+                          sample.value(),
+                          mountStartTime,
+                          facebook::react::telemetryTimePointNow());
+                }
+              });
+          m_mountingManager->finishTransaction(transaction.getSurfaceId());
         });
   }
 
@@ -128,7 +144,7 @@ class SchedulerDelegateCAPI : public facebook::react::SchedulerDelegate {
     componentInstance->setProps(shadowView.props);
   }
 
-  void handleMutation(facebook::react::ShadowViewMutation mutation) {
+  void handleMutation(facebook::react::ShadowViewMutation const& mutation) {
     VLOG(1) << "Mutation (type:" << this->getMutationNameFromType(mutation.type)
             << "; componentName: "
             << (mutation.newChildShadowView.componentName != nullptr
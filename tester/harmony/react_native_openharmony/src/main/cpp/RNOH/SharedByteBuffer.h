@@ -0,0 +1,43 @@
+#pragma once
+
+#include <folly/Range.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * Refcounted byte storage which can back both a JSI ArrayBuffer
+ * (`jsi::ArrayBuffer(rt, buffer)`) and a NAPI ArrayBuffer
+ * (`ArkJS::createArrayBuffer(buffer)`) without copying the bytes. The storage
+ * is released when the last ArrayBuffer referencing it is garbage collected.
+ */
+class SharedByteBuffer : public facebook::jsi::MutableBuffer {
+ public:
+  using Shared = std::shared_ptr<SharedByteBuffer>;
+
+  static Shared copyFrom(folly::ByteRange bytes) {
+    return std::make_shared<SharedByteBuffer>(
+        std::vector<uint8_t>(bytes.begin(), bytes.end()));
+  }
+
+  SharedByteBuffer(std::vector<uint8_t> bytes) : m_bytes(std::move(bytes)) {}
+
+  size_t size() const override {
+    return m_bytes.size();
+  }
+
+  uint8_t* data() override {
+    return m_bytes.data();
+  }
+
+  folly::ByteRange getRange() const {
+    return folly::ByteRange(m_bytes.data(), m_bytes.size());
+  }
+
+ private:
+  std::vector<uint8_t> m_bytes;
+};
+
+} // namespace rnoh
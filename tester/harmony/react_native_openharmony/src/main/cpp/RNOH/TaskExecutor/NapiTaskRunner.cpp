@@ -63,7 +63,7 @@ NapiTaskRunner::~NapiTaskRunner() {
 
 void NapiTaskRunner::runAsyncTask(Task&& task) {
   std::unique_lock<std::mutex> lock(tasksMutex);
-  tasksQueue.push(task);
+  tasksQueue.push(std::move(task));
   uv_async_send(asyncHandle);
 }
 
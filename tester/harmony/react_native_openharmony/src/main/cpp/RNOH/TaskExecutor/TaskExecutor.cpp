@@ -10,9 +10,8 @@ namespace rnoh {
 TaskExecutor::TaskExecutor(napi_env mainEnv, bool shouldEnableBackground) {
   auto mainTaskRunner = std::make_shared<NapiTaskRunner>(mainEnv);
   auto jsTaskRunner = std::make_shared<ThreadTaskRunner>("RNOH_JS");
-  auto backgroundExecutor = shouldEnableBackground
-      ? std::make_shared<ThreadTaskRunner>("RNOH_BACKGROUND")
-      : nullptr;
+  auto backgroundExecutor =
+      std::make_shared<ThreadTaskRunner>("RNOH_BACKGROUND");
   m_taskRunners = {mainTaskRunner, jsTaskRunner, backgroundExecutor};
   this->runTask(TaskThread::JS, [this]() {
     this->setTaskThreadPriority(QoS_Level::QOS_USER_INTERACTIVE);
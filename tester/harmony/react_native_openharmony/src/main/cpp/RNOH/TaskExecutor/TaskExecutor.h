@@ -24,6 +24,11 @@ class TaskExecutor {
   using Shared = std::shared_ptr<TaskExecutor>;
   using Weak = std::weak_ptr<TaskExecutor>;
 
+  /**
+   * The BACKGROUND thread always exists, e.g. the Hermes code cache compiles
+   * bundles there. `shouldEnableBackground` raises its priority, so that
+   * layout can run on it.
+   */
   TaskExecutor(napi_env mainEnv, bool shouldEnableBackground = false);
 
   void runTask(TaskThread thread, Task&& task);
@@ -18,7 +18,13 @@ TurboModuleFactory::TurboModuleFactory(
       m_arkTsTurboModuleProviderRef(arkTsTurboModuleProviderRef),
       m_componentBinderByString(std::move(componentBinderByString)),
       m_taskExecutor(taskExecutor),
-      m_delegates(delegates) {}
+      m_delegates(delegates),
+      m_callBatcher(std::make_shared<ArkTSCallBatcher>(taskExecutor)),
+      m_arkTsTurboModuleInstanceRegistry(
+          std::make_shared<ArkTSTurboModuleInstanceRegistry>(
+              env,
+              arkTsTurboModuleProviderRef,
+              taskExecutor)) {}
 
 TurboModuleFactory::SharedTurboModule TurboModuleFactory::create(
     std::shared_ptr<facebook::react::CallInvoker> jsInvoker,
@@ -36,7 +42,8 @@ TurboModuleFactory::SharedTurboModule TurboModuleFactory::create(
       .taskExecutor = m_taskExecutor,
       .eventDispatcher = eventDispatcher,
       .jsQueue = jsQueue,
-      .scheduler = scheduler};
+      .scheduler = scheduler,
+      .callBatcher = m_callBatcher};
   if (name == "UIManager") {
     return std::make_shared<UIManagerModule>(
         ctx, name, std::move(m_componentBinderByString));
@@ -75,31 +82,12 @@ TurboModuleFactory::delegateCreatingTurboModule(
 
 napi_ref TurboModuleFactory::maybeGetArkTsTurboModuleInstanceRef(
     const std::string& name) const {
-  VLOG(3) << "TurboModuleFactory::maybeGetArkTsTurboModuleInstanceRef: start";
-  napi_ref result = nullptr;
-  m_taskExecutor->runSyncTask(
-      TaskThread::MAIN,
-      [env = m_env,
-       arkTsTurboModuleProviderRef = m_arkTsTurboModuleProviderRef,
-       name,
-       &result]() {
-        VLOG(3)
-            << "TurboModuleFactory::maybeGetArkTsTurboModuleInstanceRef: started calling hasModule";
-        ArkJS arkJs(env);
-        {
-          auto result = arkJs.getObject(arkTsTurboModuleProviderRef)
-                            .call("hasModule", {arkJs.createString(name)});
-          if (!arkJs.getBoolean(result)) {
-            return;
-          }
-        }
-        auto n_turboModuleInstance =
-            arkJs.getObject(arkTsTurboModuleProviderRef)
-                .call("getModule", {arkJs.createString(name)});
-        result = arkJs.createReference(n_turboModuleInstance);
-      });
-  VLOG(3) << "TurboModuleFactory::maybeGetArkTsTurboModuleInstanceRef: stop";
-  return result;
+  return m_arkTsTurboModuleInstanceRegistry->getInstanceRef(name);
+}
+
+void TurboModuleFactory::prewarmArkTSTurboModules(
+    std::vector<std::string> names) const {
+  m_arkTsTurboModuleInstanceRegistry->prewarm(std::move(names));
 }
 
 TurboModuleFactory::SharedTurboModule
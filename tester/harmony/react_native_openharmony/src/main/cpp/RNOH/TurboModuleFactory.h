@@ -2,6 +2,7 @@
 
 #include <ReactCommon/TurboModule.h>
 #include "RNOH/ArkTSTurboModule.h"
+#include "RNOH/ArkTSTurboModuleInstanceRegistry.h"
 #include "RNOH/UIManagerModule.h"
 #include "napi/native_api.h"
 namespace rnoh {
@@ -39,6 +40,12 @@ class TurboModuleFactory {
       std::shared_ptr<facebook::react::Scheduler> scheduler,
       std::weak_ptr<RNInstance> instance) const;
 
+  /**
+   * Creates ArkTS instances of the given modules on the MAIN thread ahead of
+   * time, so that looking them up later doesn't block the JS thread.
+   */
+  void prewarmArkTSTurboModules(std::vector<std::string> names) const;
+
  protected:
   SharedTurboModule delegateCreatingTurboModule(
       Context ctx,
@@ -55,6 +62,8 @@ class TurboModuleFactory {
   napi_ref m_arkTsTurboModuleProviderRef;
   std::shared_ptr<TaskExecutor> m_taskExecutor;
   std::vector<std::shared_ptr<TurboModuleFactoryDelegate>> m_delegates;
+  ArkTSCallBatcher::Shared m_callBatcher;
+  ArkTSTurboModuleInstanceRegistry::Shared m_arkTsTurboModuleInstanceRegistry;
 };
 
 } // namespace rnoh
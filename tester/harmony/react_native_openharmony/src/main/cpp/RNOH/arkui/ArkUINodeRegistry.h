@@ -17,6 +17,11 @@ class TouchEventHandler {
   virtual ~TouchEventHandler() = default;
 };
 
+/**
+ * Maps ArkUI node handles to nodes and touch handlers, so that node events
+ * can be routed to them. ArkUI nodes are created, destroyed and receive
+ * events only on the MAIN (UI) thread, so the maps aren't synchronized.
+ */
 class ArkUINodeRegistry {
   static std::unique_ptr<ArkUINodeRegistry> instance;
 
@@ -16,7 +16,8 @@ ImageNode::ImageNode()
     : ArkUINode(NativeNodeApi::getInstance()->createNode(
           ArkUI_NodeType::ARKUI_NODE_IMAGE)),
       m_childArkUINodeHandle(nullptr),
-      m_imageNodeDelegate(nullptr) {
+      m_imageNodeDelegate(nullptr),
+      m_drawableDescriptor(nullptr) {
   for (auto eventType : IMAGE_NODE_EVENT_TYPES) {
     maybeThrow(NativeNodeApi::getInstance()->registerNodeEvent(
         m_nodeHandle, eventType, eventType, this));
@@ -27,6 +28,14 @@ ImageNode::~ImageNode() {
   for (auto eventType : IMAGE_NODE_EVENT_TYPES) {
     NativeNodeApi::getInstance()->unregisterNodeEvent(m_nodeHandle, eventType);
   }
+  resetDrawableDescriptor();
+}
+
+void ImageNode::resetDrawableDescriptor() {
+  if (m_drawableDescriptor != nullptr) {
+    OH_ArkUI_DrawableDescriptor_Dispose(m_drawableDescriptor);
+    m_drawableDescriptor = nullptr;
+  }
 }
 
 void ImageNode::setNodeDelegate(ImageNodeDelegate* imageNodeDelegate) {
@@ -61,6 +70,33 @@ ImageNode& ImageNode::setSources(facebook::react::ImageSources const& src) {
   }
   maybeThrow(NativeNodeApi::getInstance()->setAttribute(
       m_nodeHandle, NODE_IMAGE_SRC, &item));
+  resetDrawableDescriptor();
+  return *this;
+}
+
+ImageNode& ImageNode::setPixelMap(
+    OH_PixelmapNativeHandle pixelMap,
+    std::string const& uri) {
+  auto drawableDescriptor =
+      OH_ArkUI_DrawableDescriptor_CreateFromPixelMap(pixelMap);
+  ArkUI_AttributeItem item = {.object = drawableDescriptor};
+  maybeThrow(NativeNodeApi::getInstance()->setAttribute(
+      m_nodeHandle, NODE_IMAGE_SRC, &item));
+  // the previous descriptor is disposed only after it's replaced
+  resetDrawableDescriptor();
+  m_drawableDescriptor = drawableDescriptor;
+  m_uri = uri;
+  return *this;
+}
+
+ImageNode& ImageNode::setLocalSource(
+    std::string const& localUri,
+    std::string uri) {
+  ArkUI_AttributeItem item = {.string = localUri.c_str()};
+  maybeThrow(NativeNodeApi::getInstance()->setAttribute(
+      m_nodeHandle, NODE_IMAGE_SRC, &item));
+  resetDrawableDescriptor();
+  m_uri = std::move(uri);
   return *this;
 }
 
@@ -2,6 +2,7 @@
  * Used only in C-API based Architecture.
  */
 #pragma once
+#include <arkui/drawable_descriptor.h>
 #include <react/renderer/imagemanager/primitives.h>
 #include "ArkUINode.h"
 
@@ -18,12 +19,26 @@ class ImageNode : public ArkUINode {
  protected:
   ArkUI_NodeHandle m_childArkUINodeHandle;
   ImageNodeDelegate* m_imageNodeDelegate;
+  ArkUI_DrawableDescriptor* m_drawableDescriptor;
   std::string m_uri;
 
+  void resetDrawableDescriptor();
+
  public:
   ImageNode();
   ~ImageNode();
   ImageNode& setSources(facebook::react::ImageSources const& src);
+  /**
+   * Displays an image decoded by ImageLoader. The PixelMap must outlive its
+   * use by the node. `uri` is the source URI of the image.
+   */
+  ImageNode& setPixelMap(
+      OH_PixelmapNativeHandle pixelMap,
+      std::string const& uri);
+  /**
+   * Displays the local copy of the image loaded by ImageLoader.
+   */
+  ImageNode& setLocalSource(std::string const& localUri, std::string uri);
   ImageNode& setResizeMode(facebook::react::ImageResizeMode const& mode);
   ImageNode& setTintColor(facebook::react::SharedColor const& sharedColor);
   ImageNode& setBlur(facebook::react::Float blur);
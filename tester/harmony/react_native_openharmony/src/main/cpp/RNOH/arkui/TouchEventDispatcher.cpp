@@ -60,6 +60,10 @@ facebook::react::Touch convertTouchPointToReactTouch(
   return touch;
 }
 
+TouchEventDispatcher::TouchEventDispatcher(
+    ContinuousEventCoalescer::Shared continuousEventCoalescer)
+    : m_continuousEventCoalescer(std::move(continuousEventCoalescer)) {}
+
 bool TouchEventDispatcher::canIgnoreMoveEvent(
     facebook::react::TouchEvent currentEvent) {
   if (m_previousEvent.touches.empty()) {
@@ -207,13 +211,22 @@ void TouchEventDispatcher::dispatchTouchEvent(
   }
   m_previousEvent = touchEvent;
 
+  if (action == UI_TOUCH_EVENT_ACTION_MOVE) {
+    m_continuousEventCoalescer->dispatchEvent(
+        eventTarget->getTouchTargetTag(),
+        "touchMove",
+        [touchEventEmitter = eventTarget->getTouchEventEmitter(),
+         touchEvent = std::move(touchEvent)] {
+          touchEventEmitter->onTouchMove(touchEvent);
+        });
+    return;
+  }
+  // the responder system expects touch events in order
+  m_continuousEventCoalescer->flushAll();
   switch (action) {
     case UI_TOUCH_EVENT_ACTION_DOWN:
       eventTarget->getTouchEventEmitter()->onTouchStart(touchEvent);
       break;
-    case UI_TOUCH_EVENT_ACTION_MOVE:
-      eventTarget->getTouchEventEmitter()->onTouchMove(touchEvent);
-      break;
     case UI_TOUCH_EVENT_ACTION_UP:
       eventTarget->getTouchEventEmitter()->onTouchEnd(touchEvent);
       break;
@@ -276,6 +289,7 @@ bool TouchEventDispatcher::maybeCancelPreviousTouchEvent(
 
   // emit cancel event
   DLOG(INFO) << "Cancelling previous touch event";
+  m_continuousEventCoalescer->flushAll();
   touchTarget->getTouchEventEmitter()->onTouchCancel(touchCancelEvent);
   return true;
 }
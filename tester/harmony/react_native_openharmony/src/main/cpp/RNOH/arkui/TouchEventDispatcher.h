@@ -4,6 +4,7 @@
 #include <arkui/ui_input_event.h>
 #include <react/renderer/graphics/Point.h>
 #include <unordered_map>
+#include "RNOH/ContinuousEventCoalescer.h"
 #include "RNOH/TouchTarget.h"
 
 namespace rnoh {
@@ -18,6 +19,9 @@ class TouchEventDispatcher {
  public:
   using TouchId = int;
 
+  TouchEventDispatcher(
+      ContinuousEventCoalescer::Shared continuousEventCoalescer);
+
   void dispatchTouchEvent(
       ArkUI_UIInputEvent* event,
       TouchTarget::Shared const& rootTarget);
@@ -32,5 +36,6 @@ class TouchEventDispatcher {
 
   std::unordered_map<TouchId, TouchTarget::Weak> m_touchTargetByTouchId;
   facebook::react::TouchEvent m_previousEvent;
+  ContinuousEventCoalescer::Shared m_continuousEventCoalescer;
 };
 } // namespace rnoh
\ No newline at end of file
@@ -44,8 +44,11 @@ class SurfaceTouchEventHandler : public TouchEventHandler {
   TouchEventDispatcher m_touchEventDispatcher;
 
  public:
-  SurfaceTouchEventHandler(ComponentInstance::Shared rootView)
-      : m_rootView(std::move(rootView)) {
+  SurfaceTouchEventHandler(
+      ComponentInstance::Shared rootView,
+      ContinuousEventCoalescer::Shared continuousEventCoalescer)
+      : m_rootView(std::move(rootView)),
+        m_touchEventDispatcher(std::move(continuousEventCoalescer)) {
     ArkUINodeRegistry::getInstance().registerTouchHandler(
         &m_rootView->getLocalRootArkUINode(), this);
     NativeNodeApi::getInstance()->registerNodeEvent(
@@ -80,6 +83,7 @@ XComponentSurface::XComponentSurface(
     std::shared_ptr<Scheduler> scheduler,
     ComponentInstanceRegistry::Shared componentInstanceRegistry,
     ComponentInstanceFactory::Shared const& componentInstanceFactory,
+    ContinuousEventCoalescer::Shared continuousEventCoalescer,
     SurfaceId surfaceId,
     std::string const& appKey)
     : m_surfaceId(surfaceId),
@@ -97,7 +101,8 @@ XComponentSurface::XComponentSurface(
     return;
   }
   m_componentInstanceRegistry->insert(m_rootView);
-  m_touchEventHandler = std::make_unique<SurfaceTouchEventHandler>(m_rootView);
+  m_touchEventHandler = std::make_unique<SurfaceTouchEventHandler>(
+      m_rootView, std::move(continuousEventCoalescer));
 }
 
 XComponentSurface::XComponentSurface(XComponentSurface&& other) noexcept
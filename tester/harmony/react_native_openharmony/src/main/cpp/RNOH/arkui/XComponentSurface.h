@@ -17,6 +17,7 @@ class XComponentSurface {
       std::shared_ptr<facebook::react::Scheduler> scheduler,
       ComponentInstanceRegistry::Shared componentInstanceRegistry,
       ComponentInstanceFactory::Shared const& componentInstanceFactory,
+      ContinuousEventCoalescer::Shared continuousEventCoalescer,
       facebook::react::SurfaceId surfaceId,
       std::string const& appKey);
 
@@ -1,5 +1,6 @@
 #include <ace/xcomponent/native_interface_xcomponent.h>
 #include <cxxreact/JSExecutor.h>
+#include <hermes/hermes.h>
 #include <js_native_api.h>
 #include <js_native_api_types.h>
 #include <array>
@@ -11,7 +12,11 @@
 #include "RNInstanceFactory.h"
 #include "RNOH/ArkJS.h"
 #include "RNOH/ArkTSBridge.h"
+#include "RNOH/HermesCodeCache.h"
+#include "RNOH/ImageLoader/ImageLoader.h"
+#include "RNOH/ImageLoader/PlatformImageLoader.h"
 #include "RNOH/Inspector.h"
+#include "RNOH/JSBundle.h"
 #include "RNOH/LogSink.h"
 #include "RNOH/Performance/HarmonyReactMarker.h"
 #include "RNOH/RNInstance.h"
@@ -62,6 +67,71 @@ static napi_value onInit(napi_env env, napi_callback_info info) {
       .build();
 }
 
+static napi_value initializeHermesCodeCache(
+    napi_env env,
+    napi_callback_info info) {
+  ArkJS arkJs(env);
+  auto args = arkJs.getCallbackArgs(info, 2);
+  HermesCodeCache::initializeInstance(
+      arkJs.getString(args[0]),
+      arkJs.getDouble(args[1]),
+      facebook::hermes::HermesRuntime::getBytecodeVersion());
+  return arkJs.getUndefined();
+}
+
+static napi_value storeHermesBytecode(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  auto args = arkJs.getCallbackArgs(info, 2);
+  auto codeCache = HermesCodeCache::getInstance();
+  if (codeCache == nullptr) {
+    return arkJs.createBoolean(false);
+  }
+  try {
+    auto source =
+        facebook::react::JSBigFileString::fromPath(arkJs.getString(args[0]));
+    auto bytecode =
+        facebook::react::JSBigFileString::fromPath(arkJs.getString(args[1]));
+    return arkJs.createBoolean(codeCache->store(
+        codeCache->getKey(*source),
+        std::string_view(bytecode->c_str(), bytecode->size())));
+  } catch (std::exception const& e) {
+    LOG(ERROR) << "Couldn't store Hermes bytecode: " << e.what();
+    return arkJs.createBoolean(false);
+  }
+}
+
+static napi_value initializeImageLoader(
+    napi_env env,
+    napi_callback_info info) {
+  ArkJS arkJs(env);
+  auto args = arkJs.getCallbackArgs(info, 3);
+#ifdef C_API_ARCH
+  ImageLoader::initializeInstance(createPlatformImageLoader(
+      arkJs.getString(args[0]),
+      arkJs.getDouble(args[1]),
+      arkJs.getDouble(args[2])));
+#endif
+  return arkJs.getUndefined();
+}
+
+static napi_value destroyImageLoader(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+#ifdef C_API_ARCH
+  ImageLoader::destroyInstance();
+#endif
+  return arkJs.getUndefined();
+}
+
+static napi_value getImageLoaderStats(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+#ifdef C_API_ARCH
+  if (auto imageLoader = ImageLoader::getInstance()) {
+    return arkJs.createString(imageLoader->getStatsJSON());
+  }
+#endif
+  return arkJs.createString("null");
+}
+
 napi_value initializeArkTSBridge(napi_env env, napi_callback_info info) {
   ArkJS arkJs(env);
   auto args = arkJs.getCallbackArgs(info, 1);
@@ -95,8 +165,10 @@ static napi_value createReactNativeInstance(
     DLOG(INFO) << "createReactNativeInstance";
     HarmonyReactMarker::setAppStartTime(
         facebook::react::JSExecutor::performanceNow());
-    auto args = arkJs.getCallbackArgs(info, 10);
+    auto args = arkJs.getCallbackArgs(info, 11);
     size_t instanceId = arkJs.getDouble(args[0]);
+    auto markerTag = std::to_string(instanceId);
+    HarmonyReactMarker::logMarkerStart("CREATE_RN_INSTANCE", markerTag);
     auto arkTsTurboModuleProviderRef = arkJs.createReference(args[1]);
     auto mutationsListenerRef = arkJs.createReference(args[2]);
     auto commandDispatcherRef = arkJs.createReference(args[3]);
@@ -111,6 +183,14 @@ static napi_value createReactNativeInstance(
           arkJs.getBoolean(featureFlagNameAndStatus.second));
     }
     auto frameNodeFactoryRef = arkJs.createReference(args[9]);
+    std::vector<std::string> turboModulesToPrewarm;
+    if (arkJs.getType(args[10]) == napi_object) {
+      auto length = arkJs.getArrayLength(args[10]);
+      for (uint32_t i = 0; i < length; i++) {
+        turboModulesToPrewarm.push_back(
+            arkJs.getString(arkJs.getArrayElement(args[10], i)));
+      }
+    }
     auto rnInstance = createRNInstance(
         instanceId,
         env,
@@ -157,7 +237,8 @@ static napi_value createReactNativeInstance(
         featureFlagRegistry,
         uiTicker,
         shouldEnableDebugger,
-        shouldEnableBackgroundExecutor);
+        shouldEnableBackgroundExecutor,
+        std::move(turboModulesToPrewarm));
 
     auto lock = std::lock_guard<std::mutex>(rnInstanceByIdMutex);
     if (rnInstanceById.find(instanceId) != rnInstanceById.end()) {
@@ -167,6 +248,7 @@ static napi_value createReactNativeInstance(
     auto [it, _inserted] =
         rnInstanceById.emplace(instanceId, std::move(rnInstance));
     it->second->start();
+    HarmonyReactMarker::logMarkerFinish("CREATE_RN_INSTANCE", markerTag);
   } catch (...) {
     ArkTSBridge::getInstance()->handleError(std::current_exception());
   }
@@ -198,6 +280,39 @@ static napi_value destroyReactNativeInstance(
   return arkJs.getUndefined();
 }
 
+/**
+ * Hermes bytecode is executed in place and doesn't need a NUL terminator, so
+ * the ArrayBuffer's memory is used directly, and the ArrayBuffer is kept
+ * alive by a reference for as long as the runtime uses the bundle. Source
+ * bundles are copied once, into a NUL terminated string.
+ */
+static std::unique_ptr<const facebook::react::JSBigString>
+createJSBundleFromArrayBuffer(
+    ArkJS& arkJs,
+    napi_value arrayBuffer,
+    TaskExecutor::Shared const& taskExecutor) {
+  auto range = arkJs.getArrayBufferRange(arrayBuffer);
+  auto data = reinterpret_cast<const char*>(range.data());
+  if (!isHermesBytecodeBundle(JSBigStringView(nullptr, data, range.size()))) {
+    return JSBigVectorString::copyFrom(range);
+  }
+  // the reference must be deleted on MAIN, while the runtime releases the
+  // bundle on JS
+  auto arrayBufferRef = std::shared_ptr<napi_ref__>(
+      arkJs.createReference(arrayBuffer),
+      [env = arkJs.getEnv(),
+       weakTaskExecutor = std::weak_ptr<TaskExecutor>(taskExecutor)](
+          napi_ref ref) {
+        if (auto taskExecutor = weakTaskExecutor.lock()) {
+          taskExecutor->runTask(TaskThread::MAIN, [env, ref] {
+            ArkJS(env).deleteReference(ref);
+          });
+        }
+      });
+  return std::make_unique<JSBigStringView>(
+      std::move(arrayBufferRef), data, range.size());
+}
+
 static napi_value loadScript(napi_env env, napi_callback_info info) {
   DLOG(INFO) << "loadScript";
   ArkJS arkJs(env);
@@ -210,9 +325,45 @@ static napi_value loadScript(napi_env env, napi_callback_info info) {
       return arkJs.getUndefined();
     }
     auto& rnInstance = it->second;
+    auto sourceURL = arkJs.getString(args[2]);
+    // the bundle was read on the ArkTS side, which marks READ_JS_BUNDLE
+    auto bundle = createJSBundleFromArrayBuffer(
+        arkJs, args[1], rnInstance->getTaskExecutor());
     auto onFinishRef = arkJs.createReference(args[3]);
     rnInstance->loadScript(
-        arkJs.getArrayBuffer(args[1]),
+        std::move(bundle),
+        sourceURL,
+        [taskExecutor = rnInstance->getTaskExecutor(), env, onFinishRef](
+            const std::string& errorMsg) {
+          taskExecutor->runTask(
+              TaskThread::MAIN, [env, onFinishRef, errorMsg]() {
+                ArkJS arkJs(env);
+                auto listener = arkJs.getReferenceValue(onFinishRef);
+                arkJs.call<1>(listener, {arkJs.createString(errorMsg)});
+                arkJs.deleteReference(onFinishRef);
+              });
+        });
+  } catch (...) {
+    ArkTSBridge::getInstance()->handleError(std::current_exception());
+  }
+  return arkJs.getUndefined();
+}
+
+static napi_value loadScriptFromFile(napi_env env, napi_callback_info info) {
+  DLOG(INFO) << "loadScriptFromFile";
+  ArkJS arkJs(env);
+  try {
+    auto args = arkJs.getCallbackArgs(info, 4);
+    size_t instanceId = arkJs.getDouble(args[0]);
+    auto lock = std::lock_guard<std::mutex>(rnInstanceByIdMutex);
+    auto it = rnInstanceById.find(instanceId);
+    if (it == rnInstanceById.end()) {
+      return arkJs.getUndefined();
+    }
+    auto& rnInstance = it->second;
+    auto onFinishRef = arkJs.createReference(args[3]);
+    rnInstance->loadScriptFromFile(
+        arkJs.getString(args[1]),
         arkJs.getString(args[2]),
         [taskExecutor = rnInstance->getTaskExecutor(), env, onFinishRef](
             const std::string& errorMsg) {
@@ -230,6 +381,128 @@ static napi_value loadScript(napi_env env, napi_callback_info info) {
   return arkJs.getUndefined();
 }
 
+static napi_value registerSegment(napi_env env, napi_callback_info info) {
+  DLOG(INFO) << "registerSegment";
+  ArkJS arkJs(env);
+  try {
+    auto args = arkJs.getCallbackArgs(info, 3);
+    size_t instanceId = arkJs.getDouble(args[0]);
+    auto lock = std::lock_guard<std::mutex>(rnInstanceByIdMutex);
+    auto it = rnInstanceById.find(instanceId);
+    if (it == rnInstanceById.end()) {
+      return arkJs.getUndefined();
+    }
+    it->second->registerSegment(
+        arkJs.getDouble(args[1]), arkJs.getString(args[2]));
+  } catch (...) {
+    ArkTSBridge::getInstance()->handleError(std::current_exception());
+  }
+  return arkJs.getUndefined();
+}
+
+static napi_value getStartupTimeline(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  return arkJs.createString(StartupTimeline::getInstance().toJSON());
+}
+
+static napi_value logMarker(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  auto args = arkJs.getCallbackArgs(info, 3);
+  auto marker = arkJs.getString(args[0]);
+  auto tag = arkJs.getString(args[1]);
+  auto type = arkJs.getString(args[2]);
+  if (type == "START") {
+    HarmonyReactMarker::logMarkerStart(marker, tag);
+  } else if (type == "FINISH") {
+    HarmonyReactMarker::logMarkerFinish(marker, tag);
+  } else {
+    HarmonyReactMarker::logMarker(marker, tag);
+  }
+  return arkJs.getUndefined();
+}
+
+static napi_value setSurfaceTelemetrySamplingInterval(
+    napi_env env,
+    napi_callback_info info) {
+  ArkJS arkJs(env);
+  try {
+    auto args = arkJs.getCallbackArgs(info, 2);
+    size_t instanceId = arkJs.getDouble(args[0]);
+    auto lock = std::lock_guard<std::mutex>(rnInstanceByIdMutex);
+    auto it = rnInstanceById.find(instanceId);
+    if (it == rnInstanceById.end()) {
+      return arkJs.getUndefined();
+    }
+    it->second->getSurfaceTelemetryAggregator()->setSamplingInterval(
+        arkJs.getDouble(args[1]));
+  } catch (...) {
+    ArkTSBridge::getInstance()->handleError(std::current_exception());
+  }
+  return arkJs.getUndefined();
+}
+
+static napi_value getSurfaceTelemetry(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  try {
+    auto args = arkJs.getCallbackArgs(info, 1);
+    size_t instanceId = arkJs.getDouble(args[0]);
+    auto lock = std::lock_guard<std::mutex>(rnInstanceByIdMutex);
+    auto it = rnInstanceById.find(instanceId);
+    if (it == rnInstanceById.end()) {
+      return arkJs.getUndefined();
+    }
+    return arkJs.createString(
+        it->second->getSurfaceTelemetryAggregator()->toJSON());
+  } catch (...) {
+    ArkTSBridge::getInstance()->handleError(std::current_exception());
+  }
+  return arkJs.getUndefined();
+}
+
+static napi_value dumpSurfaceTelemetry(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  try {
+    auto args = arkJs.getCallbackArgs(info, 2);
+    size_t instanceId = arkJs.getDouble(args[0]);
+    auto lock = std::lock_guard<std::mutex>(rnInstanceByIdMutex);
+    auto it = rnInstanceById.find(instanceId);
+    if (it == rnInstanceById.end()) {
+      return arkJs.createBoolean(false);
+    }
+    return arkJs.createBoolean(
+        it->second->getSurfaceTelemetryAggregator()->dumpToFile(
+            arkJs.getString(args[1])));
+  } catch (...) {
+    ArkTSBridge::getInstance()->handleError(std::current_exception());
+  }
+  return arkJs.createBoolean(false);
+}
+
+static napi_value getContinuousEventStats(
+    napi_env env,
+    napi_callback_info info) {
+  ArkJS arkJs(env);
+  try {
+    auto args = arkJs.getCallbackArgs(info, 1);
+    size_t instanceId = arkJs.getDouble(args[0]);
+    auto lock = std::lock_guard<std::mutex>(rnInstanceByIdMutex);
+    auto it = rnInstanceById.find(instanceId);
+    if (it == rnInstanceById.end()) {
+      return arkJs.getUndefined();
+    }
+    // events are coalesced only in the C-API architecture
+    auto* rnInstanceCAPI = dynamic_cast<RNInstanceCAPI*>(it->second.get());
+    if (rnInstanceCAPI == nullptr) {
+      return arkJs.createString("[]");
+    }
+    return arkJs.createString(
+        rnInstanceCAPI->getContinuousEventCoalescer()->getStatsJSON());
+  } catch (...) {
+    ArkTSBridge::getInstance()->handleError(std::current_exception());
+  }
+  return arkJs.getUndefined();
+}
+
 static napi_value updateSurfaceConstraints(
     napi_env env,
     napi_callback_info info) {
@@ -572,6 +845,70 @@ static napi_value Init(napi_env env, napi_value exports) {
        nullptr,
        napi_default,
        nullptr},
+      {"loadScriptFromFile",
+       nullptr,
+       loadScriptFromFile,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"registerSegment",
+       nullptr,
+       registerSegment,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"logMarker",
+       nullptr,
+       logMarker,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"getStartupTimeline",
+       nullptr,
+       getStartupTimeline,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"setSurfaceTelemetrySamplingInterval",
+       nullptr,
+       setSurfaceTelemetrySamplingInterval,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"getSurfaceTelemetry",
+       nullptr,
+       getSurfaceTelemetry,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"dumpSurfaceTelemetry",
+       nullptr,
+       dumpSurfaceTelemetry,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"getContinuousEventStats",
+       nullptr,
+       getContinuousEventStats,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
       {"startSurface",
        nullptr,
        startSurface,
@@ -675,6 +1012,46 @@ static napi_value Init(napi_env env, napi_value exports) {
        nullptr,
        nullptr,
        napi_default,
+       nullptr},
+      {"initializeHermesCodeCache",
+       nullptr,
+       initializeHermesCodeCache,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"storeHermesBytecode",
+       nullptr,
+       storeHermesBytecode,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"initializeImageLoader",
+       nullptr,
+       initializeImageLoader,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"destroyImageLoader",
+       nullptr,
+       destroyImageLoader,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
+       nullptr},
+      {"getImageLoaderStats",
+       nullptr,
+       getImageLoaderStats,
+       nullptr,
+       nullptr,
+       nullptr,
+       napi_default,
        nullptr}};
 
   napi_define_properties(
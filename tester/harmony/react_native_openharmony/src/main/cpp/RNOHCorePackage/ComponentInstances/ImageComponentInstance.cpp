@@ -2,7 +2,9 @@
 #include <react/renderer/components/image/ImageProps.h>
 #include <react/renderer/components/image/ImageState.h>
 #include <react/renderer/core/ConcreteState.h>
+#include <cmath>
 #include <sstream>
+#include "RNOH/ImageLoader/PixelMapImageDecoder.h"
 
 namespace rnoh {
 
@@ -14,14 +16,18 @@ ImageComponentInstance::ImageComponentInstance(Context context)
   this->getLocalRootArkUINode().setDraggable(false);
 }
 
+ImageComponentInstance::~ImageComponentInstance() {
+  cancelRequest();
+}
+
 void ImageComponentInstance::onPropsChanged(SharedConcreteProps const& props) {
   CppComponentInstance::onPropsChanged(props);
 
   auto rawProps = ImageRawProps::getFromDynamic(props->rawProps);
 
   if (!m_props || m_props->sources != props->sources) {
-    this->getLocalRootArkUINode().setSources(props->sources);
-    if (!this->getLocalRootArkUINode().getUri().empty()) {
+    setSources(props->sources);
+    if (!m_sourceUri.empty()) {
       onLoadStart();
     }
   }
@@ -85,8 +91,7 @@ void ImageComponentInstance::onPropsChanged(SharedConcreteProps const& props) {
 
 void ImageComponentInstance::onStateChanged(SharedConcreteState const& state) {
   CppComponentInstance::onStateChanged(state);
-  auto vector = {state->getData().getImageSource()};
-  this->getLocalRootArkUINode().setSources(vector);
+  setSources({state->getData().getImageSource()});
   this->getLocalRootArkUINode().setBlur(state->getData().getBlurRadius());
 }
 
@@ -94,7 +99,216 @@ ImageNode& ImageComponentInstance::getLocalRootArkUINode() {
   return m_imageNode;
 }
 
+void ImageComponentInstance::finalizeUpdates() {
+  CppComponentInstance::finalizeUpdates();
+  // requested once the layout is known, so that the image is decoded at the
+  // size it's displayed at
+  maybeRequestImage();
+  // the image may have been moved in or out of the viewport
+  updateRequestPriority();
+  updateObservedScrollView();
+}
+
+void ImageComponentInstance::setSources(
+    facebook::react::ImageSources const& sources) {
+  m_sourceUri = sources.empty() ? std::string() : sources[0].uri;
+  auto imageLoader = ImageLoader::getInstance();
+  if (imageLoader == nullptr || !imageLoader->canLoad(m_sourceUri)) {
+    cancelRequest();
+    m_requestedUri.clear();
+    m_requestedTarget.reset();
+    this->getLocalRootArkUINode().setSources(sources);
+    m_decodedImage = nullptr;
+  }
+}
+
+void ImageComponentInstance::maybeRequestImage() {
+  auto imageLoader = ImageLoader::getInstance();
+  if (imageLoader == nullptr || !imageLoader->canLoad(m_sourceUri)) {
+    return;
+  }
+  auto target = getDecodeTarget();
+  if (target.has_value()) {
+    target = target->getBucketed();
+  }
+  if (m_sourceUri == m_requestedUri && target == m_requestedTarget) {
+    return;
+  }
+  auto rnInstance = m_deps->rnInstance.lock();
+  if (rnInstance == nullptr) {
+    return;
+  }
+  cancelRequest();
+  m_requestedUri = m_sourceUri;
+  m_requestedTarget = target;
+  m_requestPriority = getLoadPriority();
+  auto taskExecutor = rnInstance->getTaskExecutor();
+  auto weakSelf = std::weak_ptr<ComponentInstance>(shared_from_this());
+  auto uri = m_sourceUri;
+  m_requestId = imageLoader->loadImage(
+      uri,
+      target,
+      m_requestPriority,
+      [taskExecutor, weakSelf, uri, target](auto const& image) {
+        taskExecutor->runTask(TaskThread::MAIN, [weakSelf, uri, target, image] {
+          auto self = std::static_pointer_cast<ImageComponentInstance>(
+              weakSelf.lock());
+          // the source or the size may have changed in the meantime
+          if (self != nullptr && self->m_requestedUri == uri &&
+              self->m_requestedTarget == target) {
+            self->m_requestId = 0;
+            self->updateObservedScrollView();
+            self->onImageLoaded(image);
+          }
+        });
+      },
+      [taskExecutor, weakSelf, uri, target](auto const& errorMessage) {
+        LOG(ERROR) << "Failed to load the image: " << errorMessage;
+        taskExecutor->runTask(TaskThread::MAIN, [weakSelf, uri, target] {
+          auto self = std::static_pointer_cast<ImageComponentInstance>(
+              weakSelf.lock());
+          if (self != nullptr && self->m_requestedUri == uri &&
+              self->m_requestedTarget == target) {
+            self->m_requestId = 0;
+            self->updateObservedScrollView();
+            self->onError(0);
+          }
+        });
+      });
+}
+
+void ImageComponentInstance::cancelRequest() {
+  if (m_requestId != 0) {
+    if (auto imageLoader = ImageLoader::getInstance()) {
+      imageLoader->cancelRequest(m_requestId);
+    }
+    m_requestId = 0;
+  }
+  updateObservedScrollView();
+}
+
+void ImageComponentInstance::updateRequestPriority() {
+  if (m_requestId == 0) {
+    return;
+  }
+  auto priority = getLoadPriority();
+  if (priority == m_requestPriority) {
+    return;
+  }
+  m_requestPriority = priority;
+  if (auto imageLoader = ImageLoader::getInstance()) {
+    imageLoader->setRequestPriority(m_requestId, priority);
+  }
+}
+
+void ImageComponentInstance::updateObservedScrollView() {
+  std::shared_ptr<ScrollViewComponentInstance> scrollView;
+  if (m_requestId != 0) {
+    facebook::react::Rect frame;
+    scrollView = findScrollView(frame);
+  }
+  auto observedScrollView = m_observedScrollView.lock();
+  if (scrollView == observedScrollView) {
+    return;
+  }
+  if (observedScrollView != nullptr) {
+    observedScrollView->removeViewportObserver(this);
+  }
+  if (scrollView != nullptr) {
+    scrollView->addViewportObserver(
+        std::static_pointer_cast<ImageComponentInstance>(shared_from_this()));
+  }
+  m_observedScrollView = scrollView;
+}
+
+void ImageComponentInstance::onViewportChanged() {
+  updateRequestPriority();
+}
+
+ImageLoader::Priority ImageComponentInstance::getLoadPriority() const {
+  facebook::react::Rect frame;
+  auto scrollView = findScrollView(frame);
+  // images outside of ScrollViews are assumed to be visible
+  if (scrollView == nullptr) {
+    return ImageLoader::Priority::HIGH;
+  }
+  auto viewportRect = scrollView->getViewportRect();
+  bool isVisible = frame.getMaxX() > viewportRect.getMinX() &&
+      frame.getMinX() < viewportRect.getMaxX() &&
+      frame.getMaxY() > viewportRect.getMinY() &&
+      frame.getMinY() < viewportRect.getMaxY();
+  return isVisible ? ImageLoader::Priority::HIGH : ImageLoader::Priority::LOW;
+}
+
+std::shared_ptr<ScrollViewComponentInstance>
+ImageComponentInstance::findScrollView(facebook::react::Rect& frame) const {
+  // frames are relative to the parent, so the frame in the ScrollView's
+  // content is the sum of the origins on the way to it
+  frame = m_layoutMetrics.frame;
+  auto ancestor = getParent().lock();
+  while (ancestor != nullptr) {
+    if (auto scrollView =
+            std::dynamic_pointer_cast<ScrollViewComponentInstance>(ancestor)) {
+      return scrollView;
+    }
+    frame.origin += ancestor->getLayoutMetrics().frame.origin;
+    ancestor = ancestor->getParent().lock();
+  }
+  return nullptr;
+}
+
+std::optional<ImageDecodeTarget> ImageComponentInstance::getDecodeTarget()
+    const {
+  // "scale" asks for the whole image to be decoded and scaled when drawn;
+  // repeated images are drawn at their source size
+  if (m_rawProps.resizeMethod == "scale" || m_props == nullptr ||
+      m_props->resizeMode == facebook::react::ImageResizeMode::Repeat) {
+    return std::nullopt;
+  }
+  auto scale = m_layoutMetrics.pointScaleFactor;
+  auto width = std::ceil(m_layoutMetrics.frame.size.width * scale);
+  auto height = std::ceil(m_layoutMetrics.frame.size.height * scale);
+  if (!(width > 0) || !(height > 0)) {
+    return std::nullopt;
+  }
+  auto scaleMode =
+      (m_props->resizeMode == facebook::react::ImageResizeMode::Contain ||
+       m_props->resizeMode == facebook::react::ImageResizeMode::Center)
+      ? ImageDecodeTarget::ScaleMode::CONTAIN
+      : ImageDecodeTarget::ScaleMode::COVER;
+  return ImageDecodeTarget{
+      .width = static_cast<uint32_t>(width),
+      .height = static_cast<uint32_t>(height),
+      .scaleMode = scaleMode};
+}
+
+void ImageComponentInstance::onImageLoaded(ImageLoader::Image const& image) {
+  auto pixelMapImage =
+      std::dynamic_pointer_cast<PixelMapImage const>(image.decodedImage);
+  // the previous PixelMap is released after the node stops displaying it
+  if (pixelMapImage == nullptr) {
+    // e.g. an animated image, displayed from its local copy
+    this->getLocalRootArkUINode().setLocalSource(image.uri, m_sourceUri);
+    m_decodedImage = nullptr;
+    return;
+  }
+  this->getLocalRootArkUINode().setPixelMap(
+      pixelMapImage->getPixelMap(), m_sourceUri);
+  m_decodedImage = pixelMapImage;
+  // JS expects the size of the source, not of the downsampled bitmap
+  dispatchLoadEvent(
+      pixelMapImage->getSourceWidth(), pixelMapImage->getSourceHeight());
+}
+
 void ImageComponentInstance::onComplete(float width, float height) {
+  // images decoded by ImageLoader dispatch the load event themselves
+  if (m_decodedImage != nullptr) {
+    return;
+  }
+  dispatchLoadEvent(width, height);
+}
+
+void ImageComponentInstance::dispatchLoadEvent(float width, float height) {
   if (m_eventEmitter == nullptr) {
     return;
   }
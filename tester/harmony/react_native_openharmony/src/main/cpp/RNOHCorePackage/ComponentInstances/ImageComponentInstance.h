@@ -3,12 +3,15 @@
 #include <react/renderer/components/image/ImageEventEmitter.h>
 #include <react/renderer/components/image/ImageShadowNode.h>
 #include "RNOH/CppComponentInstance.h"
+#include "RNOH/ImageLoader/ImageLoader.h"
 #include "RNOH/arkui/ImageNode.h"
+#include "ScrollViewComponentInstance.h"
 
 namespace rnoh {
 class ImageComponentInstance
     : public CppComponentInstance<facebook::react::ImageShadowNode>,
-      public ImageNodeDelegate {
+      public ImageNodeDelegate,
+      public ScrollViewportObserver {
  private:
   ImageNode m_imageNode;
   struct ImageRawProps {
@@ -19,16 +22,43 @@ class ImageComponentInstance
     static ImageRawProps getFromDynamic(folly::dynamic value);
   };
   ImageRawProps m_rawProps;
+  std::string m_sourceUri;
+  // the URI and the target of the last ImageLoader request
+  std::string m_requestedUri;
+  std::optional<ImageDecodeTarget> m_requestedTarget;
+  ImageLoader::RequestId m_requestId = 0;
+  ImageLoader::Priority m_requestPriority = ImageLoader::Priority::HIGH;
+  // notifies about scrolling while the request is pending
+  std::weak_ptr<ScrollViewComponentInstance> m_observedScrollView;
+  // keeps the PixelMap displayed by the node alive
+  DecodedImage::Shared m_decodedImage;
+
+  void setSources(facebook::react::ImageSources const& sources);
+  void maybeRequestImage();
+  void cancelRequest();
+  void updateRequestPriority();
+  void updateObservedScrollView();
+  std::optional<ImageDecodeTarget> getDecodeTarget() const;
+  ImageLoader::Priority getLoadPriority() const;
+  std::shared_ptr<ScrollViewComponentInstance> findScrollView(
+      facebook::react::Rect& frame) const;
+  void onImageLoaded(ImageLoader::Image const& image);
+  void dispatchLoadEvent(float width, float height);
 
  public:
   ImageComponentInstance(Context context);
+  ~ImageComponentInstance() override;
   void onPropsChanged(SharedConcreteProps const& props) override;
   void onStateChanged(SharedConcreteState const& state) override;
+  void finalizeUpdates() override;
 
   void onComplete(float width, float height) override;
   void onError(int32_t errorCode) override;
   void onLoadStart();
 
+  // ScrollViewportObserver implementation
+  void onViewportChanged() override;
+
   ImageNode& getLocalRootArkUINode() override;
 };
 } // namespace rnoh
@@ -2,9 +2,11 @@
 #include <react/renderer/components/scrollview/ScrollViewShadowNode.h>
 #include <react/renderer/components/scrollview/ScrollViewState.h>
 #include <react/renderer/core/ConcreteState.h>
+#include <algorithm>
 #include <cmath>
 #include <optional>
 #include "PullToRefreshViewComponentInstance.h"
+#include "ViewComponentInstance.h"
 #include "conversions.h"
 
 namespace rnoh {
@@ -28,6 +30,11 @@ void ScrollViewComponentInstance::onChildInserted(
   CppComponentInstance::onChildInserted(childComponentInstance, index);
   m_contentContainerNode.insertChild(
       childComponentInstance->getLocalRootArkUINode(), index);
+  if (auto contentContainer =
+          std::dynamic_pointer_cast<ViewComponentInstance>(
+              childComponentInstance)) {
+    contentContainer->setClippingRect(getClippingRect(contentContainer));
+  }
 }
 
 void ScrollViewComponentInstance::onChildRemoved(
@@ -35,12 +42,18 @@ void ScrollViewComponentInstance::onChildRemoved(
   CppComponentInstance::onChildRemoved(childComponentInstance);
   m_contentContainerNode.removeChild(
       childComponentInstance->getLocalRootArkUINode());
+  if (auto contentContainer =
+          std::dynamic_pointer_cast<ViewComponentInstance>(
+              childComponentInstance)) {
+    contentContainer->setClippingRect(std::nullopt);
+  }
 }
 
 void ScrollViewComponentInstance::setLayout(
     facebook::react::LayoutMetrics layoutMetrics) {
   m_scrollContainerNode.setSize(layoutMetrics.frame.size);
   m_scrollNode.setSize(layoutMetrics.frame.size);
+  auto isFrameChanged = layoutMetrics.frame != m_layoutMetrics.frame;
   m_layoutMetrics = layoutMetrics;
   if (m_containerSize != layoutMetrics.frame.size) {
     m_containerSize = layoutMetrics.frame.size;
@@ -49,6 +62,10 @@ void ScrollViewComponentInstance::setLayout(
                                         : ARKUI_SCROLL_NESTED_MODE_SELF_ONLY);
   }
   markBoundingBoxAsDirty();
+  auto parent = getParent().lock();
+  if (isFrameChanged && parent != nullptr) {
+    parent->onChildLayoutChanged(*this);
+  }
 }
 
 void rnoh::ScrollViewComponentInstance::onStateChanged(
@@ -71,6 +88,10 @@ void rnoh::ScrollViewComponentInstance::onPropsChanged(
     m_persistentScrollbar = props->rawProps["persistentScrollbar"].asBool();
   }
   m_scrollEventThrottle = props->scrollEventThrottle;
+  if (m_removeClippedSubviews != props->removeClippedSubviews) {
+    m_removeClippedSubviews = props->removeClippedSubviews;
+    updateClippingRect();
+  }
   m_disableIntervalMomentum = props->disableIntervalMomentum;
   m_scrollNode.setHorizontal(isHorizontal(props))
       .setEnableScrollInteraction(
@@ -180,6 +201,54 @@ bool ScrollViewComponentInstance::isHandlingTouches() const {
   return m_scrollState != IDLE;
 }
 
+facebook::react::Rect ScrollViewComponentInstance::getViewportRect() const {
+  return {.origin = m_scrollNode.getScrollOffset(), .size = m_containerSize};
+}
+
+void ScrollViewComponentInstance::addViewportObserver(
+    std::weak_ptr<ScrollViewportObserver> observer) {
+  auto lockedObserver = observer.lock();
+  removeViewportObserver(lockedObserver.get());
+  if (lockedObserver != nullptr) {
+    m_viewportObservers.push_back(std::move(observer));
+  }
+}
+
+void ScrollViewComponentInstance::removeViewportObserver(
+    ScrollViewportObserver const* observer) {
+  // expired observers are dropped as well
+  m_viewportObservers.erase(
+      std::remove_if(
+          m_viewportObservers.begin(),
+          m_viewportObservers.end(),
+          [observer](auto const& viewportObserver) {
+            auto lockedObserver = viewportObserver.lock();
+            return lockedObserver == nullptr ||
+                lockedObserver.get() == observer;
+          }),
+      m_viewportObservers.end());
+}
+
+void ScrollViewComponentInstance::notifyViewportObservers() {
+  if (m_viewportObservers.empty()) {
+    return;
+  }
+  // observers may remove themselves when notified, so they are locked first
+  std::vector<std::shared_ptr<ScrollViewportObserver>> observers;
+  observers.reserve(m_viewportObservers.size());
+  for (auto const& viewportObserver : m_viewportObservers) {
+    if (auto observer = viewportObserver.lock()) {
+      observers.push_back(std::move(observer));
+    }
+  }
+  if (observers.size() != m_viewportObservers.size()) {
+    removeViewportObserver(nullptr);
+  }
+  for (auto const& observer : observers) {
+    observer->onViewportChanged();
+  }
+}
+
 void ScrollViewComponentInstance::onScroll() {
   auto scrollViewMetrics = getScrollViewMetrics();
   if (!isContentSmallerThanContainer() && m_allowScrollPropagation &&
@@ -187,6 +256,15 @@ void ScrollViewComponentInstance::onScroll() {
     m_scrollNode.setNestedScroll(ARKUI_SCROLL_NESTED_MODE_SELF_ONLY);
     m_allowScrollPropagation = false;
   }
+  // the overscan covers the viewport until it moves by half of its size
+  if (m_removeClippedSubviews &&
+      (std::abs(scrollViewMetrics.contentOffset.x - m_clippingRectOffset.x) >
+           m_containerSize.width / 2 ||
+       std::abs(scrollViewMetrics.contentOffset.y - m_clippingRectOffset.y) >
+           m_containerSize.height / 2)) {
+    updateClippingRect();
+  }
+  notifyViewportObservers();
   auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
                  std::chrono::steady_clock::now().time_since_epoch())
                  .count();
@@ -200,7 +278,13 @@ void ScrollViewComponentInstance::onScroll() {
             << scrollViewMetrics.contentSize.height
             << "; containerSize: " << scrollViewMetrics.containerSize.width
             << ", " << scrollViewMetrics.containerSize.height << ")";
-    m_eventEmitter->onScroll(scrollViewMetrics);
+    // while JS is busy, only the latest scroll event is kept
+    m_deps->continuousEventCoalescer->dispatchEvent(
+        m_tag,
+        "scroll",
+        [eventEmitter = m_eventEmitter, scrollViewMetrics] {
+          eventEmitter->onScroll(scrollViewMetrics);
+        });
     sendEventForNativeAnimations(scrollViewMetrics);
     m_currentOffset = scrollViewMetrics.contentOffset;
   };
@@ -237,6 +321,7 @@ float ScrollViewComponentInstance::onScrollFrameBegin(
     } else if (m_scrollState == ScrollState::FLING) {
       emitOnMomentumScrollEndEvent();
     }
+    m_deps->continuousEventCoalescer->flush(m_tag);
     auto scrollViewMetrics = getScrollViewMetrics();
     if (scrollState == ScrollState::SCROLL) {
       m_eventEmitter->onScrollBeginDrag(scrollViewMetrics);
@@ -253,11 +338,13 @@ void ScrollViewComponentInstance::emitOnScrollEndDragEvent() {
     disableIntervalMomentum();
   }
   auto scrollViewMetrics = getScrollViewMetrics();
+  m_deps->continuousEventCoalescer->flush(m_tag);
   m_eventEmitter->onScrollEndDrag(scrollViewMetrics);
   updateStateWithContentOffset(scrollViewMetrics.contentOffset);
 }
 void ScrollViewComponentInstance::emitOnMomentumScrollEndEvent() {
   auto scrollViewMetrics = getScrollViewMetrics();
+  m_deps->continuousEventCoalescer->flush(m_tag);
   m_eventEmitter->onMomentumScrollEnd(scrollViewMetrics);
   updateStateWithContentOffset(scrollViewMetrics.contentOffset);
 }
@@ -345,6 +432,8 @@ bool ScrollViewComponentInstance::scrollMovedBySignificantOffset(
 
 void ScrollViewComponentInstance::finalizeUpdates() {
   ComponentInstance::finalizeUpdates();
+  updateClippingRect();
+  notifyViewportObservers();
 
   // when parent isn't refresh node, set the position
   auto parent = this->getParent().lock();
@@ -582,4 +671,34 @@ ScrollViewComponentInstance::getFirstVisibleView(int32_t minIndexForVisible) {
       {lastChild->getTag(), position});
 }
 
-} // namespace rnoh
+void ScrollViewComponentInstance::updateClippingRect() {
+  m_clippingRectOffset = m_scrollNode.getScrollOffset();
+  for (auto const& child : m_children) {
+    if (auto contentContainer =
+            std::dynamic_pointer_cast<ViewComponentInstance>(child)) {
+      contentContainer->setClippingRect(getClippingRect(contentContainer));
+    }
+  }
+}
+
+std::optional<facebook::react::Rect>
+ScrollViewComponentInstance::getClippingRect(
+    ComponentInstance::Shared const& child) const {
+  if (!m_removeClippedSubviews) {
+    return std::nullopt;
+  }
+  // children within one viewport from the visible area stay attached, so
+  // that they are laid out before they are scrolled into view
+  auto overscan = m_containerSize;
+  auto contentOffset = m_scrollNode.getScrollOffset();
+  auto childOrigin = child->getLayoutMetrics().frame.origin;
+  return facebook::react::Rect{
+      .origin =
+          {.x = contentOffset.x - childOrigin.x - overscan.width,
+           .y = contentOffset.y - childOrigin.y - overscan.height},
+      .size = {
+          .width = m_containerSize.width + 2 * overscan.width,
+          .height = m_containerSize.height + 2 * overscan.height}};
+}
+
+} // namespace rnoh
\ No newline at end of file
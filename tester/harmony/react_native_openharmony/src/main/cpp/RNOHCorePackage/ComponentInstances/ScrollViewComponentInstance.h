@@ -8,6 +8,16 @@
 
 namespace rnoh {
 
+/**
+ * Notified when the visible part of a ScrollView's content changes, e.g. to
+ * load visible images first.
+ */
+class ScrollViewportObserver {
+ public:
+  virtual ~ScrollViewportObserver() = default;
+  virtual void onViewportChanged() = 0;
+};
+
 class ScrollViewComponentInstance
     : public CppComponentInstance<facebook::react::ScrollViewShadowNode>,
       public ScrollNodeDelegate {
@@ -35,6 +45,9 @@ class ScrollViewComponentInstance
   float m_recentScrollFrameOffset = 0;
   std::vector<facebook::react::Float> m_snapToOffsets = {};
   std::optional<ChildTagWithOffset> m_firstVisibleView = std::nullopt;
+  bool m_removeClippedSubviews = false;
+  facebook::react::Point m_clippingRectOffset = {0, 0};
+  std::vector<std::weak_ptr<ScrollViewportObserver>> m_viewportObservers;
 
   facebook::react::Float getFrictionFromDecelerationRate(
       facebook::react::Float decelerationRate);
@@ -66,6 +79,10 @@ class ScrollViewComponentInstance
           scrollViewMaintainVisibleContentPosition);
   std::optional<ChildTagWithOffset> getFirstVisibleView(
       int32_t minIndexForVisible);
+  void updateClippingRect();
+  std::optional<facebook::react::Rect> getClippingRect(
+      ComponentInstance::Shared const& child) const;
+  void notifyViewportObservers();
 
  public:
   ScrollViewComponentInstance(Context context);
@@ -103,6 +120,23 @@ class ScrollViewComponentInstance
 
   bool isHandlingTouches() const override;
 
+  /**
+   * Visible part of the content, in the coordinate space of the content
+   * container's frame.
+   */
+  facebook::react::Rect getViewportRect() const;
+
+  /**
+   * Observers are held weakly, so an observer destroyed without being
+   * removed is dropped on the next notification.
+   */
+  void addViewportObserver(std::weak_ptr<ScrollViewportObserver> observer);
+  /**
+   * Takes a raw pointer, so an observer can remove itself from its
+   * destructor.
+   */
+  void removeViewportObserver(ScrollViewportObserver const* observer);
+
  protected:
   void onNativeResponderBlockChange(bool isBlocked) override;
 
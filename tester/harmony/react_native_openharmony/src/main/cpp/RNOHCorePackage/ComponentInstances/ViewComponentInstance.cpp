@@ -2,7 +2,7 @@
 
 namespace rnoh {
 ViewComponentInstance::ViewComponentInstance(Context context)
-    : CppComponentInstance(std::move(context)) {
+    : CppComponentInstance(std::move(context)), m_childrenClipping(this) {
   m_stackNode.setStackNodeDelegate(this);
 }
 
@@ -10,16 +10,66 @@ void ViewComponentInstance::onChildInserted(
     ComponentInstance::Shared const& childComponentInstance,
     std::size_t index) {
   CppComponentInstance::onChildInserted(childComponentInstance, index);
+  // the child is clipped, if needed, once updates are finalized
   m_stackNode.insertChild(
-      childComponentInstance->getLocalRootArkUINode(), index);
+      childComponentInstance->getLocalRootArkUINode(),
+      m_childrenClipping.onChildInserted(index));
 }
 
 void ViewComponentInstance::onChildRemoved(
     ComponentInstance::Shared const& childComponentInstance) {
   CppComponentInstance::onChildRemoved(childComponentInstance);
+  if (m_childrenClipping.onChildRemoved(childComponentInstance->getTag())) {
+    return;
+  }
   m_stackNode.removeChild(childComponentInstance->getLocalRootArkUINode());
 };
 
+void ViewComponentInstance::onChildLayoutChanged(
+    ComponentInstance const& child) {
+  if (m_childrenClipping.hasClippingRect()) {
+    m_childrenClipping.onChildFrameChanged(
+        child.getTag(), child.getLayoutMetrics().frame);
+  }
+}
+
+void ViewComponentInstance::finalizeUpdates() {
+  CppComponentInstance::finalizeUpdates();
+  if (m_childrenClipping.hasClippingRect()) {
+    m_childrenClipping.updateClippedChildren();
+  }
+}
+
+void ViewComponentInstance::setClippingRect(
+    std::optional<facebook::react::Rect> clippingRect) {
+  m_childrenClipping.setClippingRect(std::move(clippingRect));
+}
+
+std::size_t ViewComponentInstance::getChildrenCount() const {
+  return m_children.size();
+}
+
+facebook::react::Tag ViewComponentInstance::getChildTag(
+    std::size_t index) const {
+  return m_children[index]->getTag();
+}
+
+facebook::react::Rect ViewComponentInstance::getChildFrame(
+    std::size_t index) const {
+  return m_children[index]->getLayoutMetrics().frame;
+}
+
+void ViewComponentInstance::attachChildNode(
+    std::size_t index,
+    std::size_t arkUINodeIndex) {
+  m_stackNode.insertChild(
+      m_children[index]->getLocalRootArkUINode(), arkUINodeIndex);
+}
+
+void ViewComponentInstance::detachChildNode(std::size_t index) {
+  m_stackNode.removeChild(m_children[index]->getLocalRootArkUINode());
+}
+
 void ViewComponentInstance::onClick() {
   if (m_eventEmitter != nullptr) {
     m_eventEmitter->dispatchEvent(
@@ -1,14 +1,19 @@
 #pragma once
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/graphics/Rect.h>
+#include <optional>
+#include "RNOH/ChildrenClipping.h"
 #include "RNOH/CppComponentInstance.h"
 #include "RNOH/arkui/StackNode.h"
 
 namespace rnoh {
 class ViewComponentInstance
     : public CppComponentInstance<facebook::react::ViewShadowNode>,
-      public StackNodeDelegate {
+      public StackNodeDelegate,
+      public ChildrenClippingDelegate {
  private:
   StackNode m_stackNode;
+  ChildrenClipping m_childrenClipping;
 
  public:
   ViewComponentInstance(Context context);
@@ -18,8 +23,27 @@ class ViewComponentInstance
       std::size_t index) override;
   void onChildRemoved(
       ComponentInstance::Shared const& childComponentInstance) override;
+  void onChildLayoutChanged(ComponentInstance const& child) override;
+
+  void finalizeUpdates() override;
+
+  /**
+   * Detaches ArkUI nodes of children whose frames don't intersect the rect,
+   * without removing them from the component tree, so that ArkUI doesn't lay
+   * out and draw them. The rect is in the coordinate space of this component.
+   * Passing nullopt reattaches every child.
+   */
+  void setClippingRect(std::optional<facebook::react::Rect> clippingRect);
+
+  // ChildrenClippingDelegate implementation
+  std::size_t getChildrenCount() const override;
+  facebook::react::Tag getChildTag(std::size_t index) const override;
+  facebook::react::Rect getChildFrame(std::size_t index) const override;
+  void attachChildNode(std::size_t index, std::size_t arkUINodeIndex)
+      override;
+  void detachChildNode(std::size_t index) override;
 
   void onClick() override;
   StackNode& getLocalRootArkUINode() override;
 };
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
@@ -23,6 +23,10 @@ class ImageEventEmitRequestHandler : public EventEmitRequestHandler {
     return {width, height, uri};
   }
 
+  std::vector<std::string> getEventNames() const override {
+    return {"loadStart", "load", "error", "loadEnd"};
+  }
+
   void handleEvent(EventEmitRequestHandler::Context const& ctx) override {
     if (ctx.eventName != "loadStart" && ctx.eventName != "load" &&
         ctx.eventName != "error" && ctx.eventName != "loadEnd") {
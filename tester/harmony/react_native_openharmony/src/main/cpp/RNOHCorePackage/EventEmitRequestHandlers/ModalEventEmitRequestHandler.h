@@ -9,6 +9,10 @@ namespace rnoh {
 
 class ModalEventEmitRequestHandler : public EventEmitRequestHandler {
  public:
+  std::vector<std::string> getEventNames() const override {
+    return {"onShow", "onDismiss", "onRequestClose"};
+  }
+
   void handleEvent(EventEmitRequestHandler::Context const& ctx) override {
     auto eventName = ctx.eventName;
     auto eventEmitter =
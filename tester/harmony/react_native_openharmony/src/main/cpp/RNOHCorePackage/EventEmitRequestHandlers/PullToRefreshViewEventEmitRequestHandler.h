@@ -7,6 +7,10 @@ namespace rnoh {
 
 class PullToRefreshViewEventEmitRequestHandler
     : public EventEmitRequestHandler {
+  std::vector<std::string> getEventNames() const override {
+    return {"refresh"};
+  }
+
   void handleEvent(EventEmitRequestHandler::Context const& ctx) override {
     if (ctx.eventName != "refresh") {
       return;
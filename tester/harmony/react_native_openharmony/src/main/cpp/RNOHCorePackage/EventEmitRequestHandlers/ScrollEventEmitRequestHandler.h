@@ -14,6 +14,35 @@ enum ScrollEventType {
   UNSUPPORTED = 5
 };
 
+/**
+ * Keys of scroll events encoded as MapBuffer. Keep in sync with
+ * `ScrollEventKey` in RNScrollView/types.ts.
+ */
+enum ScrollEventKey : facebook::react::MapBuffer::Key {
+  CONTENT_SIZE_WIDTH = 0,
+  CONTENT_SIZE_HEIGHT = 1,
+  CONTENT_OFFSET_X = 2,
+  CONTENT_OFFSET_Y = 3,
+  CONTAINER_SIZE_WIDTH = 4,
+  CONTAINER_SIZE_HEIGHT = 5,
+  ZOOM_SCALE = 6,
+  RESPONDER_IGNORE_SCROLL = 7
+};
+
+facebook::react::ScrollViewMetrics convertScrollEvent(
+    facebook::react::MapBuffer const& eventMapBuffer) {
+  auto getFloat = [&](ScrollEventKey key) {
+    return (float)eventMapBuffer.getDouble(key);
+  };
+  return {
+      {getFloat(CONTENT_SIZE_WIDTH), getFloat(CONTENT_SIZE_HEIGHT)},
+      {getFloat(CONTENT_OFFSET_X), getFloat(CONTENT_OFFSET_Y)},
+      {},
+      {getFloat(CONTAINER_SIZE_WIDTH), getFloat(CONTAINER_SIZE_HEIGHT)},
+      getFloat(ZOOM_SCALE),
+      eventMapBuffer.getBool(RESPONDER_IGNORE_SCROLL)};
+}
+
 facebook::react::ScrollViewMetrics convertScrollEvent(
     ArkJS& arkJs,
     napi_value eventObject) {
@@ -66,6 +95,15 @@ ScrollEventType getScrollEventType(std::string const& eventType) {
 }
 
 class ScrollEventEmitRequestHandler : public EventEmitRequestHandler {
+  std::vector<std::string> getEventNames() const override {
+    return {
+        "onScrollBeginDrag",
+        "onScrollEndDrag",
+        "onMomentumScrollBegin",
+        "onMomentumScrollEnd",
+        "onScroll"};
+  }
+
   void handleEvent(EventEmitRequestHandler::Context const& ctx) override {
     auto eventType = getScrollEventType(ctx.eventName);
     if (eventType == ScrollEventType::UNSUPPORTED) {
@@ -80,7 +118,10 @@ class ScrollEventEmitRequestHandler : public EventEmitRequestHandler {
     }
 
     ArkJS arkJs(ctx.env);
-    auto event = convertScrollEvent(arkJs, ctx.payload);
+    // components which aren't migrated to MapBuffer still emit objects
+    auto event = arkJs.isArrayBuffer(ctx.payload)
+        ? convertScrollEvent(arkJs.getMapBuffer(ctx.payload))
+        : convertScrollEvent(arkJs, ctx.payload);
 
     switch (eventType) {
       case ScrollEventType::BEGIN_DRAG:
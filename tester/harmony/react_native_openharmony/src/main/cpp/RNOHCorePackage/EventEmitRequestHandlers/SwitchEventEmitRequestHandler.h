@@ -16,6 +16,10 @@ facebook::react::SwitchEventEmitter::OnChange convertSwitchEvent(
 }
 
 class SwitchEventEmitRequestHandler : public EventEmitRequestHandler {
+  std::vector<std::string> getEventNames() const override {
+    return {"onChange"};
+  }
+
   void handleEvent(EventEmitRequestHandler::Context const& ctx) override {
     if (ctx.eventName != "onChange") {
       return;
@@ -67,6 +67,17 @@ TextInputEventType getTextInputEventType(std::string const& eventName) {
 }
 
 class TextInputEventEmitRequestHandler : public EventEmitRequestHandler {
+  std::vector<std::string> getEventNames() const override {
+    return {
+        "TextInputChange",
+        "onSubmitEditing",
+        "onEndEditing",
+        "onFocus",
+        "onBlur",
+        "onKeyPress",
+        "onSelectionChange"};
+  }
+
   void handleEvent(EventEmitRequestHandler::Context const& ctx) override {
     auto eventType = getTextInputEventType(ctx.eventName);
     if (eventType == TextInputEventType::TEXT_INPUT_UNSUPPORTED) {
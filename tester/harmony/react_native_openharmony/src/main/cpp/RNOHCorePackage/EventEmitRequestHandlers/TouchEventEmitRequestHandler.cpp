@@ -1,6 +1,7 @@
 #include "TouchEventEmitRequestHandler.h"
 #include <glog/logging.h>
 #include <react/renderer/components/view/TouchEventEmitter.h>
+#include <optional>
 
 using namespace facebook;
 
@@ -14,27 +15,46 @@ void TouchEventEmitRequestHandler::handleEvent(
 
   ArkJS arkJs(ctx.env);
   auto touchEvent = ctx.payload;
+  bool isMapBuffer = arkJs.isArrayBuffer(touchEvent);
+  std::optional<react::MapBuffer> touchEventMapBuffer;
+  if (isMapBuffer) {
+    touchEventMapBuffer = arkJs.getMapBuffer(touchEvent);
+  }
 
-  auto timestampNanos =
-      arkJs.getDouble(arkJs.getObjectProperty(touchEvent, "timestamp"));
+  auto timestampNanos = isMapBuffer
+      ? touchEventMapBuffer->getDouble(TOUCH_EVENT_TIMESTAMP)
+      : arkJs.getDouble(arkJs.getObjectProperty(touchEvent, "timestamp"));
   // rn expects a timestamp in seconds. We need to convert the timestamp from
   // nanoseconds to miliseconds, use floor to round down and then convert to
   // seconds. RN multiplies it by 1e3 to convert to miliseconds.
   react::Float timestamp = std::floor(timestampNanos / 1e6) / 1e3;
 
-  auto touches = convertTouches(
-      arkJs,
-      ctx.tag,
-      timestamp,
-      arkJs.getObjectProperty(touchEvent, "touches"));
-  auto changedTouches = convertTouches(
-      arkJs,
-      ctx.tag,
-      timestamp,
-      arkJs.getObjectProperty(touchEvent, "changedTouches"));
-
-  auto eventType = (TouchType)(arkJs.getDouble(
-      arkJs.getObjectProperty(ctx.payload, "type")));
+  react::Touches touches;
+  react::Touches changedTouches;
+  TouchType eventType;
+  if (isMapBuffer) {
+    touches = convertTouches(
+        timestamp,
+        touchEventMapBuffer->getMapBufferList(TOUCH_EVENT_TOUCHES));
+    changedTouches = convertTouches(
+        timestamp,
+        touchEventMapBuffer->getMapBufferList(TOUCH_EVENT_CHANGED_TOUCHES));
+    eventType = (TouchType)touchEventMapBuffer->getInt(TOUCH_EVENT_TYPE);
+  } else {
+    touches = convertTouches(
+        arkJs,
+        ctx.tag,
+        timestamp,
+        arkJs.getObjectProperty(touchEvent, "touches"));
+    changedTouches = convertTouches(
+        arkJs,
+        ctx.tag,
+        timestamp,
+        arkJs.getObjectProperty(touchEvent, "changedTouches"));
+    eventType = (TouchType)(arkJs.getDouble(
+        arkJs.getObjectProperty(ctx.payload, "type")));
+  }
+
   bool isTouchEnd =
       eventType == TouchType::UP || eventType == TouchType::CANCEL;
 
@@ -127,4 +147,32 @@ facebook::react::Touches TouchEventEmitRequestHandler::convertTouches(
   return touches;
 }
 
+facebook::react::Touch TouchEventEmitRequestHandler::convertTouchMapBuffer(
+    facebook::react::MapBuffer const& touchMapBuffer) {
+  auto getFloat = [&](TouchKey key) {
+    return (facebook::react::Float)touchMapBuffer.getDouble(key);
+  };
+  return facebook::react::Touch{
+      .pagePoint = {.x = getFloat(TOUCH_PAGE_X), .y = getFloat(TOUCH_PAGE_Y)},
+      .offsetPoint = {.x = getFloat(TOUCH_X), .y = getFloat(TOUCH_Y)},
+      .screenPoint =
+          {.x = getFloat(TOUCH_SCREEN_X), .y = getFloat(TOUCH_SCREEN_Y)},
+      .identifier = touchMapBuffer.getInt(TOUCH_ID),
+      .target = touchMapBuffer.getInt(TOUCH_TARGET_TAG),
+      .force = 1};
+}
+
+facebook::react::Touches TouchEventEmitRequestHandler::convertTouches(
+    facebook::react::Float timestamp,
+    std::vector<facebook::react::MapBuffer> const& touchMapBuffers) {
+  facebook::react::Touches touches;
+  for (auto const& touchMapBuffer : touchMapBuffers) {
+    auto touch = convertTouchMapBuffer(touchMapBuffer);
+    touch.timestamp = timestamp;
+
+    touches.insert(std::move(touch));
+  }
+  return touches;
+}
+
 } // namespace rnoh
\ No newline at end of file
@@ -9,20 +9,53 @@ namespace rnoh {
 
 enum TouchType { DOWN, UP, MOVE, CANCEL };
 
+/**
+ * Keys of touch events encoded as MapBuffer. Keep in sync with
+ * `TouchEventKey` and `TouchKey` in TouchDispatcher.ets.
+ */
+enum TouchEventKey : facebook::react::MapBuffer::Key {
+  TOUCH_EVENT_TIMESTAMP = 0,
+  TOUCH_EVENT_TYPE = 1,
+  TOUCH_EVENT_TOUCHES = 2,
+  TOUCH_EVENT_CHANGED_TOUCHES = 3
+};
+
+enum TouchKey : facebook::react::MapBuffer::Key {
+  TOUCH_ID = 0,
+  TOUCH_TARGET_TAG = 1,
+  TOUCH_SCREEN_X = 2,
+  TOUCH_SCREEN_Y = 3,
+  TOUCH_PAGE_X = 4,
+  TOUCH_PAGE_Y = 5,
+  TOUCH_X = 6,
+  TOUCH_Y = 7
+};
+
 class TouchEventEmitRequestHandler : public EventEmitRequestHandler {
  public:
   void handleEvent(TouchEventEmitRequestHandler::Context const& ctx) override;
 
+  std::vector<std::string> getEventNames() const override {
+    return {"Touch"};
+  }
+
  private:
   facebook::react::Touch convertTouchObject(
       ArkJS& arkJs,
       napi_value touchObject);
 
+  facebook::react::Touch convertTouchMapBuffer(
+      facebook::react::MapBuffer const& touchMapBuffer);
+
   facebook::react::Touches convertTouches(
       ArkJS& arkJs,
       facebook::react::Tag tag,
       facebook::react::Float timestamp,
       napi_value touchArray);
+
+  facebook::react::Touches convertTouches(
+      facebook::react::Float timestamp,
+      std::vector<facebook::react::MapBuffer> const& touchMapBuffers);
 };
 
 } // namespace rnoh
\ No newline at end of file
@@ -19,6 +19,10 @@ ViewEventType getViewEventType(std::string const& eventName) {
 }
 
 class ViewEventEmitRequestHandler : public EventEmitRequestHandler {
+  std::vector<std::string> getEventNames() const override {
+    return {"onClick"};
+  }
+
   void handleEvent(EventEmitRequestHandler::Context const& ctx) override {
     auto eventType = getViewEventType(ctx.eventName);
     if (eventType == ViewEventType::VIEW_UNSUPPORTED) {
@@ -1,9 +1,30 @@
 #include "RNOHCorePackage/TurboModules/BlobTurboModule.h"
+#include <ReactCommon/TurboModuleUtils.h>
+#include <jsi/JSIDynamic.h>
 #include "RNOH/BlobCollector.h"
+#include "RNOH/SharedByteBuffer.h"
 
 namespace rnoh {
 using namespace facebook;
 
+static jsi::Value __hostFunction_BlobTurboModule_createFromArrayBuffer(
+    jsi::Runtime& rt,
+    react::TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  return static_cast<BlobTurboModule&>(turboModule)
+      .createFromArrayBuffer(rt, args, count);
+}
+
+static jsi::Value __hostFunction_BlobTurboModule_getArrayBuffer(
+    jsi::Runtime& rt,
+    react::TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  return static_cast<BlobTurboModule&>(turboModule)
+      .getArrayBuffer(rt, args, count);
+}
+
 BlobTurboModule::BlobTurboModule(
     const ArkTSTurboModule::Context ctx,
     const std::string name)
@@ -15,7 +36,10 @@ BlobTurboModule::BlobTurboModule(
       ARK_METHOD_METADATA(addWebSocketHandler, 1),
       ARK_METHOD_METADATA(addNetworkingHandler, 0),
       ARK_METHOD_METADATA(removeWebSocketHandler, 1),
-      ARK_METHOD_METADATA(createFromParts, 2)};
+      ARK_METHOD_METADATA(createFromParts, 2),
+      {"createFromArrayBuffer",
+       {2, __hostFunction_BlobTurboModule_createFromArrayBuffer}},
+      {"getArrayBuffer", {1, __hostFunction_BlobTurboModule_getArrayBuffer}}};
 }
 
 /**
@@ -23,22 +47,97 @@ BlobTurboModule::BlobTurboModule(
  * cumbersome.
  */
 void BlobTurboModule::release(std::string blobId) {
-  m_ctx.taskExecutor->runTask(
-      TaskThread::MAIN, [ctx = m_ctx, name = name_, blobId]() {
-        std::string methodName = "release";
-        try {
-          ArkJS arkJs(ctx.env);
-          std::vector<napi_value> napiArgs;
-          napiArgs.push_back(arkJs.createString(blobId));
-          auto napiTurboModuleObject =
-              arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
-          napiTurboModuleObject.call(methodName, napiArgs);
-        } catch (const std::exception& e) {
-          LOG(ERROR) << "Exception thrown while calling " << name
-                     << " TurboModule method " << methodName << ": "
-                     << e.what();
-        }
+  // in order with createFromArrayBuffer and getArrayBuffer calls
+  runOnMainThread([ctx = m_ctx, name = name_, blobId]() {
+    std::string methodName = "release";
+    try {
+      ArkJS arkJs(ctx.env);
+      std::vector<napi_value> napiArgs;
+      napiArgs.push_back(arkJs.createString(blobId));
+      auto napiTurboModuleObject =
+          arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
+      napiTurboModuleObject.call(methodName, napiArgs);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception thrown while calling " << name
+                 << " TurboModule method " << methodName << ": " << e.what();
+    }
+  });
+}
+
+// copies the bytes on the JS thread, the ArkTS side gets an ArrayBuffer
+// sharing the copy
+jsi::Value BlobTurboModule::createFromArrayBuffer(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  if (count < 2 || !args[0].isObject() ||
+      !args[0].getObject(rt).isArrayBuffer(rt)) {
+    throw jsi::JSError(
+        rt,
+        "BlobModule::createFromArrayBuffer expects an ArrayBuffer and an id");
+  }
+  auto arrayBuffer = args[0].getObject(rt).getArrayBuffer(rt);
+  auto bytes = SharedByteBuffer::copyFrom(
+      folly::ByteRange(arrayBuffer.data(rt), arrayBuffer.size(rt)));
+  auto blobId = args[1].asString(rt).utf8(rt);
+  runOnMainThread([ctx = m_ctx, bytes = std::move(bytes), blobId]() {
+    try {
+      ArkJS arkJs(ctx.env);
+      arkJs.getObject(ctx.arkTsTurboModuleInstanceRef)
+          .call(
+              "createFromArrayBuffer",
+              {arkJs.createArrayBuffer(bytes), arkJs.createString(blobId)});
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception thrown while creating blob " << blobId << ": "
+                 << e.what();
+    }
+  });
+  return jsi::Value::undefined();
+}
+
+// copies the bytes on the MAIN thread, JS gets an ArrayBuffer sharing the
+// copy
+jsi::Value BlobTurboModule::getArrayBuffer(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  if (count < 1) {
+    throw jsi::JSError(rt, "BlobModule::getArrayBuffer expects 1 argument");
+  }
+  auto blobMetadata = jsi::dynamicFromValue(rt, args[0]);
+  return react::createPromiseAsJSIValue(
+      rt,
+      [ctx = m_ctx, blobMetadata = std::move(blobMetadata)](
+          jsi::Runtime& rt2, std::shared_ptr<react::Promise> jsiPromise) {
+        runOnMainThread(ctx, [ctx, blobMetadata, &rt2, jsiPromise]() {
+          try {
+            ArkJS arkJs(ctx.env);
+            auto napiBytes =
+                arkJs.getObject(ctx.arkTsTurboModuleInstanceRef)
+                    .call(
+                        "findByMetaData",
+                        {arkJs.createFromDynamic(blobMetadata)});
+            if (!arkJs.isArrayBuffer(napiBytes)) {
+              throw std::runtime_error(
+                  "Couldn't find blob " +
+                  blobMetadata.getDefault("blobId", "").asString());
+            }
+            auto bytes = SharedByteBuffer::copyFrom(
+                arkJs.getArrayBufferRange(napiBytes));
+            ctx.jsInvoker->invokeAsync(
+                [&rt2, jsiPromise, bytes = std::move(bytes)]() {
+                  jsiPromise->resolve(jsi::ArrayBuffer(rt2, bytes));
+                  jsiPromise->allowRelease();
+                });
+          } catch (const std::exception& e) {
+            ctx.jsInvoker->invokeAsync(
+                [message = std::string(e.what()), jsiPromise] {
+                  jsiPromise->reject(message);
+                  jsiPromise->allowRelease();
+                });
+          }
+        });
       });
 }
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
@@ -5,10 +5,32 @@
 
 namespace rnoh {
 
+/**
+ * Besides the methods of React Native's BlobModule, provides a binary path
+ * for blob data which doesn't go through base64 or folly::dynamic:
+ *
+ * - `createFromArrayBuffer(buffer: ArrayBuffer, blobId: string): void` stores
+ *   a copy of the buffer as a blob,
+ * - `getArrayBuffer(blob: BlobMetadata): Promise<ArrayBuffer>` reads the
+ *   blob's bytes.
+ *
+ * The bytes are copied once, into a SharedByteBuffer which backs the
+ * ArrayBuffer created on the other side.
+ */
 class JSI_EXPORT BlobTurboModule : public ArkTSTurboModule {
  public:
   BlobTurboModule(const ArkTSTurboModule::Context ctx, const std::string name);
   void release(const std::string blobId);
+
+  facebook::jsi::Value createFromArrayBuffer(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
+
+  facebook::jsi::Value getArrayBuffer(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
 };
 
 } // namespace rnoh
\ No newline at end of file
@@ -1,15 +1,79 @@
 #include "RNOHCorePackage/TurboModules/FileReaderTurboModule.h"
+#include <ReactCommon/TurboModuleUtils.h>
+#include <jsi/JSIDynamic.h>
+#include "RNOH/Base64.h"
 
 namespace rnoh {
 using namespace facebook;
 
+static jsi::Value __hostFunction_FileReaderTurboModule_readAsDataURL(
+    jsi::Runtime& rt,
+    react::TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  return static_cast<FileReaderTurboModule&>(turboModule)
+      .readAsDataURL(rt, args, count);
+}
+
 FileReaderTurboModule::FileReaderTurboModule(
     const ArkTSTurboModule::Context ctx,
     const std::string name)
     : ArkTSTurboModule(ctx, name) {
   methodMap_ = {
-      ARK_ASYNC_METHOD_METADATA(readAsDataURL, 1),
+      {"readAsDataURL",
+       {1, __hostFunction_FileReaderTurboModule_readAsDataURL}},
       ARK_ASYNC_METHOD_METADATA(readAsText, 2)};
 }
 
-} // namespace rnoh
\ No newline at end of file
+// reads the blob's bytes straight from the ArkTS ArrayBuffer and encodes them
+// natively, instead of passing a base64 string through folly::dynamic
+jsi::Value FileReaderTurboModule::readAsDataURL(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  if (count < 1) {
+    throw jsi::JSError(rt, "FileReader::readAsDataURL expects 1 argument");
+  }
+  auto blobMetadata = jsi::dynamicFromValue(rt, args[0]);
+  std::string dataUrlPrefix = "data:";
+  auto type = blobMetadata.getDefault("type");
+  if (type.isString() && !type.getString().empty()) {
+    dataUrlPrefix += type.getString();
+  } else {
+    dataUrlPrefix += "application/octet-stream";
+  }
+  dataUrlPrefix += ";base64,";
+  return react::createPromiseAsJSIValue(
+      rt,
+      [ctx = m_ctx,
+       blobMetadata = std::move(blobMetadata),
+       dataUrlPrefix = std::move(dataUrlPrefix)](
+          jsi::Runtime& rt2, std::shared_ptr<react::Promise> jsiPromise) {
+        runOnMainThread(
+            ctx, [ctx, blobMetadata, dataUrlPrefix, &rt2, jsiPromise]() {
+            try {
+              ArkJS arkJs(ctx.env);
+              auto napiTurboModuleObject =
+                  arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
+              auto napiBytes = napiTurboModuleObject.call(
+                  "readAsArrayBuffer", {arkJs.createFromDynamic(blobMetadata)});
+              auto dataUrl = dataUrlPrefix;
+              encodeBase64(arkJs.getArrayBufferRange(napiBytes), dataUrl);
+              ctx.jsInvoker->invokeAsync(
+                  [&rt2, jsiPromise, dataUrl = std::move(dataUrl)]() {
+                    jsiPromise->resolve(
+                        jsi::String::createFromUtf8(rt2, dataUrl));
+                    jsiPromise->allowRelease();
+                  });
+            } catch (const std::exception& e) {
+              ctx.jsInvoker->invokeAsync(
+                  [message = std::string(e.what()), jsiPromise] {
+                    jsiPromise->reject(message);
+                    jsiPromise->allowRelease();
+                  });
+            }
+            });
+      });
+}
+
+} // namespace rnoh
@@ -10,6 +10,11 @@ class JSI_EXPORT FileReaderTurboModule : public ArkTSTurboModule {
   FileReaderTurboModule(
       const ArkTSTurboModule::Context ctx,
       const std::string name);
+
+  facebook::jsi::Value readAsDataURL(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
 };
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
@@ -1,9 +1,29 @@
 #include "ImageLoaderTurboModule.h"
+#include <ReactCommon/TurboModuleUtils.h>
 #include "RNOH/ArkTSTurboModule.h"
+#include "RNOH/ImageLoader/ImageLoader.h"
 
 using namespace rnoh;
 using namespace facebook;
 
+static jsi::Value __hostFunction_ImageLoaderTurboModule_prefetchImage(
+    jsi::Runtime& rt,
+    react::TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  return static_cast<ImageLoaderTurboModule&>(turboModule)
+      .prefetchImage(rt, args, count);
+}
+
+static jsi::Value __hostFunction_ImageLoaderTurboModule_queryCache(
+    jsi::Runtime& rt,
+    react::TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  return static_cast<ImageLoaderTurboModule&>(turboModule)
+      .queryCache(rt, args, count);
+}
+
 rnoh::ImageLoaderTurboModule::ImageLoaderTurboModule(
     const ArkTSTurboModule::Context ctx,
     const std::string name)
@@ -12,7 +32,72 @@ rnoh::ImageLoaderTurboModule::ImageLoaderTurboModule(
       ARK_METHOD_METADATA(getConstants, 0),
       ARK_ASYNC_METHOD_METADATA(getSize, 1),
       ARK_ASYNC_METHOD_METADATA(getSizeWithHeaders, 2),
-      ARK_ASYNC_METHOD_METADATA(prefetchImage, 1),
+      {"prefetchImage",
+       {1, __hostFunction_ImageLoaderTurboModule_prefetchImage}},
       ARK_ASYNC_METHOD_METADATA(prefetchImageWithMetadata, 3),
-      ARK_ASYNC_METHOD_METADATA(queryCache, 1)};
+      {"queryCache", {1, __hostFunction_ImageLoaderTurboModule_queryCache}}};
+}
+
+jsi::Value rnoh::ImageLoaderTurboModule::prefetchImage(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  auto imageLoader = ImageLoader::getInstance();
+  if (imageLoader == nullptr || count < 1 || !args[0].isString()) {
+    return callAsync(rt, "prefetchImage", args, count);
+  }
+  auto uri = args[0].getString(rt).utf8(rt);
+  if (!imageLoader->canLoad(uri)) {
+    return callAsync(rt, "prefetchImage", args, count);
+  }
+  return react::createPromiseAsJSIValue(
+      rt,
+      [imageLoader, uri, jsInvoker = m_ctx.jsInvoker](
+          jsi::Runtime& /*rt2*/, std::shared_ptr<react::Promise> jsiPromise) {
+        imageLoader->prefetchImage(
+            uri,
+            [jsInvoker, jsiPromise](auto const& /*image*/) {
+              jsInvoker->invokeAsync([jsiPromise] {
+                jsiPromise->resolve(jsi::Value(true));
+                jsiPromise->allowRelease();
+              });
+            },
+            [jsInvoker, jsiPromise](auto const& errorMessage) {
+              jsInvoker->invokeAsync([jsiPromise, errorMessage] {
+                jsiPromise->reject(errorMessage);
+                jsiPromise->allowRelease();
+              });
+            });
+      });
+}
+
+jsi::Value rnoh::ImageLoaderTurboModule::queryCache(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  auto imageLoader = ImageLoader::getInstance();
+  if (imageLoader == nullptr || count < 1 || !args[0].isObject()) {
+    return callAsync(rt, "queryCache", args, count);
+  }
+  auto jsiUris = args[0].getObject(rt).asArray(rt);
+  std::vector<std::string> uris;
+  for (size_t i = 0; i < jsiUris.size(rt); i++) {
+    uris.push_back(jsiUris.getValueAtIndex(rt, i).asString(rt).utf8(rt));
+  }
+  return react::createPromiseAsJSIValue(
+      rt,
+      [imageLoader, uris = std::move(uris)](
+          jsi::Runtime& rt2, std::shared_ptr<react::Promise> jsiPromise) {
+        auto result = jsi::Object(rt2);
+        for (auto const& uri : uris) {
+          auto cacheLocation = imageLoader->queryCache(uri);
+          if (cacheLocation == ImageLoader::CacheLocation::MEMORY) {
+            result.setProperty(rt2, uri.c_str(), "memory");
+          } else if (cacheLocation == ImageLoader::CacheLocation::DISK) {
+            result.setProperty(rt2, uri.c_str(), "disk");
+          }
+        }
+        jsiPromise->resolve(std::move(result));
+        jsiPromise->allowRelease();
+      });
 }
@@ -4,11 +4,26 @@
 
 namespace rnoh {
 
+/**
+ * `prefetchImage` and `queryCache` use the native ImageLoader if it's
+ * initialized, so that prefetched images are used by the Image component.
+ * Otherwise, they are handled in ArkTS.
+ */
 class JSI_EXPORT ImageLoaderTurboModule : public ArkTSTurboModule {
  public:
   ImageLoaderTurboModule(
       const ArkTSTurboModule::Context ctx,
       const std::string name);
+
+  facebook::jsi::Value prefetchImage(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
+
+  facebook::jsi::Value queryCache(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
 };
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
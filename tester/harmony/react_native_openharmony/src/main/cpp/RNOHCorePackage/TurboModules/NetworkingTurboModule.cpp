@@ -1,16 +1,158 @@
 #include "NetworkingTurboModule.h"
+#include <jsi/JSIDynamic.h>
+#include <algorithm>
+#include <array>
+#include "RNOH/Base64.h"
 
 namespace rnoh {
 
 using namespace facebook;
 
+// Content-Length is only a hint, a bogus one mustn't make the MAIN thread
+// allocate more than this upfront
+static constexpr size_t MAX_RESERVED_BODY_SIZE = 64 * 1024 * 1024;
+
+void NetworkingResponseSink::appendData(
+    int requestId,
+    folly::ByteRange chunk,
+    size_t expectedLength) {
+  auto& body = m_bodyByRequestId[requestId];
+  if (body.empty() && expectedLength > 0) {
+    body.reserve(std::min(expectedLength, MAX_RESERVED_BODY_SIZE));
+  }
+  body.append(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+}
+
+void NetworkingResponseSink::completeResponse(
+    int requestId,
+    int statusCode,
+    folly::dynamic headers,
+    std::string url,
+    bool shouldEncodeAsBase64) {
+  auto body = std::make_shared<std::string>();
+  auto it = m_bodyByRequestId.find(requestId);
+  if (it != m_bodyByRequestId.end()) {
+    body->swap(it->second);
+    m_bodyByRequestId.erase(it);
+  }
+  emitResponse(
+      {requestId,
+       statusCode,
+       std::move(headers),
+       std::move(url),
+       std::move(body),
+       shouldEncodeAsBase64});
+}
+
+void NetworkingResponseSink::dropResponse(int requestId) {
+  m_bodyByRequestId.erase(requestId);
+}
+
+void NetworkingResponseSink::emitResponse(Response response) {
+  runOnJSThread([response = std::move(response)](jsi::Runtime& rt) {
+    auto responsePayload = jsi::Array(rt, 4);
+    responsePayload.setValueAtIndex(rt, 0, response.requestId);
+    responsePayload.setValueAtIndex(rt, 1, response.statusCode);
+    responsePayload.setValueAtIndex(
+        rt, 2, jsi::valueFromDynamic(rt, response.headers));
+    responsePayload.setValueAtIndex(
+        rt, 3, jsi::String::createFromUtf8(rt, response.url));
+    emitDeviceEvent(
+        rt, "didReceiveNetworkResponse", std::move(responsePayload));
+
+    auto& body = *response.body;
+    auto dataPayload = jsi::Array(rt, 2);
+    dataPayload.setValueAtIndex(rt, 0, response.requestId);
+    if (response.shouldEncodeAsBase64) {
+      auto base64 = encodeBase64(folly::ByteRange(folly::StringPiece(body)));
+      dataPayload.setValueAtIndex(
+          rt, 1, jsi::String::createFromAscii(rt, base64));
+    } else {
+      dataPayload.setValueAtIndex(
+          rt,
+          1,
+          jsi::String::createFromUtf8(
+              rt, reinterpret_cast<const uint8_t*>(body.data()), body.size()));
+    }
+    emitDeviceEvent(rt, "didReceiveNetworkData", std::move(dataPayload));
+
+    auto completionPayload = jsi::Array(rt, 2);
+    completionPayload.setValueAtIndex(rt, 0, response.requestId);
+    completionPayload.setValueAtIndex(
+        rt, 1, jsi::String::createFromAscii(rt, ""));
+    emitDeviceEvent(
+        rt, "didCompleteNetworkResponse", std::move(completionPayload));
+  });
+}
+
+static napi_value onData(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  std::array<napi_value, 3> args{};
+  auto sink = NetworkingResponseSink::getSink(env, info, args);
+  if (!sink) {
+    return arkJs.getUndefined();
+  }
+  void* bytes = nullptr;
+  size_t length = 0;
+  auto status = napi_get_arraybuffer_info(env, args[1], &bytes, &length);
+  if (status != napi_ok) {
+    LOG(ERROR) << "Networking: response chunk is not an ArrayBuffer";
+    return arkJs.getUndefined();
+  }
+  // the only copy of the chunk, needed to move it off the ArkTS heap
+  sink->appendData(
+      arkJs.getInteger(args[0]),
+      folly::ByteRange(static_cast<const uint8_t*>(bytes), length),
+      static_cast<size_t>(std::max(arkJs.getDouble(args[2]), 0.0)));
+  return arkJs.getUndefined();
+}
+
+static napi_value onEnd(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  std::array<napi_value, 5> args{};
+  auto sink = NetworkingResponseSink::getSink(env, info, args);
+  if (!sink) {
+    return arkJs.getUndefined();
+  }
+  sink->completeResponse(
+      arkJs.getInteger(args[0]),
+      arkJs.getInteger(args[1]),
+      arkJs.getDynamic(args[2]),
+      arkJs.getString(args[3]),
+      arkJs.getString(args[4]) == "base64");
+  return arkJs.getUndefined();
+}
+
+static napi_value onDrop(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  std::array<napi_value, 1> args{};
+  auto sink = NetworkingResponseSink::getSink(env, info, args);
+  if (sink) {
+    sink->dropResponse(arkJs.getInteger(args[0]));
+  }
+  return arkJs.getUndefined();
+}
+
+napi_value NetworkingResponseSink::createHandler(ArkJS& arkJs, void* data) {
+  return arkJs.createObjectBuilder()
+      .addProperty("onData", arkJs.createFunction("onData", onData, data))
+      .addProperty("onEnd", arkJs.createFunction("onEnd", onEnd, data))
+      .addProperty("onDrop", arkJs.createFunction("onDrop", onDrop, data))
+      .build();
+}
+
+void NetworkingResponseSink::releaseHandler(ArkJS& arkJs) {
+  JSEventSink::releaseHandler(arkJs);
+  m_bodyByRequestId.clear();
+}
+
 static jsi::Value __hostFunction_NetworkingTurboModule_sendRequest(
     jsi::Runtime& rt,
     react::TurboModule& turboModule,
     const jsi::Value* args,
     size_t count) {
-  return static_cast<ArkTSTurboModule&>(turboModule)
-      .call(rt, "sendRequest", args, count);
+  return static_cast<NetworkingTurboModule&>(turboModule)
+      .sendRequest(rt, args, count);
 }
 
 static jsi::Value __hostFunction_NetworkingTurboModule_abortRequest(
@@ -18,8 +160,9 @@ static jsi::Value __hostFunction_NetworkingTurboModule_abortRequest(
     react::TurboModule& turboModule,
     const jsi::Value* args,
     size_t count) {
-  return static_cast<ArkTSTurboModule&>(turboModule)
-      .call(rt, "abortRequest", args, count);
+  static_cast<ArkTSTurboModule&>(turboModule)
+      .scheduleCall(rt, "abortRequest", args, count);
+  return jsi::Value::undefined();
 }
 
 NetworkingTurboModule::NetworkingTurboModule(
@@ -31,4 +174,51 @@ NetworkingTurboModule::NetworkingTurboModule(
       {"abortRequest", {1, __hostFunction_NetworkingTurboModule_abortRequest}}};
 }
 
+NetworkingTurboModule::~NetworkingTurboModule() {
+  if (m_responseSink == nullptr) {
+    return;
+  }
+  m_ctx.taskExecutor->runTask(
+      TaskThread::MAIN, [env = m_ctx.env, sink = m_responseSink]() {
+        ArkJS arkJs(env);
+        sink->releaseHandler(arkJs);
+      });
+}
+
+// returns immediately with the request id, the request itself is sent from
+// the MAIN thread
+jsi::Value NetworkingTurboModule::sendRequest(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  if (count < 2) {
+    throw jsi::JSError(rt, "Networking::sendRequest expects 2 arguments");
+  }
+  if (m_responseSink == nullptr) {
+    m_responseSink =
+        std::make_shared<NetworkingResponseSink>(m_ctx.jsInvoker, rt);
+  }
+  auto requestId = m_nextRequestId++;
+  auto query = jsi::dynamicFromValue(rt, args[0]);
+  runOnMainThread([ctx = m_ctx,
+                   sink = m_responseSink,
+                   query = std::move(query),
+                   requestId]() {
+    try {
+      ArkJS arkJs(ctx.env);
+      auto napiTurboModuleObject =
+          arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
+      napiTurboModuleObject.call(
+          "sendRequest",
+          {arkJs.createFromDynamic(query),
+           arkJs.createInt(requestId),
+           sink->getHandler(arkJs)});
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception thrown while sending a request: " << e.what();
+    }
+  });
+  args[1].asObject(rt).asFunction(rt).call(rt, requestId);
+  return jsi::Value::undefined();
+}
+
 } // namespace rnoh
@@ -1,14 +1,91 @@
 #pragma once
 
+#include <atomic>
+#include <unordered_map>
 #include "RNOH/ArkTSTurboModule.h"
+#include "RNOH/JSEventSink.h"
 
 namespace rnoh {
 
+/**
+ * Delivers responses received on the ArkTS side straight to JS, without
+ * converting their bodies to folly::dynamic or napi strings on the way.
+ * The ArkTS side passes each chunk of the body as an ArrayBuffer as soon as
+ * it arrives, and the chunks are collected here, off the ArkTS heap.
+ * The response, its body and its completion are emitted from a single JS
+ * thread task, so XMLHttpRequest sees them in order.
+ */
+class NetworkingResponseSink : public JSEventSink<NetworkingResponseSink> {
+ public:
+  using Shared = std::shared_ptr<NetworkingResponseSink>;
+
+  struct Response {
+    int requestId;
+    int statusCode;
+    folly::dynamic headers;
+    std::string url;
+    std::shared_ptr<std::string const> body;
+    bool shouldEncodeAsBase64;
+  };
+
+  using JSEventSink::JSEventSink;
+
+  /**
+   * Appends a chunk to the body of the request. `expectedLength` is the
+   * Content-Length of the response, or 0 if unknown. MAIN thread only.
+   */
+  void appendData(
+      int requestId,
+      folly::ByteRange chunk,
+      size_t expectedLength);
+
+  /**
+   * Emits the response with the collected body. MAIN thread only.
+   */
+  void completeResponse(
+      int requestId,
+      int statusCode,
+      folly::dynamic headers,
+      std::string url,
+      bool shouldEncodeAsBase64);
+
+  /**
+   * Drops the collected body of a failed or aborted request. MAIN thread only.
+   */
+  void dropResponse(int requestId);
+
+  /**
+   * Creates the handler passed to the ArkTS side, an object with the
+   * functions `onData(requestId, chunk: ArrayBuffer, expectedLength)`,
+   * `onEnd(requestId, statusCode, headers, url, responseType)` and
+   * `onDrop(requestId)`.
+   */
+  static napi_value createHandler(ArkJS& arkJs, void* data);
+
+  void releaseHandler(ArkJS& arkJs) override;
+
+ private:
+  void emitResponse(Response response);
+
+  std::unordered_map<int, std::string> m_bodyByRequestId;
+};
+
 class JSI_EXPORT NetworkingTurboModule : public ArkTSTurboModule {
  public:
   NetworkingTurboModule(
       const ArkTSTurboModule::Context ctx,
       const std::string name);
+
+  ~NetworkingTurboModule() override;
+
+  facebook::jsi::Value sendRequest(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
+
+ private:
+  std::atomic<int> m_nextRequestId{0};
+  NetworkingResponseSink::Shared m_responseSink;
 };
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
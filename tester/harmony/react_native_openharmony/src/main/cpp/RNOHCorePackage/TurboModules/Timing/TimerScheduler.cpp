@@ -0,0 +1,183 @@
+#include "TimerScheduler.h"
+#include <glog/logging.h>
+
+namespace rnoh {
+
+using namespace facebook;
+
+// RN's JSTimers doesn't provide the remaining frame time to idle callbacks,
+// so they are called once per frame while there are no expired timers
+static constexpr TimerWheel::Milliseconds IDLE_CALLBACKS_INTERVAL_MS = 16;
+
+static void callJSTimers(
+    jsi::Runtime& rt,
+    const char* methodName,
+    jsi::Value const& arg) {
+  auto batchedBridge = rt.global().getProperty(rt, "__fbBatchedBridge");
+  if (!batchedBridge.isObject()) {
+    return;
+  }
+  auto batchedBridgeObject = batchedBridge.asObject(rt);
+  auto jsTimers =
+      batchedBridgeObject.getPropertyAsFunction(rt, "getCallableModule")
+          .callWithThis(
+              rt,
+              batchedBridgeObject,
+              jsi::String::createFromAscii(rt, "JSTimers"));
+  if (!jsTimers.isObject()) {
+    LOG(ERROR) << "TimerScheduler: JSTimers module is not registered";
+    return;
+  }
+  auto jsTimersObject = jsTimers.asObject(rt);
+  jsTimersObject.getPropertyAsFunction(rt, methodName)
+      .callWithThis(rt, jsTimersObject, arg);
+}
+
+TimerScheduler::TimerScheduler(TaskExecutor::Weak taskExecutor)
+    : m_taskExecutor(std::move(taskExecutor)),
+      m_startTime(Clock::now()),
+      m_timerWheel(0) {
+  m_thread = std::thread([this] { runLoop(); });
+  pthread_setname_np(m_thread.native_handle(), "RNOH_TIMERS");
+}
+
+TimerScheduler::~TimerScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isRunning = false;
+  }
+  m_cv.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void TimerScheduler::createTimer(
+    jsi::Runtime& rt,
+    TimerWheel::TimerId id,
+    double duration,
+    double jsSchedulingTime,
+    bool repeats) {
+  m_runtime = &rt;
+  // bring the wheel up to date, so the delay is measured from now
+  m_timerWheel.advance(now());
+  auto delay = static_cast<TimerWheel::Milliseconds>(duration);
+  if (!repeats) {
+    auto wallClockNow =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    auto elapsedSinceScheduling =
+        wallClockNow - static_cast<TimerWheel::Milliseconds>(jsSchedulingTime);
+    delay -= std::max<TimerWheel::Milliseconds>(0, elapsedSinceScheduling);
+  }
+  m_timerWheel.schedule(id, delay, repeats);
+  scheduleWakeUp();
+}
+
+void TimerScheduler::deleteTimer(TimerWheel::TimerId id) {
+  m_timerWheel.cancel(id);
+}
+
+void TimerScheduler::setSendIdleEvents(jsi::Runtime& rt, bool enabled) {
+  m_runtime = &rt;
+  m_shouldSendIdleEvents = enabled;
+  scheduleWakeUp();
+}
+
+void TimerScheduler::setPaused(bool isPaused) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isPaused && !isPaused) {
+      // calls timers which expired while paused
+      m_wakeUpTime = Clock::now();
+    }
+    m_isPaused = isPaused;
+  }
+  m_cv.notify_all();
+}
+
+TimerWheel::Milliseconds TimerScheduler::now() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             Clock::now() - m_startTime)
+      .count();
+}
+
+void TimerScheduler::tick() {
+  if (m_runtime == nullptr) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isPaused) {
+      // the tick was posted before pausing, expired timers wait in the wheel
+      // until the app is resumed
+      return;
+    }
+  }
+  auto& rt = *m_runtime;
+  auto expiredTimerIds = m_timerWheel.advance(now());
+  if (!expiredTimerIds.empty()) {
+    auto ids = jsi::Array(rt, expiredTimerIds.size());
+    for (size_t i = 0; i < expiredTimerIds.size(); i++) {
+      ids.setValueAtIndex(rt, i, static_cast<double>(expiredTimerIds[i]));
+    }
+    callJSTimers(rt, "callTimers", std::move(ids));
+  } else if (m_shouldSendIdleEvents) {
+    auto frameTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    callJSTimers(rt, "callIdleCallbacks", static_cast<double>(frameTime));
+  }
+  scheduleWakeUp();
+}
+
+void TimerScheduler::scheduleWakeUp() {
+  auto wakeUpTime = m_timerWheel.getNextWakeUpTime();
+  if (m_shouldSendIdleEvents) {
+    auto idleWakeUpTime = now() + IDLE_CALLBACKS_INTERVAL_MS;
+    wakeUpTime = std::min(wakeUpTime.value_or(idleWakeUpTime), idleWakeUpTime);
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (wakeUpTime.has_value()) {
+      m_wakeUpTime = m_startTime + std::chrono::milliseconds(*wakeUpTime);
+    } else {
+      m_wakeUpTime = std::nullopt;
+    }
+  }
+  m_cv.notify_all();
+}
+
+void TimerScheduler::runLoop() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (m_isRunning) {
+    if (!m_wakeUpTime.has_value() || m_isPaused) {
+      m_cv.wait(lock);
+      continue;
+    }
+    auto wakeUpTime = m_wakeUpTime.value();
+    if (m_cv.wait_until(lock, wakeUpTime) != std::cv_status::timeout) {
+      // woken up by a new wake up time, by pausing or by the destructor
+      continue;
+    }
+    if (m_isPaused || m_wakeUpTime != wakeUpTime) {
+      continue;
+    }
+    // the JS thread schedules the next wake up after handling the tick
+    m_wakeUpTime = std::nullopt;
+    auto taskExecutor = m_taskExecutor.lock();
+    if (taskExecutor == nullptr) {
+      continue;
+    }
+    lock.unlock();
+    taskExecutor->runTask(TaskThread::JS, [weakSelf = weak_from_this()] {
+      if (auto self = weakSelf.lock()) {
+        self->tick();
+      }
+    });
+    lock.lock();
+  }
+}
+
+} // namespace rnoh
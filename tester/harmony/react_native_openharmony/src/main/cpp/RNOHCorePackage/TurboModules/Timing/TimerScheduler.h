@@ -0,0 +1,73 @@
+#pragma once
+
+#include <jsi/jsi.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "RNOH/TaskExecutor/TaskExecutor.h"
+#include "TimerWheel.h"
+
+namespace rnoh {
+
+/**
+ * Runs JS timers natively. Timers are kept in a TimerWheel owned by the JS
+ * thread. A helper thread sleeps until the next timer expires and posts a
+ * single tick to the JS thread, which calls `JSTimers.callTimers` with all
+ * timers expired at that point. While the app is paused, no timers are
+ * called; timers that expired meanwhile are called once it's resumed.
+ */
+class TimerScheduler : public std::enable_shared_from_this<TimerScheduler> {
+ public:
+  using Shared = std::shared_ptr<TimerScheduler>;
+
+  TimerScheduler(TaskExecutor::Weak taskExecutor);
+  ~TimerScheduler();
+
+  TimerScheduler(TimerScheduler const&) = delete;
+  TimerScheduler& operator=(TimerScheduler const&) = delete;
+
+  // JS thread only
+  void createTimer(
+      facebook::jsi::Runtime& rt,
+      TimerWheel::TimerId id,
+      double duration,
+      double jsSchedulingTime,
+      bool repeats);
+
+  // JS thread only
+  void deleteTimer(TimerWheel::TimerId id);
+
+  // JS thread only
+  void setSendIdleEvents(facebook::jsi::Runtime& rt, bool enabled);
+
+  void setPaused(bool isPaused);
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  TimerWheel::Milliseconds now() const;
+  void tick();
+  void scheduleWakeUp();
+  void runLoop();
+
+  TaskExecutor::Weak m_taskExecutor;
+  Clock::time_point m_startTime;
+
+  // accessed on the JS thread
+  TimerWheel m_timerWheel;
+  facebook::jsi::Runtime* m_runtime = nullptr;
+  bool m_shouldSendIdleEvents = false;
+
+  // shared with the helper thread
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::optional<Clock::time_point> m_wakeUpTime;
+  bool m_isRunning = true;
+  bool m_isPaused = false;
+  std::thread m_thread;
+};
+
+} // namespace rnoh
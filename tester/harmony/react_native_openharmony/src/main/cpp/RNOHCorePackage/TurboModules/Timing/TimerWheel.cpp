@@ -0,0 +1,166 @@
+#include "TimerWheel.h"
+#include <algorithm>
+
+namespace rnoh {
+
+TimerWheel::TimerWheel(Milliseconds currentTime)
+    : m_currentTime(currentTime) {}
+
+void TimerWheel::schedule(TimerId id, Milliseconds delay, bool repeats) {
+  delay = std::clamp<Milliseconds>(delay, 1, MAX_DELAY);
+  Timer timer{
+      .expirationTime = m_currentTime + delay,
+      .interval = delay,
+      .repeats = repeats,
+      .generation = m_nextGeneration++};
+  m_timerById.insert_or_assign(id, timer);
+  insert(id, timer);
+}
+
+void TimerWheel::cancel(TimerId id) {
+  // entries left in the wheel are discarded lazily
+  m_timerById.erase(id);
+}
+
+std::vector<TimerWheel::TimerId> TimerWheel::advance(
+    Milliseconds currentTime) {
+  std::vector<ExpiredTimer> expiredTimers;
+  while (m_currentTime < currentTime) {
+    if (m_timerById.empty()) {
+      m_currentTime = currentTime;
+      break;
+    }
+    if (m_entriesCountByLevel[0] == 0) {
+      // nothing can expire before the end of the current block, skip to it
+      auto lastTimeInBlock =
+          m_currentTime | static_cast<Milliseconds>(SLOTS_PER_LEVEL - 1);
+      if (lastTimeInBlock >= currentTime) {
+        m_currentTime = currentTime;
+        break;
+      }
+      m_currentTime = lastTimeInBlock;
+    }
+    m_currentTime++;
+    if (getSlotIndex(m_currentTime, 0) == 0) {
+      size_t topLevel = 1;
+      while (topLevel + 1 < LEVELS_COUNT &&
+             getSlotIndex(m_currentTime, topLevel) == 0) {
+        topLevel++;
+      }
+      for (size_t level = topLevel; level >= 1; level--) {
+        cascade(level);
+      }
+    }
+    expireCurrentSlot(expiredTimers, currentTime);
+  }
+
+  std::sort(
+      expiredTimers.begin(),
+      expiredTimers.end(),
+      [](auto const& lhs, auto const& rhs) {
+        if (lhs.expirationTime != rhs.expirationTime) {
+          return lhs.expirationTime < rhs.expirationTime;
+        }
+        return lhs.generation < rhs.generation;
+      });
+  std::vector<TimerId> result;
+  result.reserve(expiredTimers.size());
+  for (auto const& expiredTimer : expiredTimers) {
+    result.push_back(expiredTimer.id);
+  }
+  return result;
+}
+
+std::optional<TimerWheel::Milliseconds> TimerWheel::getNextWakeUpTime() const {
+  if (m_timerById.empty()) {
+    return std::nullopt;
+  }
+  for (size_t level = 0; level < LEVELS_COUNT; level++) {
+    if (m_entriesCountByLevel[level] == 0) {
+      continue;
+    }
+    auto const& slots = m_levels[level];
+    auto levelShift = BITS_PER_LEVEL * level;
+    auto blockShift = BITS_PER_LEVEL * (level + 1);
+    for (size_t index = getSlotIndex(m_currentTime, level) + 1;
+         index < SLOTS_PER_LEVEL;
+         index++) {
+      auto const& slot = slots[index];
+      if (std::any_of(slot.begin(), slot.end(), [this](auto const& entry) {
+            return isValid(entry);
+          })) {
+        // on level 0 this is the exact expiration time, on higher levels it's
+        // the time at which the slot is cascaded
+        return ((m_currentTime >> blockShift) << blockShift) |
+            (Milliseconds(index) << levelShift);
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+void TimerWheel::insert(TimerId id, Timer const& timer) {
+  auto expirationTime = std::max(timer.expirationTime, m_currentTime);
+  size_t level = 0;
+  while (level + 1 < LEVELS_COUNT &&
+         (expirationTime >> (BITS_PER_LEVEL * (level + 1))) !=
+             (m_currentTime >> (BITS_PER_LEVEL * (level + 1)))) {
+    level++;
+  }
+  m_levels[level][getSlotIndex(expirationTime, level)].push_back(
+      {.id = id, .generation = timer.generation});
+  m_entriesCountByLevel[level]++;
+}
+
+void TimerWheel::cascade(size_t level) {
+  auto& slot = m_levels[level][getSlotIndex(m_currentTime, level)];
+  Slot entries;
+  std::swap(entries, slot);
+  m_entriesCountByLevel[level] -= entries.size();
+  for (auto const& entry : entries) {
+    if (isValid(entry)) {
+      insert(entry.id, m_timerById.at(entry.id));
+    }
+  }
+}
+
+void TimerWheel::expireCurrentSlot(
+    std::vector<ExpiredTimer>& expiredTimers,
+    Milliseconds targetTime) {
+  auto& slot = m_levels[0][getSlotIndex(m_currentTime, 0)];
+  Slot entries;
+  std::swap(entries, slot);
+  m_entriesCountByLevel[0] -= entries.size();
+  for (auto const& entry : entries) {
+    if (!isValid(entry)) {
+      continue;
+    }
+    auto it = m_timerById.find(entry.id);
+    auto& timer = it->second;
+    expiredTimers.push_back(
+        {.expirationTime = timer.expirationTime,
+         .generation = timer.generation,
+         .id = entry.id});
+    if (!timer.repeats) {
+      m_timerById.erase(it);
+      continue;
+    }
+    // keep the original cadence, skipping intervals that were missed
+    auto nextExpirationTime = timer.expirationTime + timer.interval;
+    if (nextExpirationTime <= targetTime) {
+      auto missedIntervals =
+          (targetTime - nextExpirationTime) / timer.interval + 1;
+      nextExpirationTime += missedIntervals * timer.interval;
+    }
+    timer.expirationTime = nextExpirationTime;
+    timer.generation = m_nextGeneration++;
+    insert(entry.id, timer);
+  }
+}
+
+bool TimerWheel::isValid(Entry const& entry) const {
+  auto it = m_timerById.find(entry.id);
+  return it != m_timerById.end() && it->second.generation == entry.generation;
+}
+
+} // namespace rnoh
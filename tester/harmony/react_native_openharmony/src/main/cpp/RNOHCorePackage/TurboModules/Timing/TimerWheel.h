@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace rnoh {
+
+/**
+ * Hierarchical timer wheel with a 1 ms resolution. Scheduling and cancelling
+ * a timer is O(1), advancing the time is proportional to the number of
+ * expired timers and the number of wheel slots crossed. Not thread safe.
+ */
+class TimerWheel {
+ public:
+  using TimerId = int64_t;
+  using Milliseconds = int64_t;
+
+  TimerWheel(Milliseconds currentTime = 0);
+
+  /**
+   * Schedules (or reschedules) a timer to expire `delay` milliseconds after
+   * the current wheel time. Repeating timers are rescheduled every `delay`
+   * milliseconds, relative to their expiration time, so they don't drift.
+   */
+  void schedule(TimerId id, Milliseconds delay, bool repeats);
+
+  void cancel(TimerId id);
+
+  /**
+   * Moves the wheel time forward and returns ids of expired timers, ordered by
+   * their expiration time and then by the order in which they were scheduled.
+   * A repeating timer is returned at most once per call.
+   */
+  std::vector<TimerId> advance(Milliseconds currentTime);
+
+  /**
+   * Returns the time at which the wheel should be advanced next. It's either
+   * the expiration time of the earliest timer or the time at which timers
+   * from a higher wheel level need to be redistributed.
+   */
+  std::optional<Milliseconds> getNextWakeUpTime() const;
+
+  Milliseconds getCurrentTime() const {
+    return m_currentTime;
+  }
+
+  size_t size() const {
+    return m_timerById.size();
+  }
+
+  bool empty() const {
+    return m_timerById.empty();
+  }
+
+ private:
+  static constexpr size_t BITS_PER_LEVEL = 8;
+  static constexpr size_t SLOTS_PER_LEVEL = 1 << BITS_PER_LEVEL;
+  static constexpr size_t LEVELS_COUNT = 5;
+  static constexpr Milliseconds MAX_DELAY =
+      (Milliseconds(1) << (BITS_PER_LEVEL * (LEVELS_COUNT - 1))) - 1;
+
+  struct Timer {
+    Milliseconds expirationTime;
+    Milliseconds interval;
+    bool repeats;
+    uint64_t generation;
+  };
+
+  struct Entry {
+    TimerId id;
+    uint64_t generation;
+  };
+
+  using Slot = std::vector<Entry>;
+  using Level = std::array<Slot, SLOTS_PER_LEVEL>;
+
+  struct ExpiredTimer {
+    Milliseconds expirationTime;
+    uint64_t generation;
+    TimerId id;
+  };
+
+  static size_t getSlotIndex(Milliseconds time, size_t level) {
+    return (time >> (BITS_PER_LEVEL * level)) & (SLOTS_PER_LEVEL - 1);
+  }
+
+  void insert(TimerId id, Timer const& timer);
+  void cascade(size_t level);
+  void expireCurrentSlot(
+      std::vector<ExpiredTimer>& expiredTimers,
+      Milliseconds targetTime);
+  bool isValid(Entry const& entry) const;
+
+  Milliseconds m_currentTime;
+  uint64_t m_nextGeneration = 0;
+  std::array<Level, LEVELS_COUNT> m_levels;
+  std::array<size_t, LEVELS_COUNT> m_entriesCountByLevel{};
+  std::unordered_map<TimerId, Timer> m_timerById;
+};
+
+} // namespace rnoh
@@ -9,8 +9,14 @@ static jsi::Value __hostFunction_TimingTurboModule_createTimer(
     react::TurboModule& turboModule,
     const jsi::Value* args,
     size_t count) {
-  static_cast<ArkTSTurboModule&>(turboModule)
-      .scheduleCall(rt, "createTimer", args, count);
+  static_cast<TimingTurboModule&>(turboModule)
+      .getTimerScheduler()
+      .createTimer(
+          rt,
+          static_cast<TimerWheel::TimerId>(args[0].asNumber()),
+          args[1].asNumber(),
+          args[2].asNumber(),
+          args[3].asBool());
   return jsi::Value::undefined();
 }
 static jsi::Value __hostFunction_TimingTurboModule_deleteTimer(
@@ -18,8 +24,9 @@ static jsi::Value __hostFunction_TimingTurboModule_deleteTimer(
     react::TurboModule& turboModule,
     const jsi::Value* args,
     size_t count) {
-  static_cast<ArkTSTurboModule&>(turboModule)
-      .scheduleCall(rt, "deleteTimer", args, count);
+  static_cast<TimingTurboModule&>(turboModule)
+      .getTimerScheduler()
+      .deleteTimer(static_cast<TimerWheel::TimerId>(args[0].asNumber()));
   return jsi::Value::undefined();
 }
 static jsi::Value __hostFunction_TimingTurboModule_setSendIdleEvents(
@@ -27,21 +34,65 @@ static jsi::Value __hostFunction_TimingTurboModule_setSendIdleEvents(
     react::TurboModule& turboModule,
     const jsi::Value* args,
     size_t count) {
-  static_cast<ArkTSTurboModule&>(turboModule)
-      .scheduleCall(rt, "setSendIdleEvents", args, count);
+  static_cast<TimingTurboModule&>(turboModule)
+      .getTimerScheduler()
+      .setSendIdleEvents(rt, args[0].asBool());
   return jsi::Value::undefined();
 }
 
+static napi_value onPausedChange(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  size_t argc = 1;
+  napi_value isPaused = nullptr;
+  void* data = nullptr;
+  napi_get_cb_info(env, info, &argc, &isPaused, nullptr, &data);
+  auto weakTimerScheduler = static_cast<std::weak_ptr<TimerScheduler>*>(data);
+  auto timerScheduler =
+      weakTimerScheduler ? weakTimerScheduler->lock() : nullptr;
+  if (timerScheduler != nullptr && argc == 1) {
+    timerScheduler->setPaused(arkJs.getBoolean(isPaused));
+  }
+  return arkJs.getUndefined();
+}
+
 TimingTurboModule::TimingTurboModule(
     const ArkTSTurboModule::Context ctx,
     const std::string name)
-    : ArkTSTurboModule(ctx, name) {
+    : ArkTSTurboModule(ctx, name),
+      m_timerScheduler(std::make_shared<TimerScheduler>(ctx.taskExecutor)) {
   methodMap_ = {
       {"createTimer", {4, __hostFunction_TimingTurboModule_createTimer}},
       {"deleteTimer", {1, __hostFunction_TimingTurboModule_deleteTimer}},
       {"setSendIdleEvents",
        {1, __hostFunction_TimingTurboModule_setSendIdleEvents}},
   };
+  // the app lifecycle is tracked on the ArkTS side, which tells the scheduler
+  // when the app is paused or resumed
+  runOnMainThread([ctx = m_ctx,
+                   weakTimerScheduler =
+                       std::weak_ptr<TimerScheduler>(m_timerScheduler)]() {
+    try {
+      ArkJS arkJs(ctx.env);
+      auto data = new std::weak_ptr<TimerScheduler>(weakTimerScheduler);
+      auto listener =
+          arkJs.createFunction("onPausedChange", onPausedChange, data);
+      // ties the lifetime of the scheduler pointer to the napi function
+      napi_wrap(
+          ctx.env,
+          listener,
+          data,
+          [](napi_env, void* data, void*) {
+            delete static_cast<std::weak_ptr<TimerScheduler>*>(data);
+          },
+          nullptr,
+          nullptr);
+      arkJs.getObject(ctx.arkTsTurboModuleInstanceRef)
+          .call("setPausedChangeListener", {listener});
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception thrown while subscribing to app pauses: "
+                 << e.what();
+    }
+  });
 }
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
@@ -1,14 +1,26 @@
 #pragma once
 
 #include "RNOH/ArkTSTurboModule.h"
+#include "RNOHCorePackage/TurboModules/Timing/TimerScheduler.h"
 
 namespace rnoh {
 
+/**
+ * Timers are handled natively on the JS thread, without going through the
+ * ArkTS side.
+ */
 class JSI_EXPORT TimingTurboModule : public ArkTSTurboModule {
  public:
   TimingTurboModule(
       const ArkTSTurboModule::Context ctx,
       const std::string name);
+
+  TimerScheduler& getTimerScheduler() {
+    return *m_timerScheduler;
+  }
+
+ private:
+  TimerScheduler::Shared m_timerScheduler;
 };
 
-} // namespace rnoh
\ No newline at end of file
+} // namespace rnoh
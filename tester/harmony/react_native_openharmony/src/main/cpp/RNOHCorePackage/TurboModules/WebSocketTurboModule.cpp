@@ -1,16 +1,79 @@
 #include "WebSocketTurboModule.h"
+#include <glog/logging.h>
+#include <jsi/JSIDynamic.h>
+#include <array>
+#include "RNOH/Base64.h"
+#include "RNOH/SharedByteBuffer.h"
 
 namespace rnoh {
 using namespace facebook;
 
+void WebSocketEventSink::emitEvent(
+    std::string eventName,
+    folly::dynamic params,
+    std::shared_ptr<std::string const> binaryData) {
+  runOnJSThread([eventName = std::move(eventName),
+                 params = std::move(params),
+                 binaryData = std::move(binaryData)](jsi::Runtime& rt) mutable {
+    if (binaryData != nullptr) {
+      params["data"] =
+          encodeBase64(folly::ByteRange(folly::StringPiece(*binaryData)));
+    }
+    emitDeviceEvent(rt, eventName, jsi::valueFromDynamic(rt, params));
+  });
+}
+
+static napi_value onEvent(napi_env env, napi_callback_info info) {
+  ArkJS arkJs(env);
+  std::array<napi_value, 3> args{};
+  auto sink = WebSocketEventSink::getSink(env, info, args, 2);
+  if (!sink) {
+    return arkJs.getUndefined();
+  }
+  std::shared_ptr<std::string const> binaryData;
+  if (args[2] != nullptr && arkJs.isArrayBuffer(args[2])) {
+    // the only copy of the message, needed to move it off the ArkTS heap
+    auto bytes = arkJs.getArrayBufferRange(args[2]);
+    binaryData = std::make_shared<std::string const>(
+        reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  }
+  sink->emitEvent(
+      arkJs.getString(args[0]),
+      arkJs.getDynamic(args[1]),
+      std::move(binaryData));
+  return arkJs.getUndefined();
+}
+
+napi_value WebSocketEventSink::createHandler(ArkJS& arkJs, void* data) {
+  return arkJs.createFunction("onEvent", onEvent, data);
+}
+
+static jsi::Value __hostFunction_WebSocketTurboModule_connect(
+    jsi::Runtime& rt,
+    react::TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  return static_cast<WebSocketTurboModule&>(turboModule)
+      .connect(rt, args, count);
+}
+
+static jsi::Value __hostFunction_WebSocketTurboModule_sendBinary(
+    jsi::Runtime& rt,
+    react::TurboModule& turboModule,
+    const jsi::Value* args,
+    size_t count) {
+  return static_cast<WebSocketTurboModule&>(turboModule)
+      .sendBinary(rt, args, count);
+}
+
 WebSocketTurboModule::WebSocketTurboModule(
     const ArkTSTurboModule::Context ctx,
     const std::string name)
     : ArkTSTurboModule(ctx, name) {
   methodMap_ = {
-      ARK_METHOD_METADATA(connect, 4),
+      {"connect", {4, __hostFunction_WebSocketTurboModule_connect}},
       ARK_METHOD_METADATA(send, 2),
-      ARK_METHOD_METADATA(sendBinary, 2),
+      {"sendBinary", {2, __hostFunction_WebSocketTurboModule_sendBinary}},
       ARK_METHOD_METADATA(ping, 1),
       ARK_METHOD_METADATA(close, 3),
       // event emitters
@@ -19,4 +82,77 @@ WebSocketTurboModule::WebSocketTurboModule(
   };
 }
 
+WebSocketTurboModule::~WebSocketTurboModule() {
+  if (m_eventSink == nullptr) {
+    return;
+  }
+  m_ctx.taskExecutor->runTask(
+      TaskThread::MAIN, [env = m_ctx.env, sink = m_eventSink]() {
+        ArkJS arkJs(env);
+        sink->releaseHandler(arkJs);
+      });
+}
+
+WebSocketEventSink::Shared const& WebSocketTurboModule::getEventSink(
+    jsi::Runtime& rt) {
+  if (m_eventSink == nullptr) {
+    m_eventSink = std::make_shared<WebSocketEventSink>(m_ctx.jsInvoker, rt);
+    // scheduled calls run in order, before any later call of this module
+    runOnMainThread([ctx = m_ctx, sink = m_eventSink]() {
+      try {
+        ArkJS arkJs(ctx.env);
+        arkJs.getObject(ctx.arkTsTurboModuleInstanceRef)
+            .call("setEventHandler", {sink->getHandler(arkJs)});
+      } catch (const std::exception& e) {
+        LOG(ERROR) << "Exception thrown while setting the WebSocket event "
+                      "handler: "
+                   << e.what();
+      }
+    });
+  }
+  return m_eventSink;
+}
+
+jsi::Value WebSocketTurboModule::connect(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  getEventSink(rt);
+  return call(rt, "connect", args, count);
+}
+
+// decodes the message on the JS thread and hands the bytes over to the ArkTS
+// side as an ArrayBuffer sharing the decoded buffer
+jsi::Value WebSocketTurboModule::sendBinary(
+    jsi::Runtime& rt,
+    const jsi::Value* args,
+    size_t count) {
+  if (count < 2) {
+    throw jsi::JSError(rt, "WebSocket::sendBinary expects 2 arguments");
+  }
+  auto socketId = args[1].asNumber();
+  auto message = std::make_shared<SharedByteBuffer>(
+      decodeBase64(args[0].asString(rt).utf8(rt)));
+  runOnMainThread([ctx = m_ctx,
+                   sink = getEventSink(rt),
+                   message = std::move(message),
+                   socketId]() {
+    try {
+      ArkJS arkJs(ctx.env);
+      auto napiTurboModuleObject =
+          arkJs.getObject(ctx.arkTsTurboModuleInstanceRef);
+      napiTurboModuleObject.call(
+          "sendBinaryBuffer",
+          {arkJs.createArrayBuffer(message), arkJs.createDouble(socketId)});
+    } catch (const std::exception& e) {
+      // the call is asynchronous, so the failure is reported the same way as
+      // other send failures
+      sink->emitEvent(
+          "websocketFailed",
+          folly::dynamic::object("id", socketId)("message", e.what()));
+    }
+  });
+  return jsi::Value::undefined();
+}
+
 } // namespace rnoh
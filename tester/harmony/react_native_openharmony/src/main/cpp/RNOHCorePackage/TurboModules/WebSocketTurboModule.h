@@ -1,14 +1,60 @@
 #pragma once
 
 #include "RNOH/ArkTSTurboModule.h"
+#include "RNOH/JSEventSink.h"
 
 namespace rnoh {
 
+/**
+ * Emits WebSocket events received on the ArkTS side to JS. All events go
+ * through the sink, so they reach JS in the order in which they were
+ * received. RN's WebSocket expects binary messages as base64 strings; they
+ * are encoded on the JS thread from the received bytes.
+ */
+class WebSocketEventSink : public JSEventSink<WebSocketEventSink> {
+ public:
+  using Shared = std::shared_ptr<WebSocketEventSink>;
+
+  using JSEventSink::JSEventSink;
+
+  /**
+   * If `binaryData` is provided, it's base64-encoded and set as the `data`
+   * param.
+   */
+  void emitEvent(
+      std::string eventName,
+      folly::dynamic params,
+      std::shared_ptr<std::string const> binaryData = nullptr);
+
+  /**
+   * Creates the handler passed to the ArkTS side, a function which it calls
+   * with `(eventName, params, binaryData?: ArrayBuffer)`.
+   */
+  static napi_value createHandler(ArkJS& arkJs, void* data);
+};
+
 class JSI_EXPORT WebSocketTurboModule : public ArkTSTurboModule {
  public:
   WebSocketTurboModule(
       const ArkTSTurboModule::Context ctx,
       const std::string name);
+
+  ~WebSocketTurboModule() override;
+
+  facebook::jsi::Value connect(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
+
+  facebook::jsi::Value sendBinary(
+      facebook::jsi::Runtime& rt,
+      const facebook::jsi::Value* args,
+      size_t count);
+
+ private:
+  WebSocketEventSink::Shared const& getEventSink(facebook::jsi::Runtime& rt);
+
+  WebSocketEventSink::Shared m_eventSink;
 };
 
 } // namespace rnoh
@@ -0,0 +1,37 @@
+#include "AllocationCounter.h"
+#include <cstdlib>
+#include <new>
+
+static thread_local size_t allocationsCount = 0;
+
+size_t getAllocationsCount() {
+  return allocationsCount;
+}
+
+void* operator new(size_t size) {
+  allocationsCount++;
+  if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+  std::free(ptr);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+
+// Counts the allocations made by the calling thread, so that benchmarks can
+// report them next to the timings and tests can check them.
+// AllocationCounter.cpp replaces the global operator new of the binary.
+
+size_t getAllocationsCount();
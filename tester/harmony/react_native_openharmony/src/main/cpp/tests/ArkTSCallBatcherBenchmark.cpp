@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "RNOH/ArkTSCallBatcher.h"
+
+using namespace rnoh;
+
+// Measures how long the JS thread is blocked while issuing async TurboModule
+// calls, which run on the MAIN thread. Compares waiting for each call on the
+// MAIN thread, as ArkTSTurboModule::callAsync did before, scheduling a MAIN
+// thread task per call, and batching the calls with ArkTSCallBatcher. Only the
+// JS task issuing the calls is timed; the benchmark then waits until MAIN
+// has executed all of them.
+
+static constexpr size_t CALLS_COUNT = 10000;
+
+enum class CallMode { SYNC = 0, TASK_PER_CALL = 1, BATCHED = 2 };
+
+static void BM_AsyncCallsFromJSThread(benchmark::State& state) {
+  auto mode = static_cast<CallMode>(state.range(0));
+  auto taskExecutor = std::make_shared<TaskExecutor>();
+  auto callBatcher = std::make_shared<ArkTSCallBatcher>(taskExecutor);
+  std::atomic<size_t> executedCallsCount = 0;
+  auto call = [&executedCallsCount] {
+    executedCallsCount.fetch_add(1, std::memory_order_relaxed);
+  };
+
+  for (auto _ : state) {
+    executedCallsCount = 0;
+    std::chrono::steady_clock::duration blockedTime{};
+    taskExecutor->runSyncTask(TaskThread::JS, [&] {
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < CALLS_COUNT; i++) {
+        switch (mode) {
+          case CallMode::SYNC:
+            taskExecutor->runSyncTask(TaskThread::MAIN, call);
+            break;
+          case CallMode::TASK_PER_CALL:
+            taskExecutor->runTask(TaskThread::MAIN, call);
+            break;
+          case CallMode::BATCHED:
+            callBatcher->enqueue(call);
+            break;
+        }
+      }
+      blockedTime = std::chrono::steady_clock::now() - start;
+    });
+    while (executedCallsCount.load() < CALLS_COUNT) {
+      std::this_thread::yield();
+    }
+    state.SetIterationTime(
+        std::chrono::duration<double>(blockedTime).count());
+  }
+  state.SetItemsProcessed(state.iterations() * CALLS_COUNT);
+}
+BENCHMARK(BM_AsyncCallsFromJSThread)
+    ->ArgName("mode")
+    ->Arg(static_cast<int>(CallMode::SYNC))
+    ->Arg(static_cast<int>(CallMode::TASK_PER_CALL))
+    ->Arg(static_cast<int>(CallMode::BATCHED))
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "RNOH/ArkTSCallBatcher.h"
+
+using namespace rnoh;
+
+class ArkTSCallBatcherTest : public ::testing::Test {
+ protected:
+  void recordCall(int id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_calls.push_back({id, m_taskExecutor->isOnTaskThread(TaskThread::MAIN)});
+  }
+
+  std::vector<std::pair<int, bool>> getCalls() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_calls;
+  }
+
+  // async tasks of a thread run in order, so the calls dispatched by
+  // previous JS tasks have run on MAIN when this returns
+  void waitForIdleThreads() {
+    std::atomic<bool> isIdle = false;
+    m_taskExecutor->runTask(TaskThread::JS, [&] {
+      m_taskExecutor->runTask(TaskThread::MAIN, [&] { isIdle = true; });
+    });
+    while (!isIdle) {
+      std::this_thread::yield();
+    }
+  }
+
+  TaskExecutor::Shared m_taskExecutor = std::make_shared<TaskExecutor>();
+  ArkTSCallBatcher::Shared m_callBatcher =
+      std::make_shared<ArkTSCallBatcher>(m_taskExecutor);
+  std::mutex m_mutex;
+  std::vector<std::pair<int, bool>> m_calls;
+};
+
+TEST_F(ArkTSCallBatcherTest, runsCallsOfJSTaskOnMainThreadInOrder) {
+  m_taskExecutor->runSyncTask(TaskThread::JS, [this] {
+    for (int i = 0; i < 100; i++) {
+      m_callBatcher->enqueue([this, i] { recordCall(i); });
+    }
+    // nothing runs before the JS task has finished
+    EXPECT_TRUE(getCalls().empty());
+  });
+  waitForIdleThreads();
+
+  auto calls = getCalls();
+  ASSERT_EQ(calls.size(), 100);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(calls[i], std::make_pair(i, true));
+  }
+}
+
+TEST_F(ArkTSCallBatcherTest, flushDispatchesPendingCallsBeforeLaterTasks) {
+  m_taskExecutor->runSyncTask(TaskThread::JS, [this] {
+    m_callBatcher->enqueue([this] { recordCall(1); });
+    m_callBatcher->enqueue([this] { recordCall(2); });
+    m_callBatcher->flush();
+    m_taskExecutor->runTask(TaskThread::MAIN, [this] { recordCall(3); });
+    m_callBatcher->enqueue([this] { recordCall(4); });
+  });
+  waitForIdleThreads();
+
+  auto calls = getCalls();
+  ASSERT_EQ(calls.size(), 4);
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(calls[i].first, i + 1);
+  }
+}
+
+TEST_F(ArkTSCallBatcherTest, keepsRunningOtherCallsWhenOneThrows) {
+  m_taskExecutor->runSyncTask(TaskThread::JS, [this] {
+    m_callBatcher->enqueue([] { throw std::runtime_error("call failed"); });
+    m_callBatcher->enqueue([this] { recordCall(1); });
+  });
+  waitForIdleThreads();
+
+  EXPECT_EQ(getCalls().size(), 1);
+}
+
+TEST_F(ArkTSCallBatcherTest, dispatchesCallsEnqueuedOutsideJSThreadAtOnce) {
+  m_callBatcher->enqueue([this] { recordCall(1); });
+  waitForIdleThreads();
+
+  EXPECT_EQ(getCalls(), (std::vector<std::pair<int, bool>>{{1, true}}));
+}
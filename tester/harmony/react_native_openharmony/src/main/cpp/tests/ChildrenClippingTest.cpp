@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "RNOH/ChildrenClipping.h"
+
+using namespace rnoh;
+using namespace facebook::react;
+
+using Tag = ChildrenClipping::Tag;
+
+/**
+ * Stands in for a component and its ArkUI node: keeps the frames of the
+ * children and the tags of the children whose nodes are attached, in the
+ * order in which NativeNodeApi would keep them.
+ */
+class MockComponent : public ChildrenClippingDelegate {
+ public:
+  struct Child {
+    Tag tag;
+    Rect frame;
+  };
+
+  std::vector<Child> children;
+  std::vector<Tag> attachedChildTags;
+  size_t nodeOperationsCount = 0;
+
+  void insertChild(Child child, size_t index, ChildrenClipping& clipping) {
+    attachedChildTags.insert(
+        attachedChildTags.begin() + clipping.onChildInserted(index),
+        child.tag);
+    children.insert(children.begin() + index, child);
+  }
+
+  void removeChild(size_t index, ChildrenClipping& clipping) {
+    auto tag = children[index].tag;
+    children.erase(children.begin() + index);
+    if (!clipping.onChildRemoved(tag)) {
+      attachedChildTags.erase(std::find(
+          attachedChildTags.begin(), attachedChildTags.end(), tag));
+    }
+  }
+
+  /**
+   * Returns true if the attached nodes are in the same order as children.
+   */
+  bool areAttachedChildrenInOrder() const {
+    size_t index = 0;
+    for (auto tag : attachedChildTags) {
+      while (index < children.size() && children[index].tag != tag) {
+        index++;
+      }
+      if (index == children.size()) {
+        return false;
+      }
+      index++;
+    }
+    return true;
+  }
+
+  std::vector<Tag> getChildTagsIntersecting(Rect const& rect) const {
+    std::vector<Tag> tags;
+    for (auto const& child : children) {
+      if (child.frame.getMaxY() >= rect.getMinY() &&
+          child.frame.getMinY() <= rect.getMaxY()) {
+        tags.push_back(child.tag);
+      }
+    }
+    return tags;
+  }
+
+  size_t getChildrenCount() const override {
+    return children.size();
+  }
+
+  Tag getChildTag(size_t index) const override {
+    return children[index].tag;
+  }
+
+  Rect getChildFrame(size_t index) const override {
+    return children[index].frame;
+  }
+
+  void attachChildNode(size_t index, size_t arkUINodeIndex) override {
+    ASSERT_LE(arkUINodeIndex, attachedChildTags.size());
+    attachedChildTags.insert(
+        attachedChildTags.begin() + arkUINodeIndex, children[index].tag);
+    nodeOperationsCount++;
+  }
+
+  void detachChildNode(size_t index) override {
+    auto it = std::find(
+        attachedChildTags.begin(),
+        attachedChildTags.end(),
+        children[index].tag);
+    ASSERT_NE(it, attachedChildTags.end());
+    attachedChildTags.erase(it);
+    nodeOperationsCount++;
+  }
+};
+
+// rows of 100 px, stacked vertically
+static MockComponent::Child createRow(Tag tag, Float top) {
+  return {tag, Rect{{0, top}, {100, 100}}};
+}
+
+static Rect const VIEWPORT = {{0, 0}, {100, 250}};
+
+class ChildrenClippingTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    for (Tag tag = 0; tag < 5; tag++) {
+      m_component.insertChild(createRow(tag, tag * 100), tag, m_clipping);
+    }
+  }
+
+  MockComponent m_component;
+  ChildrenClipping m_clipping{&m_component};
+};
+
+TEST_F(ChildrenClippingTest, detachesChildrenOutsideOfClippingRect) {
+  m_clipping.setClippingRect(VIEWPORT);
+
+  EXPECT_EQ(m_component.attachedChildTags, (std::vector<Tag>{0, 1, 2}));
+}
+
+TEST_F(ChildrenClippingTest, reattachesChildrenInOrderWhenRectMoves) {
+  m_clipping.setClippingRect(VIEWPORT);
+  m_clipping.setClippingRect(Rect{{0, 250}, {100, 250}});
+
+  EXPECT_EQ(m_component.attachedChildTags, (std::vector<Tag>{2, 3, 4}));
+
+  m_clipping.setClippingRect(std::nullopt);
+
+  EXPECT_EQ(m_component.attachedChildTags, (std::vector<Tag>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(ChildrenClippingTest, reattachesClippedChildMovedIntoClippingRect) {
+  m_clipping.setClippingRect(VIEWPORT);
+
+  m_component.children[4].frame.origin.y = 150;
+  m_clipping.onChildFrameChanged(4, m_component.children[4].frame);
+
+  EXPECT_EQ(m_component.attachedChildTags, (std::vector<Tag>{0, 1, 2, 4}));
+}
+
+TEST_F(ChildrenClippingTest, detachesChildMovedOutOfClippingRect) {
+  m_clipping.setClippingRect(VIEWPORT);
+
+  m_component.children[1].frame.origin.y = 1000;
+  m_clipping.onChildFrameChanged(1, m_component.children[1].frame);
+
+  EXPECT_EQ(m_component.attachedChildTags, (std::vector<Tag>{0, 2}));
+}
+
+TEST_F(ChildrenClippingTest, ignoresFrameChangesWhichDontChangeClipping) {
+  m_clipping.setClippingRect(VIEWPORT);
+  auto nodeOperationsCount = m_component.nodeOperationsCount;
+
+  m_component.children[0].frame.origin.y = 10;
+  m_clipping.onChildFrameChanged(0, m_component.children[0].frame);
+  m_component.children[4].frame.origin.y = 500;
+  m_clipping.onChildFrameChanged(4, m_component.children[4].frame);
+
+  EXPECT_EQ(m_component.nodeOperationsCount, nodeOperationsCount);
+}
+
+TEST_F(ChildrenClippingTest, insertsChildrenAfterClippedOnes) {
+  m_clipping.setClippingRect(Rect{{0, 250}, {100, 250}});
+
+  m_component.insertChild(createRow(5, 1000), 1, m_clipping);
+
+  EXPECT_EQ(m_component.attachedChildTags, (std::vector<Tag>{5, 2, 3, 4}));
+}
+
+TEST_F(ChildrenClippingTest, reportsRemovalOfClippedChild) {
+  m_clipping.setClippingRect(VIEWPORT);
+
+  EXPECT_TRUE(m_clipping.onChildRemoved(4));
+  EXPECT_FALSE(m_clipping.onChildRemoved(0));
+}
+
+TEST(ChildrenClippingScrollTest, keepsAttachedNodesCountBoundedIn10kChildren) {
+  MockComponent component;
+  ChildrenClipping clipping{&component};
+  for (Tag tag = 0; tag < 10000; tag++) {
+    component.insertChild(createRow(tag, tag * 100), tag, clipping);
+  }
+  size_t maxAttachedNodesCount = 0;
+
+  for (Float offset = 0; offset <= 10000 * 100; offset += 1000) {
+    Rect viewport = {{0, offset}, {100, 1000}};
+    clipping.setClippingRect(viewport);
+    maxAttachedNodesCount =
+        std::max(maxAttachedNodesCount, component.attachedChildTags.size());
+    ASSERT_EQ(
+        component.attachedChildTags,
+        component.getChildTagsIntersecting(viewport));
+  }
+
+  // 10 rows in the viewport and the rows touching its edges
+  EXPECT_LE(maxAttachedNodesCount, 12);
+  // each row is detached when the rect is set, then attached and detached
+  // at most once when it's scrolled past
+  EXPECT_LE(component.nodeOperationsCount, 3 * 10000);
+}
+
+TEST(ChildrenClippingScrollTest, appendsChildrenAfterClippedOnes) {
+  MockComponent component;
+  ChildrenClipping clipping{&component};
+  Rect viewport = {{0, 0}, {100, 1000}};
+  clipping.setClippingRect(viewport);
+
+  for (Tag tag = 0; tag < 1000; tag++) {
+    component.insertChild(createRow(tag, tag * 100), tag, clipping);
+    clipping.updateClippedChildren();
+  }
+
+  EXPECT_EQ(
+      component.attachedChildTags,
+      component.getChildTagsIntersecting(viewport));
+}
+
+TEST(ChildrenClippingScrollTest, keepsNodesInOrderWhenChildrenChange) {
+  MockComponent component;
+  ChildrenClipping clipping{&component};
+  std::mt19937 random(42);
+  auto getRandomTop = [&random] {
+    return static_cast<Float>(random() % 100000);
+  };
+  Tag nextTag = 0;
+  for (; nextTag < 500; nextTag++) {
+    component.insertChild(createRow(nextTag, getRandomTop()), 0, clipping);
+  }
+  Rect viewport = {{0, 0}, {100, 20000}};
+  clipping.setClippingRect(viewport);
+
+  for (int i = 0; i < 2000; i++) {
+    auto index = random() % component.children.size();
+    switch (random() % 4) {
+      case 0:
+        component.insertChild(
+            createRow(nextTag++, getRandomTop()), index, clipping);
+        break;
+      case 1:
+        component.insertChild(
+            createRow(nextTag++, getRandomTop()),
+            component.children.size(),
+            clipping);
+        break;
+      case 2:
+        component.removeChild(index, clipping);
+        break;
+      case 3:
+        component.children[index].frame.origin.y = getRandomTop();
+        clipping.onChildFrameChanged(
+            component.children[index].tag, component.children[index].frame);
+        break;
+    }
+    ASSERT_TRUE(component.areAttachedChildrenInOrder()) << "step " << i;
+    if (i % 100 == 0) {
+      viewport.origin.y = getRandomTop();
+      clipping.setClippingRect(viewport);
+      ASSERT_EQ(
+          component.attachedChildTags,
+          component.getChildTagsIntersecting(viewport));
+    }
+  }
+}
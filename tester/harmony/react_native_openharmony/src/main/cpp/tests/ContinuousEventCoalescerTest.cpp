@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <jsi/decorator.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include "RNOH/ContinuousEventCoalescer.h"
+
+using namespace rnoh;
+using namespace facebook;
+
+namespace {
+
+/**
+ * The coalescer doesn't use the runtime passed to executor callbacks, so a
+ * decorator which doesn't decorate any runtime is enough.
+ */
+class UnusedRuntime : public jsi::RuntimeDecorator<jsi::Runtime> {
+ public:
+  UnusedRuntime() : RuntimeDecorator(*this) {}
+};
+
+/**
+ * Queues callbacks until the test runs them, like a JS thread which is busy
+ * and doesn't consume events.
+ */
+class StalledRuntimeExecutor {
+ public:
+  react::RuntimeExecutor get() {
+    return [this](std::function<void(jsi::Runtime&)>&& callback) {
+      m_callbacks.push_back(std::move(callback));
+    };
+  }
+
+  void runPendingCallbacks() {
+    auto callbacks = std::move(m_callbacks);
+    m_callbacks.clear();
+    for (auto& callback : callbacks) {
+      callback(m_runtime);
+    }
+  }
+
+ private:
+  UnusedRuntime m_runtime;
+  std::deque<std::function<void(jsi::Runtime&)>> m_callbacks;
+};
+
+class ContinuousEventCoalescerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_coalescer->setRuntimeExecutor(m_executor.get());
+  }
+
+  void dispatchEvent(
+      ContinuousEventCoalescer::Tag tag,
+      std::string const& eventType,
+      std::string const& payload) {
+    m_coalescer->dispatchEvent(tag, eventType, [this, payload] {
+      m_dispatchedPayloads.push_back(payload);
+    });
+  }
+
+  std::shared_ptr<ContinuousEventCoalescer> m_coalescer =
+      std::make_shared<ContinuousEventCoalescer>();
+  StalledRuntimeExecutor m_executor;
+  std::vector<std::string> m_dispatchedPayloads;
+};
+
+} // namespace
+
+TEST(ContinuousEventCoalescerWithoutExecutorTest, dispatchesEveryEvent) {
+  auto coalescer = std::make_shared<ContinuousEventCoalescer>();
+  size_t dispatchedEventsCount = 0;
+
+  for (int i = 0; i < 3; i++) {
+    coalescer->dispatchEvent(
+        1, "topScroll", [&dispatchedEventsCount] { dispatchedEventsCount++; });
+  }
+
+  EXPECT_EQ(dispatchedEventsCount, 3);
+}
+
+TEST_F(ContinuousEventCoalescerTest, keepsLatestEventWhileExecutorIsStalled) {
+  dispatchEvent(1, "topScroll", "a");
+  dispatchEvent(1, "topScroll", "b");
+  dispatchEvent(1, "topScroll", "c");
+  dispatchEvent(1, "topScroll", "d");
+
+  EXPECT_EQ(m_dispatchedPayloads, std::vector<std::string>{"a"});
+
+  m_executor.runPendingCallbacks();
+
+  EXPECT_EQ(m_dispatchedPayloads, (std::vector<std::string>{"a", "d"}));
+
+  m_executor.runPendingCallbacks();
+  dispatchEvent(1, "topScroll", "e");
+
+  EXPECT_EQ(m_dispatchedPayloads, (std::vector<std::string>{"a", "d", "e"}));
+}
+
+TEST_F(ContinuousEventCoalescerTest, coalescesEachTargetAndEventType) {
+  dispatchEvent(1, "topScroll", "1 scroll a");
+  dispatchEvent(1, "topScroll", "1 scroll b");
+  dispatchEvent(2, "topScroll", "2 scroll a");
+  dispatchEvent(1, "topTouchMove", "1 move a");
+
+  EXPECT_EQ(
+      m_dispatchedPayloads,
+      (std::vector<std::string>{"1 scroll a", "2 scroll a", "1 move a"}));
+}
+
+TEST_F(ContinuousEventCoalescerTest, flushDispatchesPendingEventsOfTarget) {
+  dispatchEvent(1, "topTouchMove", "1 move a");
+  dispatchEvent(1, "topTouchMove", "1 move b");
+  dispatchEvent(2, "topTouchMove", "2 move a");
+  dispatchEvent(2, "topTouchMove", "2 move b");
+
+  m_coalescer->flush(1);
+  m_dispatchedPayloads.push_back("1 touch end");
+
+  EXPECT_EQ(
+      m_dispatchedPayloads,
+      (std::vector<std::string>{
+          "1 move a", "2 move a", "1 move b", "1 touch end"}));
+
+  // the flushed event isn't dispatched again once JS consumes the first one
+  m_executor.runPendingCallbacks();
+
+  EXPECT_EQ(
+      m_dispatchedPayloads,
+      (std::vector<std::string>{
+          "1 move a", "2 move a", "1 move b", "1 touch end", "2 move b"}));
+}
+
+TEST_F(ContinuousEventCoalescerTest, flushAllDispatchesEveryPendingEvent) {
+  dispatchEvent(1, "topScroll", "1 a");
+  dispatchEvent(1, "topScroll", "1 b");
+  dispatchEvent(2, "topScroll", "2 a");
+  dispatchEvent(2, "topScroll", "2 b");
+
+  m_coalescer->flushAll();
+
+  EXPECT_EQ(m_dispatchedPayloads.size(), 4);
+}
+
+TEST_F(ContinuousEventCoalescerTest, countsDispatchedAndCoalescedEvents) {
+  dispatchEvent(1, "topScroll", "a");
+  dispatchEvent(1, "topScroll", "b");
+  dispatchEvent(1, "topScroll", "c");
+  dispatchEvent(1, "topTouchMove", "a");
+  m_executor.runPendingCallbacks();
+
+  auto statsByEventType = m_coalescer->getStatsByEventType();
+
+  EXPECT_EQ(statsByEventType["topScroll"].dispatchedEventsCount, 2);
+  EXPECT_EQ(statsByEventType["topScroll"].coalescedEventsCount, 1);
+  EXPECT_EQ(statsByEventType["topTouchMove"].dispatchedEventsCount, 1);
+  EXPECT_EQ(statsByEventType["topTouchMove"].coalescedEventsCount, 0);
+}
+
+TEST_F(ContinuousEventCoalescerTest, serializesStats) {
+  dispatchEvent(1, "topScroll", "a");
+  dispatchEvent(1, "topScroll", "b");
+  dispatchEvent(1, "topScroll", "c");
+
+  EXPECT_EQ(
+      m_coalescer->getStatsJSON(),
+      "[{\"eventType\":\"topScroll\",\"dispatchedEventsCount\":1,"
+      "\"coalescedEventsCount\":1}]");
+}
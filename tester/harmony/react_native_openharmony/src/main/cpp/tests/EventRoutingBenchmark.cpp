@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RNOH/EventRoutingTable.h"
+
+using namespace rnoh;
+
+// Compares routing an event with EventRoutingTable with passing it to every
+// handler, which then compares the event name, as RNInstance did before
+// handlers declared their event names. Each handler handles a single event,
+// and the routed event is handled by one of them.
+
+class Handler {
+ public:
+  explicit Handler(std::string eventName) : m_eventName(std::move(eventName)) {}
+  virtual ~Handler() = default;
+
+  virtual void handleEvent(std::string const& eventName) {
+    if (eventName == m_eventName) {
+      m_handledEventsCount++;
+    }
+  }
+
+  std::string const& getEventName() const {
+    return m_eventName;
+  }
+
+ private:
+  std::string m_eventName;
+  size_t m_handledEventsCount = 0;
+};
+
+static std::vector<std::shared_ptr<Handler>> createHandlers(size_t count) {
+  std::vector<std::shared_ptr<Handler>> handlers;
+  for (size_t i = 0; i < count; i++) {
+    handlers.push_back(
+        std::make_shared<Handler>("onEvent" + std::to_string(i)));
+  }
+  return handlers;
+}
+
+static void BM_BroadcastEvent(benchmark::State& state) {
+  auto handlers = createHandlers(state.range(0));
+  std::string eventName = "onEvent0";
+  for (auto _ : state) {
+    for (auto const& handler : handlers) {
+      handler->handleEvent(eventName);
+    }
+  }
+}
+BENCHMARK(BM_BroadcastEvent)->Arg(10)->Arg(50);
+
+static void BM_RouteEvent(benchmark::State& state) {
+  EventRoutingTable<std::shared_ptr<Handler>> table;
+  for (auto const& handler : createHandlers(state.range(0))) {
+    table.add(handler, {handler->getEventName()});
+  }
+  std::string eventName = "onEvent0";
+  for (auto _ : state) {
+    table.forEachHandler(eventName, [&eventName](auto const& handler) {
+      handler->handleEvent(eventName);
+    });
+  }
+}
+BENCHMARK(BM_RouteEvent)->Arg(10)->Arg(50);
+
+static void BM_RouteEventToWeakHandlers(benchmark::State& state) {
+  auto handlers = createHandlers(state.range(0));
+  EventRoutingTable<std::weak_ptr<Handler>> table;
+  for (auto const& handler : handlers) {
+    table.add(handler, {handler->getEventName()});
+  }
+  std::string eventName = "onEvent0";
+  for (auto _ : state) {
+    table.forEachHandler(eventName, [&eventName](auto const& weakHandler) {
+      if (auto handler = weakHandler.lock()) {
+        handler->handleEvent(eventName);
+      }
+    });
+  }
+}
+BENCHMARK(BM_RouteEventToWeakHandlers)->Arg(10)->Arg(50);
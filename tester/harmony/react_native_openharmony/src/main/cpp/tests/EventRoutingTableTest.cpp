@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RNOH/EventRoutingTable.h"
+
+using namespace rnoh;
+
+using HandlerRef = std::shared_ptr<std::string>;
+
+static std::vector<std::string> getHandlersOf(
+    EventRoutingTable<HandlerRef> const& table,
+    std::string const& eventName) {
+  std::vector<std::string> handlers;
+  table.forEachHandler(eventName, [&handlers](HandlerRef const& handler) {
+    handlers.push_back(*handler);
+  });
+  return handlers;
+}
+
+TEST(EventRoutingTableTest, routesEventsByName) {
+  EventRoutingTable<HandlerRef> table;
+  table.add(std::make_shared<std::string>("scroll"), {"onScroll"});
+  table.add(
+      std::make_shared<std::string>("touch"), {"onTouchStart", "onTouchEnd"});
+
+  EXPECT_EQ(
+      getHandlersOf(table, "onScroll"), std::vector<std::string>{"scroll"});
+  EXPECT_EQ(
+      getHandlersOf(table, "onTouchEnd"), std::vector<std::string>{"touch"});
+  EXPECT_TRUE(getHandlersOf(table, "onLayout").empty());
+}
+
+TEST(EventRoutingTableTest, passesEveryEventToHandlersWithoutNames) {
+  EventRoutingTable<HandlerRef> table;
+  table.add(std::make_shared<std::string>("all"), {});
+  table.add(std::make_shared<std::string>("scroll"), {"onScroll"});
+
+  EXPECT_EQ(
+      getHandlersOf(table, "onScroll"),
+      (std::vector<std::string>{"scroll", "all"}));
+  EXPECT_EQ(getHandlersOf(table, "onLayout"), std::vector<std::string>{"all"});
+}
+
+TEST(EventRoutingTableTest, removesHandlersFromEveryEvent) {
+  EventRoutingTable<HandlerRef> table;
+  auto touchHandler = std::make_shared<std::string>("touch");
+  table.add(touchHandler, {"onTouchStart", "onTouchEnd"});
+  table.add(std::make_shared<std::string>("all"), {});
+
+  EXPECT_TRUE(table.removeIf(
+      [&](HandlerRef const& handler) { return handler == touchHandler; }));
+  EXPECT_EQ(
+      getHandlersOf(table, "onTouchEnd"), std::vector<std::string>{"all"});
+  EXPECT_FALSE(table.removeIf(
+      [&](HandlerRef const& handler) { return handler == touchHandler; }));
+}
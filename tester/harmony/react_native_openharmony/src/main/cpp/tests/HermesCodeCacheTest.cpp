@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include "RNOH/HermesCodeCache.h"
+#include "RNOH/TaskExecutor/TaskExecutor.h"
+
+using namespace rnoh;
+using namespace facebook;
+namespace fs = std::filesystem;
+
+static uint32_t const BYTECODE_VERSION = 96;
+static size_t const MAX_SIZE_IN_BYTES = 1024;
+
+static std::unique_ptr<const react::JSBigString> createSource(
+    std::string source) {
+  return std::make_unique<react::JSBigStdString>(std::move(source));
+}
+
+static std::string createBytecode(std::string const& body) {
+  uint64_t magic = 0x1F1903C103BC1FC6;
+  std::string bytecode(sizeof(magic), '\0');
+  std::memcpy(bytecode.data(), &magic, sizeof(magic));
+  return bytecode + body;
+}
+
+static std::string toString(react::JSBigString const& bundle) {
+  return std::string(bundle.c_str(), bundle.size());
+}
+
+class HermesCodeCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    m_dirPath = fs::temp_directory_path() /
+        ("rnoh_hermes_code_cache_" +
+         std::string(
+             testing::UnitTest::GetInstance()->current_test_info()->name()));
+    fs::remove_all(m_dirPath);
+  }
+
+  void TearDown() override {
+    fs::remove_all(m_dirPath);
+  }
+
+  HermesCodeCache::Shared createCodeCache(
+      uint32_t bytecodeVersion = BYTECODE_VERSION,
+      HermesCodeCache::Compiler compiler = nullptr) {
+    return std::make_shared<HermesCodeCache>(
+        m_dirPath.string(),
+        MAX_SIZE_IN_BYTES,
+        bytecodeVersion,
+        std::move(compiler));
+  }
+
+  size_t getEntriesCount() {
+    std::error_code ec;
+    size_t count = 0;
+    for ([[maybe_unused]] auto const& entry :
+         fs::directory_iterator(m_dirPath, ec)) {
+      count++;
+    }
+    return count;
+  }
+
+  fs::path m_dirPath;
+};
+
+TEST_F(HermesCodeCacheTest, returnsSourceWhenCacheIsEmpty) {
+  auto codeCache = createCodeCache();
+  auto source = createSource("var a = 1;");
+  auto sourcePtr = source.get();
+
+  auto bundle =
+      codeCache->prepareBundle(std::move(source), "index.js", nullptr);
+
+  EXPECT_EQ(bundle.get(), sourcePtr);
+}
+
+TEST_F(HermesCodeCacheTest, returnsStoredBytecodeAfterMiss) {
+  auto codeCache = createCodeCache();
+  codeCache->store(
+      codeCache->getKey(*createSource("var b = 2;")), createBytecode("b"));
+
+  auto missedBundle =
+      codeCache->prepareBundle(createSource("var a = 1;"), "index.js", nullptr);
+  EXPECT_EQ(toString(*missedBundle), "var a = 1;");
+
+  ASSERT_TRUE(codeCache->store(
+      codeCache->getKey(*createSource("var a = 1;")), createBytecode("a")));
+  auto bundle =
+      codeCache->prepareBundle(createSource("var a = 1;"), "index.js", nullptr);
+  EXPECT_EQ(toString(*bundle), createBytecode("a"));
+}
+
+TEST_F(HermesCodeCacheTest, loadsEntriesStoredByPreviousLaunch) {
+  auto key = createCodeCache()->getKey(*createSource("var a = 1;"));
+  createCodeCache()->store(key, createBytecode("a"));
+
+  auto bundle = createCodeCache()->prepareBundle(
+      createSource("var a = 1;"), "index.js", nullptr);
+
+  EXPECT_EQ(toString(*bundle), createBytecode("a"));
+}
+
+TEST_F(HermesCodeCacheTest, removesEntriesOfOtherBytecodeVersions) {
+  auto key = createCodeCache()->getKey(*createSource("var a = 1;"));
+  createCodeCache(BYTECODE_VERSION - 1)->store(key, createBytecode("a"));
+
+  auto codeCache = createCodeCache();
+  auto bundle =
+      codeCache->prepareBundle(createSource("var a = 1;"), "index.js", nullptr);
+
+  EXPECT_EQ(toString(*bundle), "var a = 1;");
+  EXPECT_EQ(getEntriesCount(), 0);
+}
+
+TEST_F(HermesCodeCacheTest, removesEntriesWhichAreNotBytecode) {
+  auto codeCache = createCodeCache();
+  codeCache->store(codeCache->getKey(*createSource("var a = 1;")), "var a;");
+
+  auto bundle =
+      codeCache->prepareBundle(createSource("var a = 1;"), "index.js", nullptr);
+
+  EXPECT_EQ(toString(*bundle), "var a = 1;");
+  EXPECT_EQ(getEntriesCount(), 0);
+}
+
+TEST_F(HermesCodeCacheTest, removesLeastRecentlyUsedEntriesOverSizeLimit) {
+  auto codeCache = createCodeCache();
+  // two entries fit in the cache, three don't
+  auto largeBody = std::string(MAX_SIZE_IN_BYTES / 3, 'x');
+  auto keyA = codeCache->getKey(*createSource("a"));
+  auto keyB = codeCache->getKey(*createSource("b"));
+  auto keyC = codeCache->getKey(*createSource("c"));
+  codeCache->store(keyA, createBytecode(largeBody));
+  codeCache->store(keyB, createBytecode(largeBody));
+  // makes "b" the least recently used entry
+  auto past = fs::file_time_type::clock::now() - std::chrono::hours(1);
+  for (auto const& entry : fs::directory_iterator(m_dirPath)) {
+    if (entry.path().filename().string().rfind(keyB, 0) == 0) {
+      fs::last_write_time(entry.path(), past);
+    }
+  }
+  codeCache->store(keyC, createBytecode(largeBody));
+
+  EXPECT_EQ(getEntriesCount(), 2);
+  EXPECT_EQ(
+      toString(
+          *codeCache->prepareBundle(createSource("b"), "index.js", nullptr)),
+      "b");
+  EXPECT_EQ(
+      toString(
+          *codeCache->prepareBundle(createSource("c"), "index.js", nullptr)),
+      createBytecode(largeBody));
+}
+
+TEST_F(HermesCodeCacheTest, compilesMissedSourceOnBackgroundThread) {
+  auto taskExecutor = std::make_shared<TaskExecutor>();
+  std::promise<bool> compiledOnBackground;
+  auto codeCache = createCodeCache(
+      BYTECODE_VERSION,
+      [&](std::string const& source,
+          std::string const& /*sourceURL*/,
+          std::string& bytecode) {
+        bytecode = createBytecode(source);
+        compiledOnBackground.set_value(
+            taskExecutor->isOnTaskThread(TaskThread::BACKGROUND));
+        return true;
+      });
+
+  auto missedBundle = codeCache->prepareBundle(
+      createSource("var a = 1;"), "index.js", taskExecutor);
+  EXPECT_EQ(toString(*missedBundle), "var a = 1;");
+  EXPECT_TRUE(compiledOnBackground.get_future().get());
+  // the entry is stored after the compiler returns
+  taskExecutor->runSyncTask(TaskThread::BACKGROUND, [] {});
+
+  auto bundle = codeCache->prepareBundle(
+      createSource("var a = 1;"), "index.js", taskExecutor);
+  EXPECT_EQ(toString(*bundle), createBytecode("var a = 1;"));
+}
+
+TEST_F(HermesCodeCacheTest, keepsSourceWhenCompilationFails) {
+  auto taskExecutor = std::make_shared<TaskExecutor>();
+  auto codeCache = createCodeCache(
+      BYTECODE_VERSION,
+      [](std::string const&, std::string const&, std::string&) {
+        return false;
+      });
+
+  codeCache->prepareBundle(
+      createSource("var a = 1;"), "index.js", taskExecutor);
+  taskExecutor->runSyncTask(TaskThread::BACKGROUND, [] {});
+
+  EXPECT_EQ(getEntriesCount(), 0);
+}
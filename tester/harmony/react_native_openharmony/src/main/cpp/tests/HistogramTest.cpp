@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "RNOH/Performance/Histogram.h"
+
+using namespace rnoh;
+
+static uint64_t getExactPercentile(
+    std::vector<uint64_t> values,
+    double percentile) {
+  std::sort(values.begin(), values.end());
+  auto rank = std::max<size_t>(
+      static_cast<size_t>(std::ceil(percentile / 100 * values.size())), 1);
+  return values[rank - 1];
+}
+
+TEST(HistogramTest, returnsZerosWhenEmpty) {
+  Histogram histogram;
+
+  EXPECT_EQ(histogram.getCount(), 0);
+  EXPECT_EQ(histogram.getMin(), 0);
+  EXPECT_EQ(histogram.getMax(), 0);
+  EXPECT_EQ(histogram.getMean(), 0);
+  EXPECT_EQ(histogram.getPercentile(50), 0);
+}
+
+TEST(HistogramTest, tracksCountMinMaxAndMean) {
+  Histogram histogram;
+  for (uint64_t value : {10, 2, 30}) {
+    histogram.record(value);
+  }
+
+  EXPECT_EQ(histogram.getCount(), 3);
+  EXPECT_EQ(histogram.getMin(), 2);
+  EXPECT_EQ(histogram.getMax(), 30);
+  EXPECT_DOUBLE_EQ(histogram.getMean(), 14);
+}
+
+TEST(HistogramTest, returnsExactPercentilesOfSmallValues) {
+  Histogram histogram;
+  // each value below 8 has its own bucket
+  for (uint64_t value = 0; value < 8; value++) {
+    histogram.record(value);
+  }
+
+  EXPECT_EQ(histogram.getPercentile(0), 0);
+  EXPECT_EQ(histogram.getPercentile(50), 3);
+  EXPECT_EQ(histogram.getPercentile(75), 5);
+  EXPECT_EQ(histogram.getPercentile(100), 7);
+}
+
+TEST(HistogramTest, returnsRecordedValueWhenAllValuesAreEqual) {
+  Histogram histogram;
+  for (int i = 0; i < 10; i++) {
+    histogram.record(1000);
+  }
+
+  EXPECT_EQ(histogram.getPercentile(1), 1000);
+  EXPECT_EQ(histogram.getPercentile(50), 1000);
+  EXPECT_EQ(histogram.getPercentile(99), 1000);
+}
+
+TEST(HistogramTest, overestimatesPercentilesByAtMostQuarter) {
+  Histogram histogram;
+  std::vector<uint64_t> values;
+  std::mt19937_64 random(42);
+  std::lognormal_distribution<double> distribution(8, 2);
+  for (int i = 0; i < 10000; i++) {
+    auto value = static_cast<uint64_t>(distribution(random));
+    values.push_back(value);
+    histogram.record(value);
+  }
+
+  for (double percentile : {1.0, 10.0, 50.0, 90.0, 95.0, 99.0, 99.9}) {
+    auto exactValue = getExactPercentile(values, percentile);
+    auto value = histogram.getPercentile(percentile);
+    EXPECT_GE(value, exactValue) << "p" << percentile;
+    EXPECT_LE(value, exactValue * 1.25) << "p" << percentile;
+  }
+}
+
+TEST(HistogramTest, clampsPercentilesToMax) {
+  Histogram histogram;
+  uint64_t const largeValue = uint64_t(1) << 40;
+  histogram.record(1);
+  histogram.record(largeValue);
+
+  EXPECT_EQ(histogram.getPercentile(100), largeValue);
+  EXPECT_EQ(histogram.getMax(), largeValue);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <set>
+#include "RNOH/ImageLoader/ImageDecodeTarget.h"
+
+using namespace rnoh;
+
+using ScaleMode = ImageDecodeTarget::ScaleMode;
+
+static ImageDecodeTarget
+createTarget(uint32_t width, uint32_t height, ScaleMode scaleMode) {
+  return {.width = width, .height = height, .scaleMode = scaleMode};
+}
+
+static void expectDecodeSize(
+    DecodeSize size,
+    uint32_t expectedWidth,
+    uint32_t expectedHeight) {
+  EXPECT_EQ(size.width, expectedWidth);
+  EXPECT_EQ(size.height, expectedHeight);
+}
+
+TEST(ImageDecodeTargetTest, coverFillsWholeTarget) {
+  auto target = createTarget(100, 100, ScaleMode::COVER);
+
+  // the shorter side matches the target
+  expectDecodeSize(target.getDecodeSize(1000, 500), 200, 100);
+  expectDecodeSize(target.getDecodeSize(500, 1000), 100, 200);
+}
+
+TEST(ImageDecodeTargetTest, containFitsInsideTarget) {
+  auto target = createTarget(100, 100, ScaleMode::CONTAIN);
+
+  // the longer side matches the target
+  expectDecodeSize(target.getDecodeSize(1000, 500), 100, 50);
+  expectDecodeSize(target.getDecodeSize(500, 1000), 50, 100);
+}
+
+TEST(ImageDecodeTargetTest, neverUpscales) {
+  expectDecodeSize(
+      createTarget(1000, 1000, ScaleMode::COVER).getDecodeSize(100, 50),
+      100,
+      50);
+  expectDecodeSize(
+      createTarget(1000, 1000, ScaleMode::CONTAIN).getDecodeSize(100, 50),
+      100,
+      50);
+  // covering a wide target would need upscaling the height
+  expectDecodeSize(
+      createTarget(400, 10, ScaleMode::COVER).getDecodeSize(200, 200),
+      200,
+      200);
+}
+
+TEST(ImageDecodeTargetTest, roundsDecodeSizeUp) {
+  // 4000 * (128 / 4000.0) isn't exactly 128 in floating point
+  expectDecodeSize(
+      createTarget(128, 128, ScaleMode::CONTAIN).getDecodeSize(4000, 3000),
+      128,
+      96);
+  // 200 * (100 / 333.0) = 60.06
+  expectDecodeSize(
+      createTarget(100, 100, ScaleMode::CONTAIN).getDecodeSize(200, 333),
+      61,
+      100);
+}
+
+TEST(ImageDecodeTargetTest, keepsSourceSizeForEmptyTargetOrSource) {
+  expectDecodeSize(
+      createTarget(0, 100, ScaleMode::COVER).getDecodeSize(1000, 500),
+      1000,
+      500);
+  expectDecodeSize(
+      createTarget(100, 100, ScaleMode::COVER).getDecodeSize(0, 500), 0, 500);
+}
+
+TEST(ImageDecodeTargetTest, bucketsTargetsToMultiplesOf64) {
+  auto bucketed = createTarget(65, 128, ScaleMode::COVER).getBucketed();
+  EXPECT_EQ(bucketed, createTarget(128, 128, ScaleMode::COVER));
+
+  EXPECT_EQ(
+      createTarget(1, 0, ScaleMode::CONTAIN).getBucketed(),
+      createTarget(64, 64, ScaleMode::CONTAIN));
+  EXPECT_EQ(
+      createTarget(64, 129, ScaleMode::CONTAIN).getBucketed(),
+      createTarget(64, 192, ScaleMode::CONTAIN));
+}
+
+TEST(ImageDecodeTargetTest, cacheKeysIdentifyTargets) {
+  std::set<std::string> cacheKeys;
+  for (uint32_t width : {64, 128, 640}) {
+    for (uint32_t height : {64, 128, 640}) {
+      for (auto scaleMode : {ScaleMode::COVER, ScaleMode::CONTAIN}) {
+        auto cacheKey = createTarget(width, height, scaleMode).getCacheKey();
+        EXPECT_TRUE(cacheKeys.insert(cacheKey).second) << cacheKey;
+        EXPECT_EQ(
+            cacheKey, createTarget(width, height, scaleMode).getCacheKey());
+      }
+    }
+  }
+  // "6" + "40" and "64" + "0" mustn't produce the same key
+  EXPECT_NE(
+      createTarget(6, 40, ScaleMode::COVER).getCacheKey(),
+      createTarget(64, 0, ScaleMode::COVER).getCacheKey());
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "RNOH/ImageLoader/ImageDiskCache.h"
+
+using namespace rnoh;
+namespace fs = std::filesystem;
+
+static size_t const MAX_SIZE_IN_BYTES = 100;
+
+static std::vector<uint8_t> createData(size_t size, uint8_t value) {
+  return std::vector<uint8_t>(size, value);
+}
+
+class ImageDiskCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    m_dirPath = fs::temp_directory_path() /
+        ("rnoh_image_disk_cache_" +
+         std::string(
+             testing::UnitTest::GetInstance()->current_test_info()->name()));
+    fs::remove_all(m_dirPath);
+  }
+
+  void TearDown() override {
+    fs::remove_all(m_dirPath);
+  }
+
+  ImageDiskCache::Shared createCache() {
+    return std::make_shared<ImageDiskCache>(
+        m_dirPath.string(), MAX_SIZE_IN_BYTES);
+  }
+
+  fs::path m_dirPath;
+};
+
+TEST_F(ImageDiskCacheTest, readsStoredEntry) {
+  auto cache = createCache();
+
+  auto path = cache->store("https://a", createData(10, 'a'));
+
+  ASSERT_TRUE(path.has_value());
+  EXPECT_TRUE(fs::exists(path.value()));
+  EXPECT_EQ(cache->getPath("https://a"), path);
+  EXPECT_EQ(cache->read("https://a"), createData(10, 'a'));
+  EXPECT_FALSE(cache->contains("https://b"));
+}
+
+TEST_F(ImageDiskCacheTest, loadsEntriesStoredByPreviousLaunch) {
+  createCache()->store("https://a", createData(10, 'a'));
+
+  auto cache = createCache();
+
+  EXPECT_TRUE(cache->contains("https://a"));
+  EXPECT_EQ(cache->read("https://a"), createData(10, 'a'));
+}
+
+TEST_F(ImageDiskCacheTest, removesLeastRecentlyUsedEntriesOverSizeLimit) {
+  auto cache = createCache();
+  cache->store("https://a", createData(40, 'a'));
+  cache->store("https://b", createData(40, 'b'));
+  // makes "b" the least recently used entry
+  cache->read("https://a");
+
+  cache->store("https://c", createData(40, 'c'));
+
+  EXPECT_TRUE(cache->contains("https://a"));
+  EXPECT_FALSE(cache->contains("https://b"));
+  EXPECT_TRUE(cache->contains("https://c"));
+}
+
+TEST_F(ImageDiskCacheTest, removesCorruptedEntry) {
+  auto cache = createCache();
+  auto path = cache->store("https://a", createData(10, 'a'));
+  {
+    std::ofstream file(path.value(), std::ios::binary | std::ios::trunc);
+    file << "corrupted!";
+  }
+
+  EXPECT_EQ(cache->read("https://a"), std::nullopt);
+  EXPECT_FALSE(cache->contains("https://a"));
+  EXPECT_FALSE(fs::exists(path.value()));
+}
+
+TEST_F(ImageDiskCacheTest, doesNotKeepEntriesLargerThanLimit) {
+  auto cache = createCache();
+
+  auto path = cache->store("https://a", createData(MAX_SIZE_IN_BYTES + 1, 'a'));
+
+  EXPECT_EQ(path, std::nullopt);
+  EXPECT_FALSE(cache->contains("https://a"));
+}
+
+TEST_F(ImageDiskCacheTest, namesEntriesAfterHashesOfUriAndContent) {
+  auto cache = createCache();
+  std::string content = "hello";
+
+  auto path = cache->store(
+      "The quick brown fox jumps over the lazy dog",
+      std::vector<uint8_t>(content.begin(), content.end()));
+
+  // MurmurHash3_x64_128 of the URI and of the content, so that entries
+  // stored by previous launches are found on every platform
+  ASSERT_TRUE(path.has_value());
+  EXPECT_EQ(
+      fs::path(path.value()).filename(),
+      "e34bbc7bbc071b6c7a433ca9c49a9347.cbd8a7b341bd9b025b1e906a48ae1d19.img");
+}
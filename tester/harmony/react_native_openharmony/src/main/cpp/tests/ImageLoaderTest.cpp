@@ -0,0 +1,476 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include "RNOH/ImageLoader/FileImageFetcher.h"
+#include "RNOH/ImageLoader/ImageLoader.h"
+#include "TestImageDecoder.h"
+
+using namespace rnoh;
+using namespace std::chrono_literals;
+namespace fs = std::filesystem;
+
+/**
+ * Serves "test://" URIs from memory. Fetches can be held, to control which
+ * jobs are running, and they are recorded in the order in which they start.
+ */
+class TestImageFetcher : public ImageFetcher {
+ public:
+  void setImage(std::string const& uri, std::vector<uint8_t> data) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_dataByUri[uri] = std::move(data);
+  }
+
+  void hold() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isHeld = true;
+  }
+
+  void release() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isHeld = false;
+    }
+    m_cv.notify_all();
+  }
+
+  bool waitForFetchesCount(size_t count) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_cv.wait_for(
+        lock, 5s, [&] { return m_fetchedUris.size() >= count; });
+  }
+
+  std::vector<std::string> getFetchedUris() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_fetchedUris;
+  }
+
+  bool canFetch(std::string const& uri) const override {
+    return uri.rfind("test://", 0) == 0;
+  }
+
+  std::vector<uint8_t> fetch(std::string const& uri) override {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_fetchedUris.push_back(uri);
+    m_cv.notify_all();
+    m_cv.wait(lock, [this] { return !m_isHeld; });
+    auto it = m_dataByUri.find(uri);
+    if (it == m_dataByUri.end()) {
+      throw RNOHError("Not found: " + uri);
+    }
+    return it->second;
+  }
+
+ private:
+  std::unordered_map<std::string, std::vector<uint8_t>> m_dataByUri;
+  std::vector<std::string> m_fetchedUris;
+  bool m_isHeld = false;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+/**
+ * Records the results of requests, which are delivered on worker threads.
+ */
+class ResultRecorder {
+ public:
+  struct Result {
+    ImageLoader::Image image;
+    std::optional<std::string> errorMessage;
+  };
+
+  ImageLoader::OnLoad onLoad(std::string name) {
+    return [this, name](ImageLoader::Image const& image) {
+      record(name, {.image = image});
+    };
+  }
+
+  ImageLoader::OnError onError(std::string name) {
+    return [this, name](std::string const& errorMessage) {
+      record(name, {.errorMessage = errorMessage});
+    };
+  }
+
+  bool waitForResultsCount(
+      size_t count,
+      std::chrono::milliseconds timeout = 5s) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_cv.wait_for(
+        lock, timeout, [&] { return m_resultByName.size() >= count; });
+  }
+
+  std::optional<Result> getResult(std::string const& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_resultByName.find(name);
+    if (it == m_resultByName.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+ private:
+  void record(std::string const& name, Result result) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_resultByName.emplace(name, std::move(result));
+    }
+    m_cv.notify_all();
+  }
+
+  std::unordered_map<std::string, Result> m_resultByName;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+};
+
+class ImageLoaderTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    m_dirPath = fs::temp_directory_path() /
+        ("rnoh_image_loader_" +
+         std::string(
+             testing::UnitTest::GetInstance()->current_test_info()->name()));
+    fs::remove_all(m_dirPath);
+    fs::create_directories(m_dirPath);
+  }
+
+  void TearDown() override {
+    m_fetcher->release();
+    if (m_imageLoader != nullptr) {
+      m_imageLoader->stop();
+    }
+    fs::remove_all(m_dirPath);
+  }
+
+  ImageLoader& createImageLoader(size_t workersCount = 2) {
+    m_imageLoader = std::make_unique<ImageLoader>(
+        std::vector<ImageFetcher::Shared>{
+            m_fetcher, std::make_shared<FileImageFetcher>()},
+        m_decoder,
+        1024 * 1024,
+        nullptr,
+        workersCount);
+    return *m_imageLoader;
+  }
+
+  /**
+   * Writes an image to a local file, which FileImageFetcher serves.
+   */
+  std::string createImageFile(
+      std::string const& name,
+      std::vector<uint8_t> const& data) {
+    auto path = m_dirPath / name;
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<char const*>(data.data()), data.size());
+    return "file://" + path.string();
+  }
+
+  static ImageDecodeTarget createTarget(uint32_t size) {
+    return {
+        .width = size,
+        .height = size,
+        .scaleMode = ImageDecodeTarget::ScaleMode::COVER};
+  }
+
+  fs::path m_dirPath;
+  std::shared_ptr<TestImageFetcher> m_fetcher =
+      std::make_shared<TestImageFetcher>();
+  std::shared_ptr<TestImageDecoder> m_decoder =
+      std::make_shared<TestImageDecoder>();
+  std::unique_ptr<ImageLoader> m_imageLoader;
+  ResultRecorder m_recorder;
+};
+
+TEST_F(ImageLoaderTest, loadsAndDownsamplesLocalFile) {
+  auto& imageLoader = createImageLoader();
+  auto uri = createImageFile("a.img", TestImageDecoder::encode(1000, 500));
+
+  imageLoader.loadImage(
+      uri,
+      createTarget(100),
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("a"),
+      m_recorder.onError("a"));
+
+  ASSERT_TRUE(m_recorder.waitForResultsCount(1));
+  auto result = m_recorder.getResult("a");
+  ASSERT_FALSE(result->errorMessage.has_value());
+  EXPECT_EQ(result->image.uri, uri);
+  // the target is bucketed to 128x128 and covered by a 256x128 image
+  EXPECT_EQ(result->image.decodedImage->getWidth(), 256);
+  EXPECT_EQ(result->image.decodedImage->getHeight(), 128);
+  EXPECT_EQ(imageLoader.getStats().downsampledImagesCount, 1);
+}
+
+TEST_F(ImageLoaderTest, returnsImageFromMemoryCacheSynchronously) {
+  auto& imageLoader = createImageLoader();
+  auto uri = createImageFile("a.img", TestImageDecoder::encode(100, 100));
+  imageLoader.loadImage(
+      uri,
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("first"),
+      m_recorder.onError("first"));
+  ASSERT_TRUE(m_recorder.waitForResultsCount(1));
+
+  std::optional<ImageLoader::Image> cachedImage;
+  auto requestId = imageLoader.loadImage(
+      uri,
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      [&](auto const& image) { cachedImage = image; },
+      [](auto const&) {});
+
+  EXPECT_EQ(requestId, 0);
+  ASSERT_TRUE(cachedImage.has_value());
+  EXPECT_EQ(
+      cachedImage->decodedImage,
+      m_recorder.getResult("first")->image.decodedImage);
+  EXPECT_EQ(imageLoader.queryCache(uri), ImageLoader::CacheLocation::MEMORY);
+}
+
+TEST_F(ImageLoaderTest, sharesFetchBetweenRequestsForSameUri) {
+  auto& imageLoader = createImageLoader();
+  m_fetcher->setImage("test://a", TestImageDecoder::encode(100, 100));
+  m_fetcher->hold();
+  for (auto name : {"first", "second"}) {
+    imageLoader.loadImage(
+        "test://a",
+        createTarget(64),
+        ImageLoader::Priority::HIGH,
+        m_recorder.onLoad(name),
+        m_recorder.onError(name));
+  }
+  m_fetcher->release();
+
+  ASSERT_TRUE(m_recorder.waitForResultsCount(2));
+  EXPECT_EQ(m_fetcher->getFetchedUris().size(), 1);
+  EXPECT_EQ(
+      m_recorder.getResult("first")->image.decodedImage,
+      m_recorder.getResult("second")->image.decodedImage);
+}
+
+TEST_F(ImageLoaderTest, reportsFetchErrorToAllRequests) {
+  auto& imageLoader = createImageLoader();
+
+  imageLoader.loadImage(
+      "file://" + (m_dirPath / "missing.img").string(),
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("a"),
+      m_recorder.onError("a"));
+
+  ASSERT_TRUE(m_recorder.waitForResultsCount(1));
+  EXPECT_TRUE(m_recorder.getResult("a")->errorMessage.has_value());
+}
+
+TEST_F(ImageLoaderTest, reportsDecodeErrorOnlyToRequestsOfFailedVariant) {
+  auto& imageLoader = createImageLoader();
+  m_fetcher->setImage("test://a", TestImageDecoder::encode(1000, 1000));
+  m_decoder->failingTargetWidth = 128;
+  m_fetcher->hold();
+  imageLoader.loadImage(
+      "test://a",
+      createTarget(128),
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("failing"),
+      m_recorder.onError("failing"));
+  imageLoader.loadImage(
+      "test://a",
+      createTarget(64),
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("decoded"),
+      m_recorder.onError("decoded"));
+  imageLoader.prefetchImage(
+      "test://a", m_recorder.onLoad("prefetched"), m_recorder.onError("x"));
+  m_fetcher->release();
+
+  ASSERT_TRUE(m_recorder.waitForResultsCount(3));
+  EXPECT_TRUE(m_recorder.getResult("failing")->errorMessage.has_value());
+  auto decodedResult = m_recorder.getResult("decoded");
+  ASSERT_FALSE(decodedResult->errorMessage.has_value());
+  EXPECT_EQ(decodedResult->image.decodedImage->getWidth(), 64);
+  EXPECT_FALSE(m_recorder.getResult("prefetched")->errorMessage.has_value());
+}
+
+TEST_F(ImageLoaderTest, runsHighPriorityJobsBeforeLowPriorityOnes) {
+  auto& imageLoader = createImageLoader(1);
+  for (auto name : {"running", "a", "b", "c"}) {
+    m_fetcher->setImage(
+        std::string("test://") + name, TestImageDecoder::encode(100, 100));
+  }
+  m_fetcher->hold();
+  imageLoader.loadImage(
+      "test://running",
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("running"),
+      m_recorder.onError("running"));
+  ASSERT_TRUE(m_fetcher->waitForFetchesCount(1));
+
+  for (auto [name, priority] :
+       {std::pair{"a", ImageLoader::Priority::LOW},
+        std::pair{"b", ImageLoader::Priority::LOW},
+        std::pair{"c", ImageLoader::Priority::HIGH}}) {
+    imageLoader.loadImage(
+        std::string("test://") + name,
+        std::nullopt,
+        priority,
+        m_recorder.onLoad(name),
+        m_recorder.onError(name));
+  }
+  m_fetcher->release();
+
+  ASSERT_TRUE(m_recorder.waitForResultsCount(4));
+  EXPECT_EQ(
+      m_fetcher->getFetchedUris(),
+      (std::vector<std::string>{
+          "test://running", "test://c", "test://a", "test://b"}));
+}
+
+TEST_F(ImageLoaderTest, runsPendingJobWithRaisedPriorityFirst) {
+  auto& imageLoader = createImageLoader(1);
+  for (auto name : {"running", "a", "b"}) {
+    m_fetcher->setImage(
+        std::string("test://") + name, TestImageDecoder::encode(100, 100));
+  }
+  m_fetcher->hold();
+  imageLoader.loadImage(
+      "test://running",
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("running"),
+      m_recorder.onError("running"));
+  ASSERT_TRUE(m_fetcher->waitForFetchesCount(1));
+  std::vector<ImageLoader::RequestId> requestIds;
+  for (auto name : {"a", "b"}) {
+    requestIds.push_back(imageLoader.loadImage(
+        std::string("test://") + name,
+        std::nullopt,
+        ImageLoader::Priority::LOW,
+        m_recorder.onLoad(name),
+        m_recorder.onError(name)));
+  }
+
+  imageLoader.setRequestPriority(requestIds[1], ImageLoader::Priority::HIGH);
+  m_fetcher->release();
+
+  ASSERT_TRUE(m_recorder.waitForResultsCount(3));
+  EXPECT_EQ(
+      m_fetcher->getFetchedUris(),
+      (std::vector<std::string>{"test://running", "test://b", "test://a"}));
+}
+
+TEST_F(ImageLoaderTest, keepsWorkerFreeForHighPriorityJobs) {
+  // low priority jobs may occupy one of two workers
+  auto& imageLoader = createImageLoader(2);
+  for (auto name : {"a", "b", "c"}) {
+    m_fetcher->setImage(
+        std::string("test://") + name, TestImageDecoder::encode(100, 100));
+  }
+  m_fetcher->hold();
+  for (auto name : {"a", "b"}) {
+    imageLoader.prefetchImage(
+        std::string("test://") + name,
+        m_recorder.onLoad(name),
+        m_recorder.onError(name));
+  }
+  ASSERT_TRUE(m_fetcher->waitForFetchesCount(1));
+
+  imageLoader.loadImage(
+      "test://c",
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("c"),
+      m_recorder.onError("c"));
+  ASSERT_TRUE(m_fetcher->waitForFetchesCount(2));
+  m_fetcher->release();
+
+  ASSERT_TRUE(m_recorder.waitForResultsCount(3));
+  EXPECT_EQ(
+      m_fetcher->getFetchedUris(),
+      (std::vector<std::string>{"test://a", "test://c", "test://b"}));
+}
+
+TEST_F(ImageLoaderTest, stopWaitsForRunningJobsAndSkipsPendingOnes) {
+  auto& imageLoader = createImageLoader(1);
+  m_fetcher->setImage("test://a", TestImageDecoder::encode(100, 100));
+  m_fetcher->setImage("test://b", TestImageDecoder::encode(100, 100));
+  m_fetcher->hold();
+  for (auto name : {"a", "b"}) {
+    imageLoader.loadImage(
+        std::string("test://") + name,
+        std::nullopt,
+        ImageLoader::Priority::HIGH,
+        m_recorder.onLoad(name),
+        m_recorder.onError(name));
+  }
+  ASSERT_TRUE(m_fetcher->waitForFetchesCount(1));
+
+  std::thread releasingThread([this] {
+    std::this_thread::sleep_for(20ms);
+    m_fetcher->release();
+  });
+  imageLoader.stop();
+  releasingThread.join();
+
+  EXPECT_TRUE(m_recorder.getResult("a").has_value());
+  EXPECT_FALSE(m_recorder.getResult("b").has_value());
+  EXPECT_EQ(m_fetcher->getFetchedUris().size(), 1);
+}
+
+TEST_F(ImageLoaderTest, destroyInstanceStopsInstance) {
+  auto imageLoader = std::make_shared<ImageLoader>(
+      std::vector<ImageFetcher::Shared>{m_fetcher},
+      m_decoder,
+      1024,
+      nullptr,
+      1);
+  ImageLoader::initializeInstance(imageLoader);
+  ASSERT_EQ(ImageLoader::getInstance(), imageLoader);
+
+  ImageLoader::destroyInstance();
+  imageLoader->loadImage(
+      "test://a",
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("a"),
+      m_recorder.onError("a"));
+
+  EXPECT_EQ(ImageLoader::getInstance(), nullptr);
+  EXPECT_TRUE(m_fetcher->getFetchedUris().empty());
+}
+
+TEST_F(ImageLoaderTest, destroyInstanceDoesntWaitForRunningFetch) {
+  auto imageLoader = std::make_shared<ImageLoader>(
+      std::vector<ImageFetcher::Shared>{m_fetcher},
+      m_decoder,
+      1024,
+      nullptr,
+      1);
+  ImageLoader::initializeInstance(imageLoader);
+  m_fetcher->setImage("test://a", TestImageDecoder::encode(100, 100));
+  m_fetcher->hold();
+  imageLoader->loadImage(
+      "test://a",
+      std::nullopt,
+      ImageLoader::Priority::HIGH,
+      m_recorder.onLoad("a"),
+      m_recorder.onError("a"));
+  ASSERT_TRUE(m_fetcher->waitForFetchesCount(1));
+  imageLoader = nullptr;
+
+  auto destroying =
+      std::async(std::launch::async, ImageLoader::destroyInstance);
+  auto destroyingStatus = destroying.wait_for(1s);
+  m_fetcher->release();
+
+  EXPECT_EQ(destroyingStatus, std::future_status::ready);
+
+  EXPECT_EQ(ImageLoader::getInstance(), nullptr);
+  EXPECT_FALSE(m_recorder.waitForResultsCount(1, 100ms));
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "RNOH/ImageLoader/ImageMemoryCache.h"
+#include "TestImageDecoder.h"
+
+using namespace rnoh;
+
+// images of 4 bytes per pixel, one pixel high
+static DecodedImage::Shared createImage(size_t byteSize) {
+  DecodeSize size = {.width = uint32_t(byteSize / 4), .height = 1};
+  return std::make_shared<TestDecodedImage>(size, size);
+}
+
+TEST(ImageMemoryCacheTest, returnsCachedVariant) {
+  ImageMemoryCache cache(100);
+  auto image = createImage(12);
+
+  cache.put("a", "64x64:cover", image);
+
+  EXPECT_EQ(cache.get("a", "64x64:cover"), image);
+  EXPECT_EQ(cache.get("a", "128x128:cover"), nullptr);
+  EXPECT_EQ(cache.get("b", "64x64:cover"), nullptr);
+  EXPECT_TRUE(cache.contains("a"));
+  EXPECT_FALSE(cache.contains("b"));
+}
+
+TEST(ImageMemoryCacheTest, removesLeastRecentlyUsedImagesOverSizeLimit) {
+  ImageMemoryCache cache(100);
+  cache.put("a", "source", createImage(40));
+  cache.put("b", "source", createImage(40));
+  // makes "b" the least recently used image
+  cache.get("a", "source");
+
+  cache.put("c", "source", createImage(40));
+
+  EXPECT_NE(cache.get("a", "source"), nullptr);
+  EXPECT_EQ(cache.get("b", "source"), nullptr);
+  EXPECT_NE(cache.get("c", "source"), nullptr);
+  EXPECT_EQ(cache.getSizeInBytes(), 80);
+}
+
+TEST(ImageMemoryCacheTest, doesNotCacheImagesLargerThanLimit) {
+  ImageMemoryCache cache(100);
+  cache.put("a", "source", createImage(40));
+
+  cache.put("b", "source", createImage(104));
+
+  EXPECT_EQ(cache.get("b", "source"), nullptr);
+  EXPECT_NE(cache.get("a", "source"), nullptr);
+}
+
+TEST(ImageMemoryCacheTest, replacesImageOfSameVariant) {
+  ImageMemoryCache cache(100);
+  cache.put("a", "source", createImage(40));
+  auto image = createImage(32);
+
+  cache.put("a", "source", image);
+
+  EXPECT_EQ(cache.get("a", "source"), image);
+  EXPECT_EQ(cache.getSizeInBytes(), 32);
+}
+
+TEST(ImageMemoryCacheTest, removesAllVariantsOfUri) {
+  ImageMemoryCache cache(100);
+  cache.put("a", "64x64:cover", createImage(12));
+  cache.put("a", "128x128:cover", createImage(20));
+  cache.put("b", "64x64:cover", createImage(12));
+
+  cache.remove("a");
+
+  EXPECT_FALSE(cache.contains("a"));
+  EXPECT_TRUE(cache.contains("b"));
+  EXPECT_EQ(cache.getSizeInBytes(), 12);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RNOH/LogRateLimiter.h"
+
+using namespace rnoh;
+using namespace std::chrono_literals;
+
+static LogRateLimiter::Clock::time_point const WINDOW_START_TIME(1000s);
+
+static std::vector<std::pair<std::string, size_t>> takeDroppedMessagesCounts(
+    LogRateLimiter& rateLimiter) {
+  std::vector<std::pair<std::string, size_t>> counts;
+  rateLimiter.takeDroppedMessagesCounts([&](const char* file, size_t count) {
+    counts.emplace_back(file, count);
+  });
+  return counts;
+}
+
+TEST(LogRateLimiterTest, limitsMessagesOfEachFileInWindow) {
+  LogRateLimiter rateLimiter(2, 1000ms);
+
+  EXPECT_TRUE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME));
+  EXPECT_TRUE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME + 100ms));
+  EXPECT_FALSE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME + 200ms));
+  EXPECT_TRUE(rateLimiter.tryAcquire("b.cpp", WINDOW_START_TIME + 300ms));
+}
+
+TEST(LogRateLimiterTest, resetsLimitInNextWindow) {
+  LogRateLimiter rateLimiter(1, 1000ms);
+
+  EXPECT_TRUE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME));
+  EXPECT_FALSE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME + 999ms));
+  EXPECT_TRUE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME + 1000ms));
+}
+
+TEST(LogRateLimiterTest, countsMessagesFromEarlierClockReadsInCurrentWindow) {
+  LogRateLimiter rateLimiter(1, 1000ms);
+
+  EXPECT_TRUE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME + 1000ms));
+  EXPECT_FALSE(rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME + 999ms));
+}
+
+TEST(LogRateLimiterTest, reportsDroppedMessagesOnce) {
+  LogRateLimiter rateLimiter(1, 1000ms);
+  for (int i = 0; i < 4; i++) {
+    rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME);
+  }
+  rateLimiter.tryAcquire("b.cpp", WINDOW_START_TIME);
+
+  EXPECT_EQ(
+      takeDroppedMessagesCounts(rateLimiter),
+      (std::vector<std::pair<std::string, size_t>>{{"a.cpp", 3}}));
+  EXPECT_TRUE(takeDroppedMessagesCounts(rateLimiter).empty());
+}
+
+TEST(LogRateLimiterTest, doesNotLimitFilesOverCapacity) {
+  LogRateLimiter rateLimiter(1, 1000ms);
+  std::vector<std::string> files;
+  for (size_t i = 0; i <= LogRateLimiter::FILES_CAPACITY; i++) {
+    files.push_back("file" + std::to_string(i) + ".cpp");
+  }
+  for (auto const& file : files) {
+    rateLimiter.tryAcquire(file.c_str(), WINDOW_START_TIME);
+  }
+
+  size_t acceptedMessagesCount = 0;
+  for (auto const& file : files) {
+    acceptedMessagesCount +=
+        rateLimiter.tryAcquire(file.c_str(), WINDOW_START_TIME) ? 1 : 0;
+  }
+
+  EXPECT_EQ(acceptedMessagesCount, 1);
+}
+
+TEST(LogRateLimiterTest, acceptsExactlyLimitFromConcurrentThreads) {
+  size_t const MAX_MESSAGES_COUNT = 1000;
+  LogRateLimiter rateLimiter(MAX_MESSAGES_COUNT, 1000ms);
+  std::atomic<size_t> acceptedMessagesCount = 0;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&] {
+      for (size_t j = 0; j < MAX_MESSAGES_COUNT; j++) {
+        if (rateLimiter.tryAcquire("a.cpp", WINDOW_START_TIME)) {
+          acceptedMessagesCount++;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(acceptedMessagesCount, MAX_MESSAGES_COUNT);
+  EXPECT_EQ(
+      takeDroppedMessagesCounts(rateLimiter),
+      (std::vector<std::pair<std::string, size_t>>{
+          {"a.cpp", 3 * MAX_MESSAGES_COUNT}}));
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RNOH/LogRingBuffer.h"
+
+using namespace rnoh;
+using namespace std::chrono_literals;
+
+static bool pushText(LogRingBuffer& ringBuffer, std::string const& text) {
+  return ringBuffer.push([&](LogRingBuffer::Entry& entry) {
+    entry.severity = 0;
+    entry.file = "test.cpp";
+    entry.length = std::snprintf(
+        entry.text, LogRingBuffer::ENTRY_TEXT_CAPACITY, "%s", text.c_str());
+  });
+}
+
+static std::vector<std::string> consumeTexts(LogRingBuffer& ringBuffer) {
+  std::vector<std::string> texts;
+  ringBuffer.consume([&](LogRingBuffer::Entry const& entry) {
+    texts.emplace_back(entry.text, entry.length);
+  });
+  return texts;
+}
+
+TEST(LogRingBufferTest, consumesMessagesInPushOrder) {
+  LogRingBuffer ringBuffer(4);
+
+  pushText(ringBuffer, "a");
+  pushText(ringBuffer, "b");
+  EXPECT_EQ(consumeTexts(ringBuffer), (std::vector<std::string>{"a", "b"}));
+  pushText(ringBuffer, "c");
+  pushText(ringBuffer, "d");
+  pushText(ringBuffer, "e");
+
+  EXPECT_EQ(
+      consumeTexts(ringBuffer), (std::vector<std::string>{"c", "d", "e"}));
+  EXPECT_TRUE(consumeTexts(ringBuffer).empty());
+}
+
+TEST(LogRingBufferTest, dropsAndCountsMessagesWhenFull) {
+  LogRingBuffer ringBuffer(2);
+
+  EXPECT_TRUE(pushText(ringBuffer, "a"));
+  EXPECT_TRUE(pushText(ringBuffer, "b"));
+  EXPECT_FALSE(pushText(ringBuffer, "c"));
+  EXPECT_FALSE(pushText(ringBuffer, "d"));
+
+  EXPECT_EQ(ringBuffer.takeDroppedMessagesCount(), 2);
+  EXPECT_EQ(ringBuffer.takeDroppedMessagesCount(), 0);
+  EXPECT_EQ(consumeTexts(ringBuffer), (std::vector<std::string>{"a", "b"}));
+  EXPECT_TRUE(pushText(ringBuffer, "e"));
+}
+
+TEST(LogRingBufferTest, waitingConsumerIsWokenUpByPush) {
+  LogRingBuffer ringBuffer(4);
+  auto startTime = std::chrono::steady_clock::now();
+  std::vector<std::string> consumedTexts;
+
+  std::thread consumer([&] {
+    ringBuffer.waitForMessages(10s);
+    consumedTexts = consumeTexts(ringBuffer);
+  });
+  std::this_thread::sleep_for(20ms);
+  pushText(ringBuffer, "a");
+  consumer.join();
+
+  EXPECT_EQ(consumedTexts, (std::vector<std::string>{"a"}));
+  EXPECT_LT(std::chrono::steady_clock::now() - startTime, 5s);
+}
+
+TEST(LogRingBufferTest, waitUntilConsumedReturnsAfterMessagesAreConsumed) {
+  LogRingBuffer ringBuffer(16);
+  std::vector<std::string> consumedTexts;
+  std::atomic<bool> isRunning = true;
+  std::thread consumer([&] {
+    while (isRunning) {
+      ringBuffer.consume([&](LogRingBuffer::Entry const& entry) {
+        consumedTexts.emplace_back(entry.text, entry.length);
+      });
+      ringBuffer.waitForMessages(10ms);
+    }
+  });
+
+  for (int i = 0; i < 10; i++) {
+    pushText(ringBuffer, std::to_string(i));
+  }
+  auto isConsumed = ringBuffer.waitUntilConsumed(5s);
+  auto consumedTextsCount = consumedTexts.size();
+  isRunning = false;
+  consumer.join();
+
+  EXPECT_TRUE(isConsumed);
+  EXPECT_EQ(consumedTextsCount, 10);
+}
+
+TEST(LogRingBufferTest, waitUntilConsumedTimesOutWithoutConsumer) {
+  LogRingBuffer ringBuffer(4);
+  pushText(ringBuffer, "a");
+
+  EXPECT_FALSE(ringBuffer.waitUntilConsumed(10ms));
+  consumeTexts(ringBuffer);
+  EXPECT_TRUE(ringBuffer.waitUntilConsumed(10ms));
+}
+
+TEST(LogRingBufferTest, keepsMessagesOfConcurrentProducers) {
+  LogRingBuffer ringBuffer(64);
+  constexpr int PRODUCERS_COUNT = 4;
+  constexpr int MESSAGES_COUNT = 10000;
+  std::atomic<int> finishedProducersCount = 0;
+  std::vector<std::thread> producers;
+  for (int producerId = 0; producerId < PRODUCERS_COUNT; producerId++) {
+    producers.emplace_back([&, producerId] {
+      for (int i = 0; i < MESSAGES_COUNT; i++) {
+        while (!pushText(
+            ringBuffer,
+            std::to_string(producerId) + ":" + std::to_string(i))) {
+          std::this_thread::yield();
+        }
+      }
+      finishedProducersCount++;
+    });
+  }
+
+  std::vector<int> nextMessageIdByProducer(PRODUCERS_COUNT, 0);
+  bool isInOrder = true;
+  auto onEntry = [&](LogRingBuffer::Entry const& entry) {
+    std::string text(entry.text, entry.length);
+    auto separatorIndex = text.find(':');
+    auto producerId = std::stoi(text.substr(0, separatorIndex));
+    auto messageId = std::stoi(text.substr(separatorIndex + 1));
+    isInOrder &= nextMessageIdByProducer[producerId] == messageId;
+    nextMessageIdByProducer[producerId] = messageId + 1;
+  };
+  while (finishedProducersCount < PRODUCERS_COUNT) {
+    ringBuffer.consume(onEntry);
+    // producers retry dropped messages
+    ringBuffer.takeDroppedMessagesCount();
+    ringBuffer.waitForMessages(10ms);
+  }
+  ringBuffer.consume(onEntry);
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_TRUE(isInOrder);
+  EXPECT_EQ(
+      nextMessageIdByProducer,
+      std::vector<int>(PRODUCERS_COUNT, MESSAGES_COUNT));
+}
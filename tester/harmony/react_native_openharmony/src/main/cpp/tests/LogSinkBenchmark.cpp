@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <hilog/log.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include "RNOH/LogSink.h"
+
+// Measures the cost of LogSink::send on the logging thread, with hilog
+// replaced by a mock writing to /dev/null. Messages are sent in bursts which
+// fit in the ring buffer, and the flush thread writes them while timing is
+// paused. The synchronous write is what LogSink did before the ring buffer
+// was added.
+
+#define LOG_DOMAIN 0xBEEF
+#define LOG_TAG "#RNOH_CPP"
+
+static constexpr char MESSAGE[] = "Mounting 42 views on surface 1";
+static constexpr size_t BURST_SIZE = 64;
+
+static LogSink* getLogSink() {
+  LogSink::initializeLogging();
+  return LogSink::getInstance();
+}
+
+static void sendBurst(LogSink* logSink, google::LogSeverity severity) {
+  for (size_t i = 0; i < BURST_SIZE; i++) {
+    logSink->send(
+        severity,
+        __FILE__,
+        "LogSinkBenchmark.cpp",
+        __LINE__,
+        nullptr,
+        MESSAGE,
+        sizeof(MESSAGE) - 1);
+  }
+}
+
+// errors are never rate limited, so every message is formatted and pushed
+static void BM_LogSinkSend(benchmark::State& state) {
+  auto logSink = getLogSink();
+  for (auto _ : state) {
+    sendBurst(logSink, google::GLOG_ERROR);
+    state.PauseTiming();
+    logSink->waitUntilFlushed(std::chrono::seconds(1));
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * BURST_SIZE);
+}
+BENCHMARK(BM_LogSinkSend);
+
+// after the first messages of the window, info messages of the file are
+// dropped by the rate limit before they are formatted
+static void BM_LogSinkSendRateLimited(benchmark::State& state) {
+  auto logSink = getLogSink();
+  for (auto _ : state) {
+    sendBurst(logSink, google::GLOG_INFO);
+    state.PauseTiming();
+    logSink->waitUntilFlushed(std::chrono::seconds(1));
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * BURST_SIZE);
+}
+BENCHMARK(BM_LogSinkSendRateLimited);
+
+static void BM_SynchronousWrite(benchmark::State& state) {
+  std::mutex mutex;
+  char text[rnoh::LogRingBuffer::ENTRY_TEXT_CAPACITY];
+  for (auto _ : state) {
+    for (size_t i = 0; i < BURST_SIZE; i++) {
+      auto length = std::snprintf(
+          text,
+          sizeof(text),
+          "%s %s:%d> %s",
+          "__█",
+          "LogSinkBenchmark.cpp",
+          __LINE__,
+          MESSAGE);
+      benchmark::DoNotOptimize(length);
+      std::lock_guard<std::mutex> lock(mutex);
+      OH_LOG_INFO(LOG_APP, "%{public}s", text);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BURST_SIZE);
+}
+BENCHMARK(BM_SynchronousWrite);
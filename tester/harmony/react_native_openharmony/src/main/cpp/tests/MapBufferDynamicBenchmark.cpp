@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include "AllocationCounter.h"
+
+// Encodes and decodes the touch event payload from
+// MapBufferValidationBenchmark.cpp as folly::dynamic, the representation
+// ArkJS::getDynamic converts NAPI values to. Compare with
+// BM_EncodeTouchEvent and BM_DecodeTouchEvent. The NAPI conversion itself
+// isn't included, it only runs on the device.
+
+static const char* TOUCH_COORDINATE_NAMES[] = {
+    "pageX",
+    "pageY",
+    "locationX",
+    "locationY",
+    "screenX",
+    "screenY"};
+
+static folly::dynamic createTouch(int32_t id) {
+  auto touch = folly::dynamic::object("identifier", id)("target", 42);
+  for (auto name : TOUCH_COORDINATE_NAMES) {
+    touch[name] = 100.5;
+  }
+  return touch;
+}
+
+static folly::dynamic createTouchEvent(size_t touchesCount) {
+  auto touches = folly::dynamic::array();
+  for (size_t i = 0; i < touchesCount; i++) {
+    touches.push_back(createTouch(i));
+  }
+  return folly::dynamic::object("timestamp", 1000.0)("type", 1)(
+      "touches", std::move(touches))(
+      "changedTouches", folly::dynamic::array(createTouch(0)));
+}
+
+static void BM_EncodeTouchEventDynamic(benchmark::State& state) {
+  auto allocationsCountBefore = getAllocationsCount();
+  for (auto _ : state) {
+    auto touchEvent = createTouchEvent(state.range(0));
+    benchmark::DoNotOptimize(touchEvent);
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      getAllocationsCount() - allocationsCountBefore,
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_EncodeTouchEventDynamic)->Arg(1)->Arg(10);
+
+static void BM_DecodeTouchEventDynamic(benchmark::State& state) {
+  auto touchEvent = createTouchEvent(state.range(0));
+  auto allocationsCountBefore = getAllocationsCount();
+  for (auto _ : state) {
+    double sum =
+        touchEvent["timestamp"].asDouble() + touchEvent["type"].asInt();
+    for (auto listName : {"touches", "changedTouches"}) {
+      for (auto const& touch : touchEvent[listName]) {
+        sum += touch["identifier"].asInt() + touch["target"].asInt();
+        for (auto name : TOUCH_COORDINATE_NAMES) {
+          sum += touch[name].asDouble();
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      getAllocationsCount() - allocationsCountBefore,
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DecodeTouchEventDynamic)->Arg(1)->Arg(10);
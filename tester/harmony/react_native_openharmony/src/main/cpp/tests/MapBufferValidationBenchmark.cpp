@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <vector>
+#include "AllocationCounter.h"
+#include "RNOH/MapBufferValidation.h"
+
+using namespace rnoh;
+using namespace facebook::react;
+
+// Compares validating a touch event payload with copying it into a
+// MapBuffer, which ArkJS::getMapBuffer does after validating it, and measures
+// encoding and decoding the payload. The event is shaped like the ones
+// TouchDispatcher sends: a list of touches and a list of changed touches.
+// MapBufferDynamicBenchmark.cpp measures the same payload as folly::dynamic.
+
+static MapBuffer createTouch(int32_t id) {
+  MapBufferBuilder builder;
+  builder.putInt(0, id);
+  builder.putInt(1, 42);
+  for (MapBuffer::Key key = 2; key < 8; key++) {
+    builder.putDouble(key, 100.5);
+  }
+  return builder.build();
+}
+
+static MapBuffer createTouchEvent(size_t touchesCount) {
+  std::vector<MapBuffer> touches;
+  for (size_t i = 0; i < touchesCount; i++) {
+    touches.push_back(createTouch(i));
+  }
+  std::vector<MapBuffer> changedTouches;
+  changedTouches.push_back(createTouch(0));
+  MapBufferBuilder builder;
+  builder.putDouble(0, 1000.0);
+  builder.putInt(1, 1);
+  builder.putMapBufferList(2, touches);
+  builder.putMapBufferList(3, changedTouches);
+  return builder.build();
+}
+
+static void BM_ValidateTouchEvent(benchmark::State& state) {
+  auto touchEvent = createTouchEvent(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        isWellFormedMapBuffer(touchEvent.data(), touchEvent.size()));
+  }
+}
+BENCHMARK(BM_ValidateTouchEvent)->Arg(1)->Arg(10);
+
+static void BM_CopyTouchEvent(benchmark::State& state) {
+  auto touchEvent = createTouchEvent(state.range(0));
+  for (auto _ : state) {
+    MapBuffer copy(std::vector<uint8_t>(
+        touchEvent.data(), touchEvent.data() + touchEvent.size()));
+    benchmark::DoNotOptimize(copy.data());
+  }
+}
+BENCHMARK(BM_CopyTouchEvent)->Arg(1)->Arg(10);
+
+static void BM_EncodeTouchEvent(benchmark::State& state) {
+  auto allocationsCountBefore = getAllocationsCount();
+  for (auto _ : state) {
+    auto touchEvent = createTouchEvent(state.range(0));
+    benchmark::DoNotOptimize(touchEvent.data());
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      getAllocationsCount() - allocationsCountBefore,
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_EncodeTouchEvent)->Arg(1)->Arg(10);
+
+static void BM_DecodeTouchEvent(benchmark::State& state) {
+  auto touchEvent = createTouchEvent(state.range(0));
+  auto allocationsCountBefore = getAllocationsCount();
+  for (auto _ : state) {
+    double sum = touchEvent.getDouble(0) + touchEvent.getInt(1);
+    for (MapBuffer::Key listKey = 2; listKey < 4; listKey++) {
+      for (auto const& touch : touchEvent.getMapBufferList(listKey)) {
+        sum += touch.getInt(0) + touch.getInt(1);
+        for (MapBuffer::Key key = 2; key < 8; key++) {
+          sum += touch.getDouble(key);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      getAllocationsCount() - allocationsCountBefore,
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DecodeTouchEvent)->Arg(1)->Arg(10);
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <cstring>
+#include <vector>
+#include "RNOH/MapBufferValidation.h"
+
+using namespace rnoh;
+using namespace facebook::react;
+
+static constexpr size_t HEADER_SIZE = sizeof(MapBuffer::Header);
+static constexpr size_t BUCKET_SIZE = sizeof(MapBuffer::Bucket);
+
+static std::vector<uint8_t> toBytes(MapBuffer const& mapBuffer) {
+  return std::vector<uint8_t>(
+      mapBuffer.data(), mapBuffer.data() + mapBuffer.size());
+}
+
+static bool isWellFormed(std::vector<uint8_t> const& bytes) {
+  return isWellFormedMapBuffer(bytes.data(), bytes.size());
+}
+
+static void
+writeInt(std::vector<uint8_t>& bytes, size_t offset, int32_t value) {
+  std::memcpy(bytes.data() + offset, &value, sizeof(value));
+}
+
+static MapBuffer createTouch(int32_t id) {
+  MapBufferBuilder builder;
+  builder.putInt(0, id);
+  builder.putDouble(1, 10.5);
+  builder.putString(2, "touch");
+  return builder.build();
+}
+
+TEST(MapBufferValidationTest, acceptsFlatMapBuffer) {
+  MapBufferBuilder builder;
+  builder.putBool(0, true);
+  builder.putInt(1, 42);
+  builder.putDouble(2, 4.2);
+  builder.putString(3, "text");
+
+  EXPECT_TRUE(isWellFormed(toBytes(builder.build())));
+}
+
+TEST(MapBufferValidationTest, acceptsNestedMapsAndLists) {
+  MapBufferBuilder builder;
+  builder.putMapBuffer(0, createTouch(1));
+  std::vector<MapBuffer> touches;
+  touches.push_back(createTouch(1));
+  touches.push_back(createTouch(2));
+  builder.putMapBufferList(1, touches);
+  builder.putMapBufferList(2, {});
+
+  EXPECT_TRUE(isWellFormed(toBytes(builder.build())));
+}
+
+TEST(MapBufferValidationTest, rejectsTruncatedMapBuffer) {
+  auto bytes = toBytes(createTouch(1));
+  bytes.pop_back();
+
+  EXPECT_FALSE(isWellFormed(bytes));
+  EXPECT_FALSE(isWellFormedMapBuffer(bytes.data(), HEADER_SIZE - 1));
+}
+
+TEST(MapBufferValidationTest, rejectsStringOutOfBounds) {
+  MapBufferBuilder builder;
+  builder.putString(0, "text");
+  auto bytes = toBytes(builder.build());
+  // the string is the first entry of the dynamic data
+  writeInt(bytes, HEADER_SIZE + BUCKET_SIZE, 1000);
+
+  EXPECT_FALSE(isWellFormed(bytes));
+}
+
+TEST(MapBufferValidationTest, rejectsNegativeOffset) {
+  MapBufferBuilder builder;
+  builder.putString(0, "text");
+  auto bytes = toBytes(builder.build());
+  // the bucket value follows its key and type
+  writeInt(bytes, HEADER_SIZE + 4, -4);
+
+  EXPECT_FALSE(isWellFormed(bytes));
+}
+
+TEST(MapBufferValidationTest, rejectsCorruptedNestedMap) {
+  MapBufferBuilder innerBuilder;
+  innerBuilder.putString(0, "text");
+  MapBufferBuilder builder;
+  builder.putMapBuffer(0, innerBuilder.build());
+  auto bytes = toBytes(builder.build());
+  auto innerOffset = HEADER_SIZE + BUCKET_SIZE + sizeof(int32_t);
+  ASSERT_TRUE(isWellFormed(bytes));
+  // the nested map is well-formed on its own, but its string isn't
+  writeInt(bytes, innerOffset + HEADER_SIZE + BUCKET_SIZE, 1000);
+
+  EXPECT_FALSE(isWellFormed(bytes));
+}
+
+TEST(MapBufferValidationTest, rejectsCorruptedListItem) {
+  MapBufferBuilder builder;
+  std::vector<MapBuffer> touches;
+  touches.push_back(createTouch(1));
+  touches.push_back(createTouch(2));
+  auto touchSize = touches.front().size();
+  builder.putMapBufferList(0, touches);
+  auto bytes = toBytes(builder.build());
+  auto listOffset = HEADER_SIZE + BUCKET_SIZE + sizeof(int32_t);
+  auto secondItemOffset = listOffset + sizeof(int32_t) + touchSize;
+  ASSERT_TRUE(isWellFormed(bytes));
+  writeInt(bytes, secondItemOffset, touchSize + 1);
+
+  EXPECT_FALSE(isWellFormed(bytes));
+}
+
+TEST(MapBufferValidationTest, rejectsTooDeeplyNestedMaps) {
+  auto createNestedMap = [](size_t depth) {
+    auto mapBuffer = createTouch(0);
+    for (size_t i = 0; i < depth; i++) {
+      MapBufferBuilder builder;
+      builder.putMapBuffer(0, mapBuffer);
+      mapBuffer = builder.build();
+    }
+    return mapBuffer;
+  };
+
+  EXPECT_TRUE(isWellFormed(toBytes(createNestedMap(8))));
+  EXPECT_FALSE(isWellFormed(toBytes(createNestedMap(64))));
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "RNOH/Performance/StartupTimeline.h"
+
+using namespace rnoh;
+
+TEST(StartupTimelineTest, recordsPhasesInStartOrder) {
+  StartupTimeline timeline;
+
+  timeline.markPhaseStart("RUN_JS_BUNDLE", "1");
+  timeline.markPoint("CREATE_REACT_CONTEXT", "1");
+  timeline.markPhaseFinish("RUN_JS_BUNDLE", "1");
+
+  auto phases = timeline.getPhases();
+  ASSERT_EQ(phases.size(), 2);
+  EXPECT_EQ(phases[0].name, "RUN_JS_BUNDLE");
+  EXPECT_TRUE(phases[0].isFinished);
+  EXPECT_LE(phases[0].startTime, phases[0].finishTime);
+  EXPECT_EQ(phases[1].name, "CREATE_REACT_CONTEXT");
+  EXPECT_EQ(phases[1].startTime, phases[1].finishTime);
+}
+
+TEST(StartupTimelineTest, recordsOnlyFirstOccurrenceOfPhase) {
+  StartupTimeline timeline;
+
+  timeline.markPhaseStart("RUN_JS_BUNDLE", "1");
+  timeline.markPhaseFinish("RUN_JS_BUNDLE", "1");
+  auto finishTime = timeline.getPhases()[0].finishTime;
+  timeline.markPhaseStart("RUN_JS_BUNDLE", "1");
+  timeline.markPhaseFinish("RUN_JS_BUNDLE", "1");
+  timeline.markPhaseStart("RUN_JS_BUNDLE", "2");
+
+  auto phases = timeline.getPhases();
+  ASSERT_EQ(phases.size(), 2);
+  EXPECT_EQ(phases[0].finishTime, finishTime);
+  EXPECT_EQ(phases[1].tag, "2");
+}
+
+TEST(StartupTimelineTest, recordsThreadsOfPhaseStartAndFinish) {
+  StartupTimeline timeline;
+
+  timeline.markPhaseStart("LOAD_BUNDLE", "");
+  std::thread([&] { timeline.markPhaseFinish("LOAD_BUNDLE", ""); }).join();
+
+  auto phase = timeline.getPhases()[0];
+  EXPECT_NE(phase.startThreadId, 0);
+  EXPECT_NE(phase.finishThreadId, 0);
+  EXPECT_NE(phase.startThreadId, phase.finishThreadId);
+}
+
+TEST(StartupTimelineTest, samplesPeakRSSWhenPhasesFinish) {
+  StartupTimeline timeline;
+
+  timeline.markPhaseStart("RUN_JS_BUNDLE", "");
+  EXPECT_EQ(timeline.getPhases()[0].finishPeakRSSInKB, 0);
+  timeline.markPhaseFinish("RUN_JS_BUNDLE", "");
+  timeline.markPoint("CREATE_REACT_CONTEXT", "");
+
+  // the host is Linux, which provides VmHWM
+  auto phases = timeline.getPhases();
+  EXPECT_GT(phases[0].finishPeakRSSInKB, 0);
+  EXPECT_GE(phases[1].finishPeakRSSInKB, phases[0].finishPeakRSSInKB);
+  EXPECT_NE(
+      timeline.toJSON().find("\"finishPeakRSSInKB\":"), std::string::npos);
+}
+
+TEST(StartupTimelineTest, serializesUnfinishedPhasesWithNullFinishTime) {
+  StartupTimeline timeline;
+
+  timeline.markPhaseStart("A \"quoted\" name", "");
+
+  auto json = timeline.toJSON();
+  EXPECT_NE(json.find("\"name\":\"A \\\"quoted\\\" name\""), std::string::npos);
+  EXPECT_NE(
+      json.find("\"finishTime\":null,\"finishThreadId\":null,"
+                "\"finishPeakRSSInKB\":null"),
+      std::string::npos);
+}
+
+TEST(StartupTimelineTest, resetRemovesPhases) {
+  StartupTimeline timeline;
+
+  timeline.markPoint("A", "");
+  timeline.reset();
+
+  EXPECT_TRUE(timeline.getPhases().empty());
+  EXPECT_EQ(timeline.toJSON(), "[]");
+}
+
+TEST(StartupTimelineTest, finishesPhaseWithMatchingNameAndTag) {
+  StartupTimeline timeline;
+
+  timeline.markPhaseStart("AB", "C");
+  timeline.markPhaseStart("A", "BC");
+  timeline.markPhaseStart("A", "B");
+  timeline.markPhaseFinish("A", "BC");
+
+  auto phases = timeline.getPhases();
+  ASSERT_EQ(phases.size(), 3);
+  EXPECT_FALSE(phases[0].isFinished);
+  EXPECT_TRUE(phases[1].isFinished);
+  EXPECT_FALSE(phases[2].isFinished);
+}
+
+TEST(StartupTimelineTest, recordsPhasesAgainAfterReset) {
+  StartupTimeline timeline;
+
+  timeline.markPhaseStart("A", "");
+  timeline.reset();
+  timeline.markPhaseStart("B", "");
+  timeline.markPhaseStart("A", "");
+  timeline.markPhaseFinish("A", "");
+
+  auto phases = timeline.getPhases();
+  ASSERT_EQ(phases.size(), 2);
+  EXPECT_EQ(phases[1].name, "A");
+  EXPECT_TRUE(phases[1].isFinished);
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdio>
+#include <optional>
+#include <string>
+#include "RNOH/ImageLoader/ImageDecoder.h"
+#include "RNOH/RNOHError.h"
+
+namespace rnoh {
+
+class TestDecodedImage : public DecodedImage {
+ public:
+  TestDecodedImage(DecodeSize size, DecodeSize sourceSize)
+      : m_size(size), m_sourceSize(sourceSize) {}
+
+  uint32_t getWidth() const override {
+    return m_size.width;
+  }
+  uint32_t getHeight() const override {
+    return m_size.height;
+  }
+  uint32_t getSourceWidth() const override {
+    return m_sourceSize.width;
+  }
+  uint32_t getSourceHeight() const override {
+    return m_sourceSize.height;
+  }
+  size_t getByteSize() const override {
+    return size_t(m_size.width) * m_size.height * 4;
+  }
+
+ private:
+  DecodeSize m_size;
+  DecodeSize m_sourceSize;
+};
+
+/**
+ * Decodes "<width>x<height>" strings into images of that source size.
+ */
+class TestImageDecoder : public ImageDecoder {
+ public:
+  static std::vector<uint8_t> encode(uint32_t width, uint32_t height) {
+    auto text = std::to_string(width) + "x" + std::to_string(height);
+    return std::vector<uint8_t>(text.begin(), text.end());
+  }
+
+  /**
+   * Decoding for targets of this width fails.
+   */
+  std::optional<uint32_t> failingTargetWidth;
+
+  DecodedImage::Shared decode(
+      std::vector<uint8_t> const& data,
+      std::optional<ImageDecodeTarget> const& target) override {
+    std::string text(data.begin(), data.end());
+    DecodeSize sourceSize;
+    if (std::sscanf(
+            text.c_str(), "%ux%u", &sourceSize.width, &sourceSize.height) !=
+        2) {
+      throw RNOHError("Invalid image data");
+    }
+    if (!target.has_value()) {
+      return std::make_shared<TestDecodedImage>(sourceSize, sourceSize);
+    }
+    if (target->width == failingTargetWidth) {
+      throw RNOHError("Couldn't decode the image");
+    }
+    return std::make_shared<TestDecodedImage>(
+        target->getDecodeSize(sourceSize.width, sourceSize.height),
+        sourceSize);
+  }
+};
+
+} // namespace rnoh
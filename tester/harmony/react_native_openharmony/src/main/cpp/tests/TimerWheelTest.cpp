@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include "RNOHCorePackage/TurboModules/Timing/TimerWheel.h"
+
+using namespace rnoh;
+using TimerIds = std::vector<TimerWheel::TimerId>;
+
+TEST(TimerWheelTest, expiresTimersInOrderOfExpirationTime) {
+  TimerWheel timerWheel;
+
+  timerWheel.schedule(1, 30, false);
+  timerWheel.schedule(2, 10, false);
+  timerWheel.schedule(3, 20, false);
+
+  EXPECT_EQ(timerWheel.getNextWakeUpTime(), 10);
+  EXPECT_EQ(timerWheel.advance(100), (TimerIds{2, 3, 1}));
+  EXPECT_TRUE(timerWheel.empty());
+  EXPECT_EQ(timerWheel.getNextWakeUpTime(), std::nullopt);
+}
+
+TEST(TimerWheelTest, expiresTimersWithSameExpirationTimeInSchedulingOrder) {
+  TimerWheel timerWheel;
+
+  timerWheel.schedule(3, 5, false);
+  timerWheel.schedule(1, 5, false);
+  timerWheel.schedule(2, 5, false);
+
+  EXPECT_EQ(timerWheel.advance(4), TimerIds{});
+  EXPECT_EQ(timerWheel.advance(5), (TimerIds{3, 1, 2}));
+}
+
+TEST(TimerWheelTest, doesNotExpireCancelledTimers) {
+  TimerWheel timerWheel;
+
+  timerWheel.schedule(1, 10, false);
+  timerWheel.schedule(2, 1000, false);
+  timerWheel.schedule(3, 20, true);
+  timerWheel.cancel(1);
+  timerWheel.cancel(2);
+
+  EXPECT_EQ(timerWheel.advance(40), (TimerIds{3}));
+  timerWheel.cancel(3);
+  EXPECT_EQ(timerWheel.advance(2000), TimerIds{});
+  EXPECT_TRUE(timerWheel.empty());
+}
+
+TEST(TimerWheelTest, reschedulingTimerReplacesPreviousSchedule) {
+  TimerWheel timerWheel;
+
+  timerWheel.schedule(1, 10, false);
+  timerWheel.schedule(1, 300, false);
+
+  EXPECT_EQ(timerWheel.advance(299), TimerIds{});
+  EXPECT_EQ(timerWheel.advance(300), (TimerIds{1}));
+}
+
+TEST(TimerWheelTest, repeatingTimersDoNotDrift) {
+  TimerWheel timerWheel;
+  timerWheel.schedule(1, 16, true);
+
+  // advancing late doesn't move the following expiration times
+  EXPECT_EQ(timerWheel.advance(20), (TimerIds{1}));
+  EXPECT_EQ(timerWheel.getNextWakeUpTime(), 32);
+  EXPECT_EQ(timerWheel.advance(33), (TimerIds{1}));
+  EXPECT_EQ(timerWheel.getNextWakeUpTime(), 48);
+
+  // missed intervals are skipped and the timer is returned once
+  EXPECT_EQ(timerWheel.advance(1000), (TimerIds{1}));
+  EXPECT_EQ(timerWheel.getNextWakeUpTime(), 1008);
+}
+
+TEST(TimerWheelTest, expiresTimersScheduledOnHigherLevels) {
+  TimerWheel timerWheel(1000);
+
+  timerWheel.schedule(1, 70000, false);
+  timerWheel.schedule(2, 300, false);
+
+  // wake ups happen at least when a higher level slot is redistributed
+  auto wakeUpTime = timerWheel.getNextWakeUpTime();
+  ASSERT_TRUE(wakeUpTime.has_value());
+  EXPECT_LE(*wakeUpTime, 1300);
+  EXPECT_EQ(timerWheel.advance(1300), (TimerIds{2}));
+  EXPECT_EQ(timerWheel.advance(70999), TimerIds{});
+  EXPECT_EQ(timerWheel.advance(71000), (TimerIds{1}));
+}
+
+TEST(TimerWheelTest, treatsNonPositiveDelaysAsOneMillisecond) {
+  TimerWheel timerWheel(50);
+
+  timerWheel.schedule(1, 0, false);
+  timerWheel.schedule(2, -20, false);
+
+  EXPECT_EQ(timerWheel.getNextWakeUpTime(), 51);
+  EXPECT_EQ(timerWheel.advance(51), (TimerIds{1, 2}));
+}
+
+TEST(TimerWheelTest, expiresTenThousandTimersAtTheirExpirationTimes) {
+  TimerWheel timerWheel;
+  std::mt19937 random(42);
+  std::uniform_int_distribution<TimerWheel::Milliseconds> delays(1, 200000);
+  std::uniform_int_distribution<TimerWheel::Milliseconds> steps(1, 5000);
+
+  std::map<TimerWheel::TimerId, TimerWheel::Milliseconds> expirationTimeById;
+  for (TimerWheel::TimerId id = 0; id < 10000; id++) {
+    auto delay = delays(random);
+    timerWheel.schedule(id, delay, false);
+    expirationTimeById[id] = delay;
+  }
+  for (TimerWheel::TimerId id = 0; id < 10000; id += 10) {
+    timerWheel.cancel(id);
+    expirationTimeById.erase(id);
+  }
+
+  size_t expiredTimersCount = 0;
+  TimerWheel::Milliseconds previousTime = 0;
+  while (!timerWheel.empty()) {
+    auto wakeUpTime = timerWheel.getNextWakeUpTime();
+    ASSERT_TRUE(wakeUpTime.has_value());
+    auto currentTime = std::min(previousTime + steps(random), *wakeUpTime);
+    auto expiredTimerIds = timerWheel.advance(currentTime);
+    TimerWheel::Milliseconds previousExpirationTime = 0;
+    for (auto id : expiredTimerIds) {
+      auto expirationTime = expirationTimeById.at(id);
+      EXPECT_GT(expirationTime, previousTime);
+      EXPECT_LE(expirationTime, currentTime);
+      EXPECT_LE(previousExpirationTime, expirationTime);
+      previousExpirationTime = expirationTime;
+    }
+    expiredTimersCount += expiredTimerIds.size();
+    previousTime = currentTime;
+  }
+
+  EXPECT_EQ(expiredTimersCount, expirationTimeById.size());
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include "RNOH/TaskExecutor/ThreadTaskRunner.h"
+
+namespace rnoh {
+
+enum TaskThread {
+  MAIN = 0, // main thread running the eTS event loop
+  JS, // React Native's JS runtime thread
+  BACKGROUND, // background tasks queue
+};
+
+/**
+ * Host replacement of TaskExecutor, which runs MAIN on a NAPI event loop.
+ * Here every thread, MAIN included, is a ThreadTaskRunner. Units using
+ * TaskExecutor are compiled against it when this directory comes first in
+ * the include path.
+ */
+class TaskExecutor {
+ public:
+  using Task = AbstractTaskRunner::Task;
+  using ExceptionHandler = AbstractTaskRunner::ExceptionHandler;
+  using Shared = std::shared_ptr<TaskExecutor>;
+  using Weak = std::weak_ptr<TaskExecutor>;
+
+  TaskExecutor()
+      : m_taskRunners{
+            std::make_shared<ThreadTaskRunner>("RNOH_MAIN"),
+            std::make_shared<ThreadTaskRunner>("RNOH_JS"),
+            std::make_shared<ThreadTaskRunner>("RNOH_BACKGROUND")} {}
+
+  void runTask(TaskThread thread, Task&& task) {
+    m_taskRunners[thread]->runAsyncTask(std::move(task));
+  }
+
+  void runSyncTask(TaskThread thread, Task&& task) {
+    m_taskRunners[thread]->runSyncTask(std::move(task));
+  }
+
+  bool isOnTaskThread(TaskThread thread) const {
+    return m_taskRunners[thread]->isOnCurrentThread();
+  }
+
+  std::optional<TaskThread> getCurrentTaskThread() const {
+    for (auto thread :
+         {TaskThread::MAIN, TaskThread::JS, TaskThread::BACKGROUND}) {
+      if (isOnTaskThread(thread)) {
+        return thread;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void setExceptionHandler(ExceptionHandler handler) {
+    for (auto& taskRunner : m_taskRunners) {
+      taskRunner->setExceptionHandler(handler);
+    }
+  }
+
+ private:
+  std::array<std::shared_ptr<AbstractTaskRunner>, TaskThread::BACKGROUND + 1>
+      m_taskRunners;
+};
+
+} // namespace rnoh
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+/**
+ * Host replacement of hilog. Messages are formatted and written to
+ * /dev/null, so that units logging through hilog can be benchmarked without
+ * the cost of a terminal. Only `%{public}s` format strings are supported,
+ * which is what RNOH uses.
+ */
+
+typedef enum { LOG_APP = 0 } LogType;
+
+typedef enum {
+  LOG_DEBUG = 3,
+  LOG_INFO = 4,
+  LOG_WARN = 5,
+  LOG_ERROR = 6,
+  LOG_FATAL = 7,
+} LogLevel;
+
+inline bool OH_LOG_IsLoggable(unsigned int, const char*, LogLevel) {
+  return true;
+}
+
+inline int OH_LOG_Print(
+    LogType,
+    LogLevel,
+    unsigned int,
+    const char*,
+    const char* fmt,
+    ...) {
+  static int fd = open("/dev/null", O_WRONLY);
+  va_list args;
+  // the only argument is the `%{public}s` string
+  va_start(args, fmt);
+  char text[4096];
+  auto length = std::vsnprintf(text, sizeof(text), "%s", args);
+  va_end(args);
+  if (length < 0) {
+    return length;
+  }
+  return write(fd, text, std::min(static_cast<size_t>(length), sizeof(text)));
+}
+
+#define OH_LOG_INFO(type, ...) \
+  OH_LOG_Print((type), LOG_INFO, LOG_DOMAIN, LOG_TAG, __VA_ARGS__)
+#define OH_LOG_WARN(type, ...) \
+  OH_LOG_Print((type), LOG_WARN, LOG_DOMAIN, LOG_TAG, __VA_ARGS__)
+#define OH_LOG_ERROR(type, ...) \
+  OH_LOG_Print((type), LOG_ERROR, LOG_DOMAIN, LOG_TAG, __VA_ARGS__)
+#define OH_LOG_FATAL(type, ...) \
+  OH_LOG_Print((type), LOG_FATAL, LOG_DOMAIN, LOG_TAG, __VA_ARGS__)
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+// Replaces folly/Hash.h when folly isn't checked out. React Native graphics
+// headers, e.g. Rect.h, use only `hash_combine` to implement std::hash.
+
+namespace folly {
+namespace hash {
+
+inline size_t hash_combine(size_t seed) {
+  return seed;
+}
+
+template <typename T, typename... Ts>
+size_t hash_combine(size_t seed, T const& value, Ts const&... values) {
+  seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  return hash_combine(seed, values...);
+}
+
+} // namespace hash
+} // namespace folly
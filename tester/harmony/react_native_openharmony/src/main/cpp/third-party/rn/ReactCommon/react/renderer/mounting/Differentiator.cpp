@@ -13,6 +13,8 @@
 #include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/debug/SystraceSection.h>
 #include <algorithm>
+#include <optional>
+#include <vector>
 #include "ShadowView.h"
 
 #ifdef DEBUG_LOGS_DIFFER
@@ -172,6 +174,12 @@ class TinyMap final {
   size_t erasedAtFront_{0};
 };
 
+// RNOH patch: lists of child pairs live only while diffing, so they are
+// allocated from the arena of the diff, see DifferentiatorArena.h.
+using ShadowViewNodePairArenaList = std::vector<
+    ShadowViewNodePair *,
+    DifferentiatorArenaAllocator<ShadowViewNodePair *>>;
+
 /*
  * Sorting comparator for `reorderInPlaceIfNeeded`.
  */
@@ -185,7 +193,7 @@ static bool shouldFirstPairComesBeforeSecondOne(
  * Reorders pairs in-place based on `orderIndex` using a stable sort algorithm.
  */
 static void reorderInPlaceIfNeeded(
-    ShadowViewNodePair::NonOwningList &pairs) noexcept {
+    ShadowViewNodePairArenaList &pairs) noexcept {
   if (pairs.size() < 2) {
     return;
   }
@@ -211,7 +219,7 @@ static inline bool shadowNodeIsConcrete(ShadowNode const &shadowNode) {
 }
 
 static void sliceChildShadowNodeViewPairsRecursivelyV2(
-    ShadowViewNodePair::NonOwningList &pairList,
+    ShadowViewNodePairArenaList &pairList,
     ViewNodePairScope &scope,
     Point layoutOffset,
     ShadowNode const &shadowNode) {
@@ -258,12 +266,13 @@ static void sliceChildShadowNodeViewPairsRecursivelyV2(
   }
 }
 
-ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
+static ShadowViewNodePairArenaList
+sliceChildShadowNodeViewPairsIntoArena(
     ShadowNode const &shadowNode,
     ViewNodePairScope &scope,
-    bool allowFlattened,
-    Point layoutOffset) {
-  auto pairList = ShadowViewNodePair::NonOwningList{};
+    bool allowFlattened = false,
+    Point layoutOffset = {0, 0}) {
+  auto pairList = ShadowViewNodePairArenaList{};
 
   if (!shadowNode.getTraits().check(
           ShadowNodeTraits::Trait::FormsStackingContext) &&
@@ -287,17 +296,27 @@ ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
   return pairList;
 }
 
+ShadowViewNodePair::NonOwningList sliceChildShadowNodeViewPairsV2(
+    ShadowNode const &shadowNode,
+    ViewNodePairScope &scope,
+    bool allowFlattened,
+    Point layoutOffset) {
+  auto pairList = sliceChildShadowNodeViewPairsIntoArena(
+      shadowNode, scope, allowFlattened, layoutOffset);
+  return ShadowViewNodePair::NonOwningList(pairList.begin(), pairList.end());
+}
+
 /**
  * Prefer calling this over `sliceChildShadowNodeViewPairsV2` directly, when
  * possible. This can account for adding parent LayoutMetrics that are
  * important to take into account, but tricky, in (un)flattening cases.
  */
-static ShadowViewNodePair::NonOwningList
+static ShadowViewNodePairArenaList
 sliceChildShadowNodeViewPairsFromViewNodePair(
     ShadowViewNodePair const &shadowViewNodePair,
     ViewNodePairScope &scope,
     bool allowFlattened = false) {
-  return sliceChildShadowNodeViewPairsV2(
+  return sliceChildShadowNodeViewPairsIntoArena(
       *shadowViewNodePair.shadowNode,
       scope,
       allowFlattened,
@@ -334,29 +353,34 @@ static_assert(
     std::is_move_assignable<ShadowViewNodePair::NonOwningList>::value,
     "`ShadowViewNodePair::NonOwningList` must be `move assignable`.");
 
+// RNOH patch: intermediate lists are allocated from the arena of the diff.
+using ShadowViewMutationArenaList = std::vector<
+    ShadowViewMutation,
+    DifferentiatorArenaAllocator<ShadowViewMutation>>;
+
 static void calculateShadowViewMutationsV2(
     ViewNodePairScope &scope,
-    ShadowViewMutation::List &mutations,
+    ShadowViewMutationArenaList &mutations,
     ShadowView const &parentShadowView,
-    ShadowViewNodePair::NonOwningList &&oldChildPairs,
-    ShadowViewNodePair::NonOwningList &&newChildPairs,
+    ShadowViewNodePairArenaList &&oldChildPairs,
+    ShadowViewNodePairArenaList &&newChildPairs,
     bool isRecursionRedundant = false);
 
 struct OrderedMutationInstructionContainer {
-  ShadowViewMutation::List createMutations{};
-  ShadowViewMutation::List deleteMutations{};
-  ShadowViewMutation::List insertMutations{};
-  ShadowViewMutation::List removeMutations{};
-  ShadowViewMutation::List updateMutations{};
-  ShadowViewMutation::List downwardMutations{};
-  ShadowViewMutation::List destructiveDownwardMutations{};
+  ShadowViewMutationArenaList createMutations{};
+  ShadowViewMutationArenaList deleteMutations{};
+  ShadowViewMutationArenaList insertMutations{};
+  ShadowViewMutationArenaList removeMutations{};
+  ShadowViewMutationArenaList updateMutations{};
+  ShadowViewMutationArenaList downwardMutations{};
+  ShadowViewMutationArenaList destructiveDownwardMutations{};
 };
 
 static void updateMatchedPairSubtrees(
     ViewNodePairScope &scope,
     OrderedMutationInstructionContainer &mutationContainer,
     TinyMap<Tag, ShadowViewNodePair *> &newRemainingPairs,
-    ShadowViewNodePair::NonOwningList &oldChildPairs,
+    ShadowViewNodePairArenaList &oldChildPairs,
     ShadowView const &parentShadowView,
     ShadowViewNodePair const &oldPair,
     ShadowViewNodePair const &newPair);
@@ -392,7 +416,7 @@ static void updateMatchedPairSubtrees(
     ViewNodePairScope &scope,
     OrderedMutationInstructionContainer &mutationContainer,
     TinyMap<Tag, ShadowViewNodePair *> &newRemainingPairs,
-    ShadowViewNodePair::NonOwningList &oldChildPairs,
+    ShadowViewNodePairArenaList &oldChildPairs,
     ShadowView const &parentShadowView,
     ShadowViewNodePair const &oldPair,
     ShadowViewNodePair const &newPair) {
@@ -617,7 +641,7 @@ static void calculateShadowViewMutationsFlattener(
   });
 
   // Step 1: iterate through entire tree
-  ShadowViewNodePair::NonOwningList treeChildren =
+  ShadowViewNodePairArenaList treeChildren =
       sliceChildShadowNodeViewPairsFromViewNodePair(node, scope);
 
   DEBUG_LOGS({
@@ -1030,16 +1054,20 @@ static void calculateShadowViewMutationsFlattener(
 
 static void calculateShadowViewMutationsV2(
     ViewNodePairScope &scope,
-    ShadowViewMutation::List &mutations,
+    ShadowViewMutationArenaList &mutations,
     ShadowView const &parentShadowView,
-    ShadowViewNodePair::NonOwningList &&oldChildPairs,
-    ShadowViewNodePair::NonOwningList &&newChildPairs,
+    ShadowViewNodePairArenaList &&oldChildPairs,
+    ShadowViewNodePairArenaList &&newChildPairs,
     bool isRecursionRedundant) {
   SystraceSection s("Differentiator::calculateShadowViewMutationsV2");
   if (oldChildPairs.empty() && newChildPairs.empty()) {
     return;
   }
 
+  // RNOH patch: releases what this level allocates, see
+  // DifferentiatorArena::Frame.
+  DifferentiatorArena::Frame frame{};
+
   size_t index = 0;
 
   // Lists of mutations
@@ -1603,36 +1631,295 @@ ShadowViewNodePair::OwningList sliceChildShadowNodeViewPairsLegacy(
   return pairList;
 }
 
+// RNOH patch: incremental diffing.
+//
+// A commit usually clones only the nodes on the paths to the changed ones,
+// e.g. after a state update of a single view. `calculateShadowViewMutationsV2`
+// still slices the children of every cloned node, including all of their
+// flattened descendants, which makes a small update as expensive as the size
+// of the tree around it. When the children of a node keep their structure,
+// the regular algorithm only emits updates and recurses into changed
+// subtrees, so the same mutations can be collected by visiting the cloned
+// nodes only. Otherwise it falls back to the regular algorithm.
+
+struct IncrementalChildPair {
+  ShadowView oldShadowView;
+  ShadowView newShadowView;
+  ShadowNode const *oldShadowNode;
+  ShadowNode const *newShadowNode;
+  bool flattened;
+  bool isConcreteView;
+};
+
+static inline bool shadowNodeIsHidden(ShadowNode const &shadowNode) {
+#ifndef ANDROID
+  return shadowNode.getTraits().check(ShadowNodeTraits::Trait::Hidden);
+#else
+  return false;
+#endif
+}
+
+static inline bool shadowNodeFormsStackingContext(
+    ShadowNode const &shadowNode) {
+  return shadowNode.getTraits().check(
+      ShadowNodeTraits::Trait::FormsStackingContext);
+}
+
+static inline bool shadowNodeHasVisibleChildren(ShadowNode const &shadowNode) {
+  for (auto const &childShadowNode : shadowNode.getChildren()) {
+    if (!shadowNodeIsHidden(*childShadowNode)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static ShadowView shadowViewWithLayoutOffset(
+    ShadowNode const &shadowNode,
+    Point layoutOffset,
+    Point &origin) {
+  auto shadowView = ShadowView(shadowNode);
+  origin = layoutOffset;
+  if (shadowView.layoutMetrics != EmptyLayoutMetrics) {
+    origin += shadowView.layoutMetrics.frame.origin;
+    shadowView.layoutMetrics.frame.origin += layoutOffset;
+  }
+  return shadowView;
+}
+
+/*
+ * Returns true if the node, or a node flattened into the same layer as it,
+ * has an order index. `reorderInPlaceIfNeeded` then sorts the whole layer,
+ * which could move pairs around even if the node itself didn't change.
+ */
+static bool layerUsesOrderIndex(ShadowNode const &shadowNode) {
+  if (shadowNodeIsHidden(shadowNode)) {
+    return false;
+  }
+  if (shadowNode.getOrderIndex() != 0) {
+    return true;
+  }
+  if (shadowNodeFormsStackingContext(shadowNode)) {
+    return false;
+  }
+  for (auto const &childShadowNode : shadowNode.getChildren()) {
+    if (layerUsesOrderIndex(*childShadowNode)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*
+ * Walks the children the same way as `sliceChildShadowNodeViewPairsV2`, but
+ * skips the ones shared by both trees at the same position, since they can't
+ * produce any mutations. Returns false if the regular algorithm would do
+ * anything besides matching the children by index.
+ */
+static bool collectChangedChildPairs(
+    std::vector<
+        IncrementalChildPair,
+        DifferentiatorArenaAllocator<IncrementalChildPair>> &pairs,
+    ShadowNode const &oldShadowNode,
+    ShadowNode const &newShadowNode,
+    Point oldLayoutOffset,
+    Point newLayoutOffset) {
+  auto const &oldChildren = oldShadowNode.getChildren();
+  auto const &newChildren = newShadowNode.getChildren();
+  if (oldChildren.size() != newChildren.size()) {
+    return false;
+  }
+
+  for (size_t index = 0; index < oldChildren.size(); index++) {
+    auto const &oldChildShadowNode = *oldChildren[index];
+    auto const &newChildShadowNode = *newChildren[index];
+    if (&oldChildShadowNode == &newChildShadowNode &&
+        oldLayoutOffset == newLayoutOffset) {
+      if (layerUsesOrderIndex(oldChildShadowNode)) {
+        return false;
+      }
+      continue;
+    }
+
+    if (oldChildShadowNode.getTag() != newChildShadowNode.getTag()) {
+      return false;
+    }
+
+    auto isHidden = shadowNodeIsHidden(oldChildShadowNode);
+    if (isHidden != shadowNodeIsHidden(newChildShadowNode)) {
+      return false;
+    }
+    if (isHidden) {
+      continue;
+    }
+
+    // Reordering could move the pair to a different index.
+    if (oldChildShadowNode.getOrderIndex() != 0 ||
+        newChildShadowNode.getOrderIndex() != 0) {
+      return false;
+    }
+
+    auto flattened = !shadowNodeFormsStackingContext(oldChildShadowNode);
+    auto isConcreteView = shadowNodeIsConcrete(oldChildShadowNode);
+    if (flattened != !shadowNodeFormsStackingContext(newChildShadowNode) ||
+        isConcreteView != shadowNodeIsConcrete(newChildShadowNode)) {
+      return false;
+    }
+
+    Point oldOrigin;
+    Point newOrigin;
+    pairs.push_back(
+        {shadowViewWithLayoutOffset(
+             oldChildShadowNode, oldLayoutOffset, oldOrigin),
+         shadowViewWithLayoutOffset(
+             newChildShadowNode, newLayoutOffset, newOrigin),
+         &oldChildShadowNode,
+         &newChildShadowNode,
+         flattened,
+         isConcreteView});
+
+    if (flattened &&
+        !collectChangedChildPairs(
+            pairs,
+            oldChildShadowNode,
+            newChildShadowNode,
+            oldOrigin,
+            newOrigin)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void calculateSubtreeShadowViewMutations(
+    ShadowViewMutationArenaList &mutations,
+    ShadowView const &parentShadowView,
+    ShadowNode const &oldShadowNode,
+    ShadowNode const &newShadowNode,
+    bool enableIncrementalDiffing);
+
+/*
+ * Emits the same mutations as `calculateShadowViewMutationsV2` for the
+ * children of both nodes, or returns false without emitting any.
+ */
+static bool calculateShadowViewMutationsIncrementally(
+    ShadowViewMutationArenaList &mutations,
+    ShadowView const &parentShadowView,
+    ShadowNode const &oldShadowNode,
+    ShadowNode const &newShadowNode) {
+  SystraceSection s(
+      "Differentiator::calculateShadowViewMutationsIncrementally");
+  // Mirrors the check in `sliceChildShadowNodeViewPairsV2`.
+  if (!shadowNodeFormsStackingContext(oldShadowNode) ||
+      !shadowNodeFormsStackingContext(newShadowNode)) {
+    return false;
+  }
+
+  DifferentiatorArena::Frame frame{};
+  auto pairs = std::vector<
+      IncrementalChildPair,
+      DifferentiatorArenaAllocator<IncrementalChildPair>>{};
+  if (!collectChangedChildPairs(
+          pairs, oldShadowNode, newShadowNode, {0, 0}, {0, 0})) {
+    return false;
+  }
+
+  auto mutationContainer = OrderedMutationInstructionContainer{};
+  for (auto const &pair : pairs) {
+    if (pair.isConcreteView && pair.oldShadowView != pair.newShadowView) {
+      mutationContainer.updateMutations.push_back(
+          ShadowViewMutation::UpdateMutation(
+              pair.oldShadowView, pair.newShadowView, parentShadowView));
+    }
+
+    if (!pair.flattened && pair.oldShadowNode != pair.newShadowNode) {
+      calculateSubtreeShadowViewMutations(
+          shadowNodeHasVisibleChildren(*pair.newShadowNode)
+              ? mutationContainer.downwardMutations
+              : mutationContainer.destructiveDownwardMutations,
+          pair.oldShadowView,
+          *pair.oldShadowNode,
+          *pair.newShadowNode,
+          true);
+    }
+  }
+
+  for (auto *list :
+       {&mutationContainer.destructiveDownwardMutations,
+        &mutationContainer.updateMutations,
+        &mutationContainer.downwardMutations}) {
+    std::move(list->begin(), list->end(), std::back_inserter(mutations));
+  }
+  return true;
+}
+
+static void calculateSubtreeShadowViewMutations(
+    ShadowViewMutationArenaList &mutations,
+    ShadowView const &parentShadowView,
+    ShadowNode const &oldShadowNode,
+    ShadowNode const &newShadowNode,
+    bool enableIncrementalDiffing) {
+  if (enableIncrementalDiffing &&
+      calculateShadowViewMutationsIncrementally(
+          mutations, parentShadowView, oldShadowNode, newShadowNode)) {
+    return;
+  }
+
+  // See explanation of scope in Differentiator.h.
+  ViewNodePairScope viewNodePairScope{};
+  ViewNodePairScope innerViewNodePairScope{};
+  calculateShadowViewMutationsV2(
+      innerViewNodePairScope,
+      mutations,
+      parentShadowView,
+      sliceChildShadowNodeViewPairsIntoArena(oldShadowNode, viewNodePairScope),
+      sliceChildShadowNodeViewPairsIntoArena(newShadowNode, viewNodePairScope));
+}
+
 ShadowViewMutation::List calculateShadowViewMutations(
     ShadowNode const &oldRootShadowNode,
-    ShadowNode const &newRootShadowNode) {
+    ShadowNode const &newRootShadowNode,
+    bool enableIncrementalDiffing) {
   SystraceSection s("calculateShadowViewMutations");
 
   // Root shadow nodes must be belong the same family.
   react_native_assert(
       ShadowNode::sameFamily(oldRootShadowNode, newRootShadowNode));
 
-  // See explanation of scope in Differentiator.h.
-  ViewNodePairScope viewNodePairScope{};
-  ViewNodePairScope innerViewNodePairScope{};
-
-  auto mutations = ShadowViewMutation::List{};
-  mutations.reserve(256);
+  // RNOH patch: temporary structures are allocated from an arena, and each
+  // level of the diff releases its own when it returns. Only the returned
+  // list is allocated on the heap, with its final size. The arena of the
+  // caller is used if there is one, e.g. to measure the memory used.
+  std::optional<DifferentiatorArena> arena;
+  if (DifferentiatorArena::getCurrent() == nullptr) {
+    arena.emplace();
+  }
+  DifferentiatorArena::Frame frame{};
+  auto subtreeMutations = ShadowViewMutationArenaList{};
+  subtreeMutations.reserve(256);
 
   auto oldRootShadowView = ShadowView(oldRootShadowNode);
   auto newRootShadowView = ShadowView(newRootShadowNode);
 
+  calculateSubtreeShadowViewMutations(
+      subtreeMutations,
+      oldRootShadowView,
+      oldRootShadowNode,
+      newRootShadowNode,
+      enableIncrementalDiffing);
+
+  auto mutations = ShadowViewMutation::List{};
+  mutations.reserve(subtreeMutations.size() + 1);
+
   if (oldRootShadowView != newRootShadowView) {
     mutations.push_back(ShadowViewMutation::UpdateMutation(
         oldRootShadowView, newRootShadowView, {}));
   }
 
-  calculateShadowViewMutationsV2(
-      innerViewNodePairScope,
-      mutations,
-      ShadowView(oldRootShadowNode),
-      sliceChildShadowNodeViewPairsV2(oldRootShadowNode, viewNodePairScope),
-      sliceChildShadowNodeViewPairsV2(newRootShadowNode, viewNodePairScope));
+  std::move(
+      subtreeMutations.begin(),
+      subtreeMutations.end(),
+      std::back_inserter(mutations));
 
   return mutations;
 }
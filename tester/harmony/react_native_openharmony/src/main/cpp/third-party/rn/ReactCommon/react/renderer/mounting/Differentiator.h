@@ -9,6 +9,7 @@
 
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/flags.h>
+#include <react/renderer/mounting/DifferentiatorArena.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <deque>
 
@@ -38,16 +39,25 @@ enum class ReparentMode { Flatten, Unflatten };
  * and (2) tries to efficiently allocate storage such that as many objects as
  * possible are close in memory, but does not guarantee adjacency.
  */
-using ViewNodePairScope = std::deque<ShadowViewNodePair>;
+using ViewNodePairScope = std::deque<
+    ShadowViewNodePair,
+    // RNOH patch: scopes live only while diffing, see DifferentiatorArena.h.
+    DifferentiatorArenaAllocator<ShadowViewNodePair>>;
 
 /*
  * Calculates a list of view mutations which describes how the old
  * `ShadowTree` can be transformed to the new one.
  * The list of mutations might be and might not be optimal.
+ *
+ * RNOH patch: with `enableIncrementalDiffing`, subtrees shared by both trees
+ * are skipped wherever the structure of the children didn't change. The
+ * resulting mutations are the same. Off by default until
+ * ShadowTreeLifeCycleTest, which compares both modes, runs on the host.
  */
 ShadowViewMutation::List calculateShadowViewMutations(
     ShadowNode const &oldRootShadowNode,
-    ShadowNode const &newRootShadowNode);
+    ShadowNode const &newRootShadowNode,
+    bool enableIncrementalDiffing = false);
 
 /**
  * Generates a list of `ShadowViewNodePair`s that represents a layer of a
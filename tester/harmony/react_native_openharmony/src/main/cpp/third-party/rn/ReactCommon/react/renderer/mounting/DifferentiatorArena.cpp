@@ -0,0 +1,142 @@
+// RNOH patch: arena for the temporary structures built by the differ.
+
+#include "DifferentiatorArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace facebook::react {
+
+static thread_local DifferentiatorArena *currentArena = nullptr;
+
+static constexpr size_t InitialBlockSize = 16 * 1024;
+// Limits the memory left unused in the last block.
+static constexpr size_t MaxBlockSize = 4 * 1024 * 1024;
+
+DifferentiatorArena::Stack::Stack(DifferentiatorArena &arena) noexcept
+    : arena_(arena), nextBlockSize_(InitialBlockSize) {}
+
+DifferentiatorArena::Stack::~Stack() noexcept {
+  while (firstBlock_ != nullptr) {
+    auto nextBlock = firstBlock_->next;
+    ::operator delete(firstBlock_);
+    firstBlock_ = nextBlock;
+  }
+}
+
+void *DifferentiatorArena::Stack::allocate(size_t size, size_t alignment) {
+  auto align = [alignment](uintptr_t address) {
+    return (address + alignment - 1) & ~(uintptr_t)(alignment - 1);
+  };
+
+  auto address = align(reinterpret_cast<uintptr_t>(cursor_));
+  if (block_ == nullptr ||
+      address + size > reinterpret_cast<uintptr_t>(end_)) {
+    moveToNextBlock(size + alignment);
+    address = align(reinterpret_cast<uintptr_t>(cursor_));
+  }
+
+  usedBytes_ += address + size - reinterpret_cast<uintptr_t>(cursor_);
+  cursor_ = reinterpret_cast<char *>(address + size);
+  arena_.onUsedBytesChanged();
+  return reinterpret_cast<void *>(address);
+}
+
+void DifferentiatorArena::Stack::moveToNextBlock(size_t minSize) {
+  if (block_ != nullptr) {
+    usedBytes_ += end_ - cursor_;
+  }
+  auto nextBlock = block_ != nullptr ? block_->next : firstBlock_;
+  if (nextBlock == nullptr || nextBlock->size < sizeof(Block) + minSize) {
+    auto blockSize = std::max(nextBlockSize_, sizeof(Block) + minSize);
+    auto newBlock = static_cast<Block *>(::operator new(blockSize));
+    newBlock->next = nextBlock;
+    newBlock->size = blockSize;
+    if (block_ != nullptr) {
+      block_->next = newBlock;
+    } else {
+      firstBlock_ = newBlock;
+    }
+    nextBlock = newBlock;
+    nextBlockSize_ = std::min(nextBlockSize_ * 2, MaxBlockSize);
+    arena_.blocksCount_++;
+  }
+  block_ = nextBlock;
+  cursor_ = reinterpret_cast<char *>(block_ + 1);
+  end_ = reinterpret_cast<char *>(block_) + block_->size;
+}
+
+size_t DifferentiatorArena::Stack::getFramesCount() const noexcept {
+  return framesCount_;
+}
+
+DifferentiatorArena::Stack::Marker DifferentiatorArena::Stack::getMarker()
+    const noexcept {
+  return {block_, cursor_, end_, usedBytes_};
+}
+
+void DifferentiatorArena::Stack::rewind(Marker const &marker) noexcept {
+  block_ = marker.block;
+  cursor_ = marker.cursor;
+  end_ = marker.end;
+  usedBytes_ = marker.usedBytes;
+}
+
+DifferentiatorArena::Frame::Frame() noexcept : arena_(currentArena) {
+  if (arena_ == nullptr) {
+    return;
+  }
+  previousStack_ = arena_->currentStack_;
+  arena_->currentStack_ = previousStack_ == &arena_->firstStack_
+      ? &arena_->secondStack_
+      : &arena_->firstStack_;
+  arena_->currentStack_->framesCount_++;
+  marker_ = arena_->currentStack_->getMarker();
+}
+
+DifferentiatorArena::Frame::~Frame() noexcept {
+  if (arena_ == nullptr) {
+    return;
+  }
+  arena_->currentStack_->rewind(marker_);
+  arena_->currentStack_->framesCount_--;
+  arena_->currentStack_ = previousStack_;
+}
+
+DifferentiatorArena::DifferentiatorArena() noexcept
+    : previousArena_(currentArena),
+      firstStack_(*this),
+      secondStack_(*this),
+      currentStack_(&firstStack_) {
+  currentArena = this;
+}
+
+DifferentiatorArena::~DifferentiatorArena() noexcept {
+  currentArena = previousArena_;
+}
+
+DifferentiatorArena *DifferentiatorArena::getCurrent() noexcept {
+  return currentArena;
+}
+
+DifferentiatorArena::Stack *DifferentiatorArena::getCurrentStack() noexcept {
+  return currentArena != nullptr ? currentArena->currentStack_ : nullptr;
+}
+
+size_t DifferentiatorArena::getBlocksCount() const noexcept {
+  return blocksCount_;
+}
+
+size_t DifferentiatorArena::getUsedBytes() const noexcept {
+  return firstStack_.usedBytes_ + secondStack_.usedBytes_;
+}
+
+size_t DifferentiatorArena::getPeakUsedBytes() const noexcept {
+  return peakUsedBytes_;
+}
+
+void DifferentiatorArena::onUsedBytesChanged() noexcept {
+  peakUsedBytes_ = std::max(peakUsedBytes_, getUsedBytes());
+}
+
+} // namespace facebook::react
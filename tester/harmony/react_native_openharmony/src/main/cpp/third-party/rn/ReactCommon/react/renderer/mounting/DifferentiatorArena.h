@@ -0,0 +1,203 @@
+// RNOH patch: arena for the temporary structures built by the differ.
+
+#pragma once
+
+#include <react/debug/react_native_assert.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Arena that backs the mutation lists, `ViewNodePairScope`s and child pair
+ * lists built while diffing a single commit. Memory is never freed
+ * individually. Each level of the diff opens a `Frame`, which releases the
+ * memory allocated by that level when the level returns, and whatever is
+ * left is released at once when the arena is destroyed.
+ *
+ * An arena becomes the current one of its thread for its lifetime, and
+ * containers created meanwhile allocate from it. Not thread-safe.
+ */
+class DifferentiatorArena final {
+ public:
+  /*
+   * A stack of blocks that memory is bumped from and rewound to a marker.
+   * An arena has two of them, see `Frame`.
+   */
+  class Stack final {
+   public:
+    Stack(Stack const &) = delete;
+    Stack &operator=(Stack const &) = delete;
+
+    void *allocate(size_t size, size_t alignment);
+
+    /*
+     * Number of frames currently open on this stack.
+     */
+    size_t getFramesCount() const noexcept;
+
+   private:
+    friend class DifferentiatorArena;
+
+    struct Block {
+      Block *next;
+      size_t size;
+    };
+
+    struct Marker {
+      Block *block;
+      char *cursor;
+      char *end;
+      size_t usedBytes;
+    };
+
+    explicit Stack(DifferentiatorArena &arena) noexcept;
+    ~Stack() noexcept;
+
+    void moveToNextBlock(size_t minSize);
+    Marker getMarker() const noexcept;
+    void rewind(Marker const &marker) noexcept;
+
+    DifferentiatorArena &arena_;
+    // blocks after the current one are kept for reuse after a rewind
+    Block *firstBlock_{nullptr};
+    Block *block_{nullptr};
+    char *cursor_{nullptr};
+    char *end_{nullptr};
+    size_t usedBytes_{0};
+    size_t nextBlockSize_;
+    size_t framesCount_{0};
+  };
+
+  /*
+   * Opened by each level of the diff. Containers created while the frame is
+   * open allocate from the other stack than the enclosing frame, and that
+   * stack is rewound when the frame closes. So a level can still grow the
+   * mutation lists and scope of its parent, which live on the other stack,
+   * once its own children have returned. Everything a level allocates must
+   * be gone, or moved into containers of enclosing levels, when it returns.
+   *
+   * A container must not grow while a frame opened after it on the same
+   * stack is open, i.e. a level must not append to the lists of its
+   * grandparent while its children are running, since the memory would be
+   * released when the child frame closes. Allocators assert this.
+   *
+   * Does nothing if no arena exists on the current thread.
+   */
+  class Frame final {
+   public:
+    Frame() noexcept;
+    ~Frame() noexcept;
+
+    Frame(Frame const &) = delete;
+    Frame &operator=(Frame const &) = delete;
+
+   private:
+    DifferentiatorArena *arena_;
+    Stack *previousStack_{nullptr};
+    Stack::Marker marker_{};
+  };
+
+  DifferentiatorArena() noexcept;
+  ~DifferentiatorArena() noexcept;
+
+  DifferentiatorArena(DifferentiatorArena const &) = delete;
+  DifferentiatorArena &operator=(DifferentiatorArena const &) = delete;
+
+  /*
+   * Returns nullptr if no arena exists on the current thread.
+   */
+  static DifferentiatorArena *getCurrent() noexcept;
+
+  /*
+   * Stack that containers created now allocate from, or nullptr if no arena
+   * exists on the current thread.
+   */
+  static Stack *getCurrentStack() noexcept;
+
+  /*
+   * Number of blocks requested from the system allocator so far.
+   */
+  size_t getBlocksCount() const noexcept;
+
+  /*
+   * Bytes allocated and not rewound yet, including alignment padding and the
+   * unused ends of blocks that allocations didn't fit in.
+   */
+  size_t getUsedBytes() const noexcept;
+
+  /*
+   * The highest `getUsedBytes()` so far.
+   */
+  size_t getPeakUsedBytes() const noexcept;
+
+ private:
+  void onUsedBytesChanged() noexcept;
+
+  DifferentiatorArena *previousArena_;
+  Stack firstStack_;
+  Stack secondStack_;
+  Stack *currentStack_;
+  size_t blocksCount_{0};
+  size_t peakUsedBytes_{0};
+};
+
+/*
+ * Allocates from the arena stack that was current when the allocator was
+ * created, or from the heap if there was none.
+ */
+template <typename T>
+class DifferentiatorArenaAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  DifferentiatorArenaAllocator() noexcept
+      : stack_(DifferentiatorArena::getCurrentStack()),
+        framesCount_(stack_ != nullptr ? stack_->getFramesCount() : 0) {}
+
+  template <typename U>
+  DifferentiatorArenaAllocator(
+      DifferentiatorArenaAllocator<U> const &other) noexcept
+      : stack_(other.stack_), framesCount_(other.framesCount_) {}
+
+  T *allocate(size_t count) {
+    if (stack_ == nullptr) {
+      return static_cast<T *>(::operator new(count * sizeof(T)));
+    }
+    // a frame opened on the stack after the container was created would
+    // release this memory while the container still uses it
+    react_native_assert(stack_->getFramesCount() == framesCount_);
+    return static_cast<T *>(stack_->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *pointer, size_t /*count*/) noexcept {
+    if (stack_ == nullptr) {
+      ::operator delete(pointer);
+    }
+  }
+
+  template <typename U>
+  bool operator==(DifferentiatorArenaAllocator<U> const &rhs) const noexcept {
+    return stack_ == rhs.stack_;
+  }
+
+  template <typename U>
+  bool operator!=(DifferentiatorArenaAllocator<U> const &rhs) const noexcept {
+    return stack_ != rhs.stack_;
+  }
+
+ private:
+  template <typename U>
+  friend class DifferentiatorArenaAllocator;
+
+  DifferentiatorArena::Stack *stack_;
+  size_t framesCount_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,132 @@
+// RNOH patch: tests of the allocations made by the differ, which uses
+// DifferentiatorArena for its temporary structures.
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/DifferentiatorArena.h>
+#include "AllocationCounter.h"
+
+namespace facebook::react {
+
+static SharedViewProps nonFlattenedProps(
+    ComponentDescriptor const &componentDescriptor) {
+  folly::dynamic dynamic = folly::dynamic::object();
+  dynamic["nativeId"] = "NativeId";
+  dynamic["accessible"] = true;
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  return std::static_pointer_cast<ViewProps const>(
+      componentDescriptor.cloneProps(
+          parserContext, nullptr, RawProps{dynamic}));
+}
+
+/*
+ * Generates a tree of views that aren't flattened, with `branchingFactor`
+ * children on each of `depth` levels.
+ */
+static ShadowNode::Shared generateTree(
+    ComponentDescriptor const &componentDescriptor,
+    SharedViewProps const &props,
+    Tag &nextTag,
+    int branchingFactor,
+    int depth) {
+  auto children = ShadowNode::ListOfShared{};
+  if (depth > 0) {
+    for (int i = 0; i < branchingFactor; i++) {
+      children.push_back(generateTree(
+          componentDescriptor, props, nextTag, branchingFactor, depth - 1));
+    }
+  }
+  return componentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          props, std::make_shared<ShadowNode::ListOfShared>(children)},
+      componentDescriptor.createFamily(
+          {nextTag++, SurfaceId(1), nullptr}, nullptr));
+}
+
+/*
+ * Diffs an empty root against a root with a generated tree, so a Create and
+ * an Insert mutation are emitted for each view.
+ */
+static ShadowViewMutation::List diffGeneratedTree(
+    int branchingFactor,
+    int depth,
+    size_t *allocationsCount = nullptr) {
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters =
+      ComponentDescriptorParameters{eventDispatcher, contextContainer, nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  auto rootFamily = rootComponentDescriptor.createFamily(
+      {Tag(1), SurfaceId(1), nullptr}, nullptr);
+  auto emptyRootNode = rootComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{RootShadowNode::defaultSharedProps()}, rootFamily);
+
+  auto nextTag = Tag(2);
+  auto tree = generateTree(
+      viewComponentDescriptor,
+      nonFlattenedProps(viewComponentDescriptor),
+      nextTag,
+      branchingFactor,
+      depth);
+  auto rootNode = emptyRootNode->clone(ShadowNodeFragment{
+      ShadowNodeFragment::propsPlaceholder(),
+      std::make_shared<ShadowNode::ListOfShared>(
+          ShadowNode::ListOfShared{tree})});
+
+  auto allocationsCountBefore = getAllocationsCount();
+  auto mutations = calculateShadowViewMutations(*emptyRootNode, *rootNode);
+  if (allocationsCount != nullptr) {
+    *allocationsCount = getAllocationsCount() - allocationsCountBefore;
+  }
+  return mutations;
+}
+
+} // namespace facebook::react
+
+using namespace facebook::react;
+
+TEST(DifferentiatorAllocationTest, diffingAllocatesFewTimes) {
+  // Child pair lists allocate from the arena as well, so views with more
+  // children than the inline capacity of a small vector don't allocate.
+  // Besides the arena blocks, the returned list is allocated once.
+  for (auto branchingFactor : {8, 12}) {
+    size_t allocationsCount = 0;
+    auto mutations =
+        diffGeneratedTree(branchingFactor, /* depth */ 3, &allocationsCount);
+
+    // A Create and an Insert mutation for each of the 585 or 1885 views.
+    EXPECT_EQ(mutations.size(), branchingFactor == 8 ? 1170 : 3770);
+    // Without the arena, every recursion allocates its own mutation lists,
+    // scope and child pair lists, i.e. more than a thousand allocations.
+    EXPECT_LT(allocationsCount, mutations.size() / 20);
+  }
+}
+
+TEST(DifferentiatorAllocationTest, diffingReleasesMemoryOfEachLevel) {
+  DifferentiatorArena arena{};
+
+  // 1023 views on 10 levels.
+  auto mutations = diffGeneratedTree(/* branchingFactor */ 2, /* depth */ 9);
+
+  EXPECT_EQ(mutations.size(), 2046);
+  EXPECT_EQ(arena.getUsedBytes(), 0);
+  // Every level copies the mutations of its subtree into its parent's lists,
+  // which grow geometrically. If levels kept their lists, the mutations would
+  // be copied 10 times, taking more than 20 times their size.
+  EXPECT_LT(
+      arena.getPeakUsedBytes(),
+      10 * mutations.size() * sizeof(ShadowViewMutation));
+}
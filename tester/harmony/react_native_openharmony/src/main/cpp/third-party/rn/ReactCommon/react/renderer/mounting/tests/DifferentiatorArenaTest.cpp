@@ -0,0 +1,155 @@
+// RNOH patch: tests of the arena used by the differ. They don't depend on the
+// rest of the renderer, so they run in the host tests of RNOH, see
+// tests/CMakeLists.txt in the RNOH cpp directory.
+
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/mounting/DifferentiatorArena.h>
+#include "AllocationCounter.h"
+
+using namespace facebook::react;
+
+using Values = std::vector<uint64_t, DifferentiatorArenaAllocator<uint64_t>>;
+
+/*
+ * Mimics a level of the diff: opens a frame, builds its own list from the
+ * lists of its children and appends it to the list of its parent.
+ */
+static void appendSubtreeValues(Values &parentValues, int depth) {
+  DifferentiatorArena::Frame frame{};
+  auto values = Values{};
+  for (int i = 0; i < 2 && depth > 0; i++) {
+    appendSubtreeValues(values, depth - 1);
+  }
+  values.push_back(depth);
+  std::move(values.begin(), values.end(), std::back_inserter(parentValues));
+}
+
+TEST(DifferentiatorArenaTest, containersAllocateFromCurrentArena) {
+  DifferentiatorArena arena{};
+  EXPECT_EQ(DifferentiatorArena::getCurrent(), &arena);
+
+  auto values = Values{};
+  auto deque =
+      std::deque<uint64_t, DifferentiatorArenaAllocator<uint64_t>>{};
+  for (int i = 0; i < 1000; i++) {
+    values.push_back(i);
+    deque.push_back(i);
+  }
+
+  EXPECT_EQ(values.size(), 1000);
+  EXPECT_EQ(deque.size(), 1000);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % alignof(uint64_t), 0);
+  EXPECT_LT(arena.getBlocksCount(), 10);
+}
+
+TEST(DifferentiatorArenaTest, nestedArenaRestoresPreviousOne) {
+  EXPECT_EQ(DifferentiatorArena::getCurrent(), nullptr);
+  {
+    DifferentiatorArena arena{};
+    {
+      DifferentiatorArena nestedArena{};
+      EXPECT_EQ(DifferentiatorArena::getCurrent(), &nestedArena);
+    }
+    EXPECT_EQ(DifferentiatorArena::getCurrent(), &arena);
+  }
+  EXPECT_EQ(DifferentiatorArena::getCurrent(), nullptr);
+}
+
+TEST(DifferentiatorArenaTest, containersWithoutArenaUseHeap) {
+  auto values = Values{};
+  values.reserve(8);
+
+  auto allocationsCount = getAllocationsCount();
+  values.reserve(1024);
+
+  EXPECT_EQ(getAllocationsCount() - allocationsCount, 1);
+}
+
+TEST(DifferentiatorArenaTest, frameReleasesMemoryWhenClosed) {
+  DifferentiatorArena arena{};
+  auto usedBytes = arena.getUsedBytes();
+
+  size_t blocksCount = 0;
+  for (int i = 0; i < 2; i++) {
+    {
+      DifferentiatorArena::Frame frame{};
+      auto values = Values{};
+      for (int j = 0; j < 10000; j++) {
+        values.push_back(j);
+      }
+      EXPECT_GT(arena.getUsedBytes(), usedBytes);
+    }
+    EXPECT_EQ(arena.getUsedBytes(), usedBytes);
+    if (i == 0) {
+      blocksCount = arena.getBlocksCount();
+    }
+  }
+
+  // The second frame reuses the blocks of the first one.
+  EXPECT_EQ(arena.getBlocksCount(), blocksCount);
+  EXPECT_GE(arena.getPeakUsedBytes(), 10000 * sizeof(uint64_t));
+}
+
+TEST(DifferentiatorArenaTest, enclosingLevelGrowsItsContainersInFrame) {
+  DifferentiatorArena arena{};
+  auto parentValues = Values{};
+
+  {
+    // A level of the diff...
+    DifferentiatorArena::Frame frame{};
+    auto values = Values{};
+    for (int i = 0; i < 1000; i++) {
+      {
+        // ...whose children use the same stack as its parent...
+        DifferentiatorArena::Frame childFrame{};
+        auto childValues = Values(100, 0);
+        values.push_back(i);
+      }
+      // ...so that its parent's containers can grow.
+      parentValues.push_back(i);
+    }
+    std::move(values.begin(), values.end(), std::back_inserter(parentValues));
+  }
+
+  ASSERT_EQ(parentValues.size(), 2000);
+  for (int i = 0; i < 2000; i++) {
+    EXPECT_EQ(parentValues[i], i % 1000);
+  }
+}
+
+#ifdef REACT_NATIVE_DEBUG
+TEST(DifferentiatorArenaTest, growingContainerOfGrandparentInFrameAsserts) {
+  EXPECT_DEATH(
+      {
+        DifferentiatorArena arena{};
+        auto grandparentValues = Values{};
+        DifferentiatorArena::Frame parentFrame{};
+        // on the same stack as the grandparent's containers
+        DifferentiatorArena::Frame childFrame{};
+        grandparentValues.push_back(0);
+      },
+      "react_native_assert failure");
+}
+#endif
+
+TEST(DifferentiatorArenaTest, recursionAllocatesOnlyArenaBlocks) {
+  DifferentiatorArena arena{};
+  auto values = Values{};
+
+  auto allocationsCount = getAllocationsCount();
+  auto blocksCount = arena.getBlocksCount();
+  // 1023 levels, like a diff of a binary tree of 10 levels.
+  appendSubtreeValues(values, /* depth */ 9);
+
+  EXPECT_EQ(values.size(), 1023);
+  EXPECT_EQ(
+      getAllocationsCount() - allocationsCount,
+      arena.getBlocksCount() - blocksCount);
+  EXPECT_LT(arena.getBlocksCount(), 20);
+}
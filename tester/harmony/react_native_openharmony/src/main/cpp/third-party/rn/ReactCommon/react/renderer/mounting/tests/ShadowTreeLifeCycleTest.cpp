@@ -26,6 +26,32 @@
 
 namespace facebook::react {
 
+// RNOH patch: incremental diffing must produce the same mutations as the
+// regular algorithm.
+static void expectSameMutationsWithoutIncrementalDiffing(
+    ShadowViewMutation::List const &mutations,
+    ShadowNode const &oldRootShadowNode,
+    ShadowNode const &newRootShadowNode) {
+  auto expectedMutations = calculateShadowViewMutations(
+      oldRootShadowNode,
+      newRootShadowNode,
+      /* enableIncrementalDiffing */ false);
+  ASSERT_EQ(mutations.size(), expectedMutations.size());
+  for (size_t i = 0; i < mutations.size(); i++) {
+    auto const &mutation = mutations[i];
+    auto const &expectedMutation = expectedMutations[i];
+    EXPECT_EQ(mutation.type, expectedMutation.type);
+    EXPECT_EQ(mutation.index, expectedMutation.index);
+    EXPECT_EQ(
+        mutation.isRedundantOperation, expectedMutation.isRedundantOperation);
+    EXPECT_EQ(mutation.parentShadowView, expectedMutation.parentShadowView);
+    EXPECT_EQ(
+        mutation.oldChildShadowView, expectedMutation.oldChildShadowView);
+    EXPECT_EQ(
+        mutation.newChildShadowView, expectedMutation.newChildShadowView);
+  }
+}
+
 static void testShadowNodeTreeLifeCycle(
     uint_fast32_t seed,
     int treeSize,
@@ -108,8 +134,12 @@ static void testShadowNodeTreeLifeCycle(
       allNodes.push_back(nextRootNode);
 
       // Calculating mutations.
-      auto mutations =
-          calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+      auto mutations = calculateShadowViewMutations(
+          *currentRootNode,
+          *nextRootNode,
+          /* enableIncrementalDiffing */ true);
+      expectSameMutationsWithoutIncrementalDiffing(
+          mutations, *currentRootNode, *nextRootNode);
 
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
@@ -259,8 +289,12 @@ static void testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
       allNodes.push_back(nextRootNode);
 
       // Calculating mutations.
-      auto mutations =
-          calculateShadowViewMutations(*currentRootNode, *nextRootNode);
+      auto mutations = calculateShadowViewMutations(
+          *currentRootNode,
+          *nextRootNode,
+          /* enableIncrementalDiffing */ true);
+      expectSameMutationsWithoutIncrementalDiffing(
+          mutations, *currentRootNode, *nextRootNode);
 
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
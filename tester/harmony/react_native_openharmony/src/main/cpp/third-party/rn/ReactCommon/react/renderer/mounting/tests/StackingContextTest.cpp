@@ -782,4 +782,50 @@ TEST_F(StackingContextTest, zIndexAndFlattenedNodes) {
   });
 }
 
+// RNOH patch: a shared sibling whose flattened child has an order index
+// makes the differ sort the whole layer, so incremental diffing must not skip
+// it while matching the changed siblings by index.
+TEST_F(StackingContextTest, incrementalDiffingWithReorderedSharedSibling) {
+  mutateViewShadowNodeProps_(nodeAA_, [](ViewProps &props) {
+    auto &yogaStyle = props.yogaStyle;
+    yogaStyle.positionType() = YGPositionTypeRelative;
+    props.zIndex = 42;
+  });
+  mutateViewShadowNodeProps_(
+      nodeBD_, [](ViewProps &props) { props.opacity = 0.42; });
+  testViewTree_([](StubViewTree const &viewTree) {
+    EXPECT_EQ(viewTree.getRootStubView().children.size(), 2);
+    EXPECT_EQ(viewTree.getRootStubView().children.at(0)->tag, 10);
+    EXPECT_EQ(viewTree.getRootStubView().children.at(1)->tag, 3);
+  });
+
+  // only BD changes, A and its child AA are shared by both revisions
+  mutateViewShadowNodeProps_(
+      nodeBD_, [](ViewProps &props) { props.opacity = 0.24; });
+  rootShadowNode_->layoutIfNeeded();
+
+  auto mutations = calculateShadowViewMutations(
+      *currentRootShadowNode_,
+      *rootShadowNode_,
+      /* enableIncrementalDiffing */ true);
+  auto expectedMutations = calculateShadowViewMutations(
+      *currentRootShadowNode_,
+      *rootShadowNode_,
+      /* enableIncrementalDiffing */ false);
+  ASSERT_EQ(mutations.size(), expectedMutations.size());
+  for (size_t i = 0; i < mutations.size(); i++) {
+    EXPECT_EQ(mutations[i].type, expectedMutations[i].type);
+    EXPECT_EQ(mutations[i].index, expectedMutations[i].index);
+    EXPECT_EQ(
+        mutations[i].newChildShadowView,
+        expectedMutations[i].newChildShadowView);
+  }
+
+  testViewTree_([](StubViewTree const &viewTree) {
+    EXPECT_EQ(viewTree.getRootStubView().children.size(), 2);
+    EXPECT_EQ(viewTree.getRootStubView().children.at(0)->tag, 10);
+    EXPECT_EQ(viewTree.getRootStubView().children.at(1)->tag, 3);
+  });
+}
+
 } // namespace facebook::react
@@ -0,0 +1,142 @@
+// RNOH patch: benchmarks of the differ on trees of about 10k views.
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook::react {
+
+// 1 + 10 + 100 + 1000 + 10000 views
+static constexpr int BRANCHING_FACTOR = 10;
+static constexpr int DEPTH = 4;
+
+static SharedViewProps nonFlattenedProps(
+    ComponentDescriptor const &componentDescriptor,
+    std::string const &nativeId) {
+  folly::dynamic dynamic = folly::dynamic::object();
+  dynamic["nativeId"] = nativeId;
+  dynamic["accessible"] = true;
+
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+
+  return std::static_pointer_cast<ViewProps const>(
+      componentDescriptor.cloneProps(
+          parserContext, nullptr, RawProps{dynamic}));
+}
+
+static ShadowNode::Shared generateTree(
+    ComponentDescriptor const &componentDescriptor,
+    SharedViewProps const &props,
+    Tag &nextTag,
+    int branchingFactor,
+    int depth) {
+  auto children = ShadowNode::ListOfShared{};
+  if (depth > 0) {
+    for (int i = 0; i < branchingFactor; i++) {
+      children.push_back(generateTree(
+          componentDescriptor, props, nextTag, branchingFactor, depth - 1));
+    }
+  }
+  return componentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          props, std::make_shared<ShadowNode::ListOfShared>(children)},
+      componentDescriptor.createFamily(
+          {nextTag++, SurfaceId(1), nullptr}, nullptr));
+}
+
+/*
+ * An empty root, a root with the generated tree and a revision of the latter
+ * in which the props of a single leaf changed, like after a state update.
+ */
+struct DifferentiatorBenchmarkTrees {
+  ShadowNode::Shared emptyRootNode;
+  ShadowNode::Shared rootNode;
+  ShadowNode::Shared rootNodeWithChangedLeaf;
+};
+
+static DifferentiatorBenchmarkTrees const &getTrees() {
+  // shadow node families keep references to the descriptors
+  static auto const componentDescriptorParameters =
+      ComponentDescriptorParameters{
+          EventDispatcher::Shared{},
+          std::make_shared<ContextContainer>(),
+          nullptr};
+  static auto const viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  static auto const rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  static auto const trees = [] {
+    auto rootFamily = rootComponentDescriptor.createFamily(
+        {Tag(1), SurfaceId(1), nullptr}, nullptr);
+    auto emptyRootNode = rootComponentDescriptor.createShadowNode(
+        ShadowNodeFragment{RootShadowNode::defaultSharedProps()}, rootFamily);
+
+    auto nextTag = Tag(2);
+    auto tree = generateTree(
+        viewComponentDescriptor,
+        nonFlattenedProps(viewComponentDescriptor, "NativeId"),
+        nextTag,
+        BRANCHING_FACTOR,
+        DEPTH);
+    ShadowNode::Shared rootNode = emptyRootNode->clone(ShadowNodeFragment{
+        ShadowNodeFragment::propsPlaceholder(),
+        std::make_shared<ShadowNode::ListOfShared>(
+            ShadowNode::ListOfShared{tree})});
+
+    auto leaf = tree;
+    while (!leaf->getChildren().empty()) {
+      leaf = leaf->getChildren().back();
+    }
+    auto changedLeafProps =
+        nonFlattenedProps(viewComponentDescriptor, "ChangedNativeId");
+    ShadowNode::Shared rootNodeWithChangedLeaf = rootNode->cloneTree(
+        leaf->getFamily(), [&](ShadowNode const &oldShadowNode) {
+          return oldShadowNode.clone(ShadowNodeFragment{changedLeafProps});
+        });
+
+    return DifferentiatorBenchmarkTrees{
+        emptyRootNode, rootNode, rootNodeWithChangedLeaf};
+  }();
+  return trees;
+}
+
+/*
+ * The argument enables incremental diffing.
+ */
+static void diffTreeWithChangedLeaf(benchmark::State &state) {
+  auto const &trees = getTrees();
+  auto enableIncrementalDiffing = state.range(0) != 0;
+  for (auto _ : state) {
+    auto mutations = calculateShadowViewMutations(
+        *trees.rootNode,
+        *trees.rootNodeWithChangedLeaf,
+        enableIncrementalDiffing);
+    benchmark::DoNotOptimize(mutations);
+  }
+}
+BENCHMARK(diffTreeWithChangedLeaf)->Arg(0)->Arg(1);
+
+static void diffInitialTree(benchmark::State &state) {
+  auto const &trees = getTrees();
+  auto enableIncrementalDiffing = state.range(0) != 0;
+  for (auto _ : state) {
+    auto mutations = calculateShadowViewMutations(
+        *trees.emptyRootNode, *trees.rootNode, enableIncrementalDiffing);
+    benchmark::DoNotOptimize(mutations);
+  }
+}
+BENCHMARK(diffInitialTree)->Arg(0)->Arg(1);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
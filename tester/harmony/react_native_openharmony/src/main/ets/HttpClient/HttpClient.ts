@@ -14,7 +14,12 @@ export interface HttpClient {
 
   addRequestInterceptor(interceptor: RequestInterceptor)
 
-  sendRequest(url: string, requestOptions: RequestOptions, onProgress?: (partialProgress: PartialProgress) => void): {
+  /**
+   * If `shouldCollectBody` is false, the body is only passed to `onProgress` chunk by chunk, and the response has an
+   * empty body.
+   */
+  sendRequest(url: string, requestOptions: RequestOptions, onProgress?: (partialProgress: PartialProgress) => void,
+    shouldCollectBody?: boolean): {
     cancel: CancelRequestCallback,
     promise: Promise<HttpResponse>
   },
@@ -65,7 +70,8 @@ export class DefaultHttpClient implements HttpClient {
   }
 
 
-  sendRequest(url: string, requestOptions: RequestOptions, onProgress?: (partialProgress: PartialProgress) => void): {
+  sendRequest(url: string, requestOptions: RequestOptions, onProgress?: (partialProgress: PartialProgress) => void,
+    shouldCollectBody: boolean = true): {
     cancel: CancelRequestCallback,
     promise: Promise<HttpResponse>
   } {
@@ -120,7 +126,9 @@ export class DefaultHttpClient implements HttpClient {
       })
 
       httpRequest.on('dataReceive', (chunk) => {
-        dataChunks.push(chunk);
+        if (shouldCollectBody) {
+          dataChunks.push(chunk);
+        }
         currentLength += chunk.byteLength;
         if (onProgress) {
           onProgress({
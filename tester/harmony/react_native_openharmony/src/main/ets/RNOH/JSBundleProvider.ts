@@ -27,6 +27,14 @@ export abstract class JSBundleProvider {
   getHumanFriendlyURL(): string {
     return this.getURL()
   }
+
+  /**
+   * Returns a path to the bundle file if the bundle can be loaded directly from the file system. Such bundles are
+   * loaded on the native side, which allows memory-mapping Hermes bytecode instead of copying it.
+   */
+  async getBundleFilePath(): Promise<string | null> {
+    return null
+  }
 }
 
 
@@ -48,6 +56,14 @@ export class FileJSBundleProvider extends JSBundleProvider {
     return this.appKeys
   }
 
+  async getBundleFilePath(): Promise<string | null> {
+    try {
+      return await fs.access(this.path) ? this.path : null
+    } catch (err) {
+      return null
+    }
+  }
+
   async getBundle(onProgress?: (progress: number) => void): Promise<ArrayBuffer> {
     try {
       const file = await fs.open(this.path, fs.OpenMode.READ_ONLY);
@@ -241,6 +257,16 @@ export class AnyJSBundleProvider extends JSBundleProvider {
     })
   }
 
+  async getBundleFilePath(): Promise<string | null> {
+    // only the first provider is checked, to preserve the order in which providers are tried
+    const jsBundleProvider = this.jsBundleProviders[0]
+    const jsBundleFilePath = await jsBundleProvider.getBundleFilePath()
+    if (jsBundleFilePath !== null) {
+      this.pickedJSBundleProvider = jsBundleProvider
+    }
+    return jsBundleFilePath
+  }
+
   getHotReloadConfig(): HotReloadConfig | null {
     if (this.pickedJSBundleProvider) {
       return this.pickedJSBundleProvider.getHotReloadConfig()
@@ -269,6 +295,10 @@ export class TraceJSBundleProviderDecorator extends JSBundleProvider {
     return result
   }
 
+  async getBundleFilePath(): Promise<string | null> {
+    return this.jsBundleProvider.getBundleFilePath()
+  }
+
   getAppKeys() {
     return this.jsBundleProvider.getAppKeys()
   }
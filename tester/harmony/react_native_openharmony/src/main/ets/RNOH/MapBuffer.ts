@@ -0,0 +1,204 @@
+import util from '@ohos.util';
+
+/**
+ * ArkTS counterpart of `react/renderer/mapbuffer`. Values are stored in a single ArrayBuffer, which is passed through
+ * NAPI without converting objects property by property. The layout must stay in sync with MapBuffer.h:
+ * [header: alignment (u16), count (u16), buffer size (u32)] [buckets sorted by key: key (u16), type (u16),
+ * value (8 bytes)] [dynamic data]. Strings and nested maps are stored in the dynamic data, prefixed with their length.
+ */
+export enum MapBufferDataType {
+  Boolean = 0,
+  Int = 1,
+  Double = 2,
+  String = 3,
+  Map = 4,
+}
+
+const HEADER_ALIGNMENT = 0xFE;
+const HEADER_SIZE = 8;
+const BUCKET_SIZE = 12;
+const BUCKET_VALUE_OFFSET = 4;
+const INT_SIZE = 4;
+
+type Bucket = {
+  key: number,
+  type: MapBufferDataType,
+  value: number,
+}
+
+export class MapBufferBuilder {
+  private buckets: Bucket[] = []
+  private dynamicData: Uint8Array[] = []
+  private dynamicDataSize: number = 0
+
+  putBool(key: number, value: boolean): MapBufferBuilder {
+    this.buckets.push({ key, type: MapBufferDataType.Boolean, value: value ? 1 : 0 })
+    return this
+  }
+
+  putInt(key: number, value: number): MapBufferBuilder {
+    this.buckets.push({ key, type: MapBufferDataType.Int, value })
+    return this
+  }
+
+  putDouble(key: number, value: number): MapBufferBuilder {
+    this.buckets.push({ key, type: MapBufferDataType.Double, value })
+    return this
+  }
+
+  putString(key: number, value: string): MapBufferBuilder {
+    const bytes = new util.TextEncoder().encodeInto(value)
+    this.buckets.push({ key, type: MapBufferDataType.String, value: this.appendDynamicData(bytes) })
+    return this
+  }
+
+  putMapBuffer(key: number, value: ArrayBuffer): MapBufferBuilder {
+    this.buckets.push({ key, type: MapBufferDataType.Map, value: this.appendDynamicData(new Uint8Array(value)) })
+    return this
+  }
+
+  putMapBufferList(key: number, values: ArrayBuffer[]): MapBufferBuilder {
+    const listSize = values.reduce((size, value) => size + INT_SIZE + value.byteLength, 0)
+    const offset = this.appendLength(listSize)
+    for (const value of values) {
+      this.appendDynamicData(new Uint8Array(value))
+    }
+    this.buckets.push({ key, type: MapBufferDataType.Map, value: offset })
+    return this
+  }
+
+  build(): ArrayBuffer {
+    // lookups use binary search, so the buckets must be sorted by their keys
+    this.buckets.sort((a, b) => a.key - b.key)
+    const bucketsEnd = HEADER_SIZE + this.buckets.length * BUCKET_SIZE
+    const buffer = new ArrayBuffer(bucketsEnd + this.dynamicDataSize)
+    const view = new DataView(buffer)
+    view.setUint16(0, HEADER_ALIGNMENT, true)
+    view.setUint16(2, this.buckets.length, true)
+    view.setUint32(4, buffer.byteLength, true)
+    this.buckets.forEach((bucket, index) => {
+      const bucketOffset = HEADER_SIZE + index * BUCKET_SIZE
+      view.setUint16(bucketOffset, bucket.key, true)
+      view.setUint16(bucketOffset + 2, bucket.type, true)
+      if (bucket.type === MapBufferDataType.Double) {
+        view.setFloat64(bucketOffset + BUCKET_VALUE_OFFSET, bucket.value, true)
+      } else {
+        view.setInt32(bucketOffset + BUCKET_VALUE_OFFSET, bucket.value, true)
+      }
+    })
+    const bytes = new Uint8Array(buffer)
+    let offset = bucketsEnd
+    for (const chunk of this.dynamicData) {
+      bytes.set(chunk, offset)
+      offset += chunk.byteLength
+    }
+    return buffer
+  }
+
+  private appendLength(length: number): number {
+    const chunk = new Uint8Array(INT_SIZE)
+    new DataView(chunk.buffer).setInt32(0, length, true)
+    const offset = this.dynamicDataSize
+    this.dynamicData.push(chunk)
+    this.dynamicDataSize += INT_SIZE
+    return offset
+  }
+
+  private appendDynamicData(bytes: Uint8Array): number {
+    const offset = this.appendLength(bytes.byteLength)
+    this.dynamicData.push(bytes)
+    this.dynamicDataSize += bytes.byteLength
+    return offset
+  }
+}
+
+export class MapBuffer {
+  private view: DataView
+  private count: number
+
+  constructor(private buffer: ArrayBuffer, private byteOffset: number = 0, byteLength: number = buffer.byteLength) {
+    this.view = new DataView(buffer, byteOffset, byteLength)
+    if (byteLength < HEADER_SIZE || this.view.getUint16(0, true) !== HEADER_ALIGNMENT) {
+      throw new Error("Invalid MapBuffer header")
+    }
+    this.count = this.view.getUint16(2, true)
+    if (HEADER_SIZE + this.count * BUCKET_SIZE > byteLength) {
+      throw new Error("MapBuffer is truncated")
+    }
+  }
+
+  hasKey(key: number): boolean {
+    return this.findBucketOffset(key) !== -1
+  }
+
+  getBool(key: number): boolean {
+    return this.getInt(key) !== 0
+  }
+
+  getInt(key: number): number {
+    return this.view.getInt32(this.getBucketOffset(key) + BUCKET_VALUE_OFFSET, true)
+  }
+
+  getDouble(key: number): number {
+    return this.view.getFloat64(this.getBucketOffset(key) + BUCKET_VALUE_OFFSET, true)
+  }
+
+  getString(key: number): string {
+    const offset = this.getDynamicDataOffset(key)
+    const length = this.view.getInt32(offset, true)
+    const bytes = new Uint8Array(this.buffer, this.byteOffset + offset + INT_SIZE, length)
+    return util.TextDecoder.create("utf-8").decodeWithStream(bytes)
+  }
+
+  /**
+   * Nested maps share the ArrayBuffer of their parent, so they aren't copied.
+   */
+  getMapBuffer(key: number): MapBuffer {
+    const offset = this.getDynamicDataOffset(key)
+    const length = this.view.getInt32(offset, true)
+    return new MapBuffer(this.buffer, this.byteOffset + offset + INT_SIZE, length)
+  }
+
+  getMapBufferList(key: number): MapBuffer[] {
+    const offset = this.getDynamicDataOffset(key)
+    const listEnd = offset + INT_SIZE + this.view.getInt32(offset, true)
+    const mapBuffers: MapBuffer[] = []
+    let itemOffset = offset + INT_SIZE
+    while (itemOffset < listEnd) {
+      const length = this.view.getInt32(itemOffset, true)
+      mapBuffers.push(new MapBuffer(this.buffer, this.byteOffset + itemOffset + INT_SIZE, length))
+      itemOffset += INT_SIZE + length
+    }
+    return mapBuffers
+  }
+
+  private getDynamicDataOffset(key: number): number {
+    return HEADER_SIZE + this.count * BUCKET_SIZE + this.getInt(key)
+  }
+
+  private getBucketOffset(key: number): number {
+    const bucketOffset = this.findBucketOffset(key)
+    if (bucketOffset === -1) {
+      throw new Error(`Key ${key} not found in MapBuffer`)
+    }
+    return bucketOffset
+  }
+
+  private findBucketOffset(key: number): number {
+    let lo = 0
+    let hi = this.count - 1
+    while (lo <= hi) {
+      const mid = (lo + hi) >> 1
+      const bucketOffset = HEADER_SIZE + mid * BUCKET_SIZE
+      const midKey = this.view.getUint16(bucketOffset, true)
+      if (midKey < key) {
+        lo = mid + 1
+      } else if (midKey > key) {
+        hi = mid - 1
+      } else {
+        return bucketOffset
+      }
+    }
+    return -1
+  }
+}
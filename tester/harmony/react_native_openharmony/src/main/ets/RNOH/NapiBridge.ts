@@ -7,7 +7,7 @@ import type { AttributedString, ParagraphAttributes, LayoutConstrains } from "./
 import { measureParagraph } from "./TextLayoutManager"
 import type { DisplayMode } from './CppBridgeUtils'
 import { RNOHLogger } from "./RNOHLogger"
-import type { InspectorInstance, DisplayMetrics } from './types'
+import type { ContinuousEventStats, ImageLoaderStats, InspectorInstance, DisplayMetrics, StartupPhase, SurfaceTelemetry } from './types'
 import { FatalRNOHError, RNOHError } from "./RNOHError"
 import type { FrameNodeFactory } from "./RNInstance"
 
@@ -41,6 +41,26 @@ export class NapiBridge {
     return this.libRNOHApp?.onInit(shouldCleanUpRNInstances)
   }
 
+  initializeHermesCodeCache(dirPath: string, maxSizeInBytes: number) {
+    this.libRNOHApp?.initializeHermesCodeCache(dirPath, maxSizeInBytes)
+  }
+
+  storeHermesBytecode(sourcePath: string, bytecodePath: string): boolean {
+    return this.libRNOHApp?.storeHermesBytecode(sourcePath, bytecodePath) ?? false
+  }
+
+  initializeImageLoader(diskCacheDirPath: string, diskCacheMaxSizeInBytes: number, memoryCacheMaxSizeInBytes: number) {
+    this.libRNOHApp?.initializeImageLoader(diskCacheDirPath, diskCacheMaxSizeInBytes, memoryCacheMaxSizeInBytes)
+  }
+
+  destroyImageLoader() {
+    this.libRNOHApp?.destroyImageLoader()
+  }
+
+  getImageLoaderStats(): ImageLoaderStats | undefined {
+    return JSON.parse(this.libRNOHApp?.getImageLoaderStats() ?? "null") ?? undefined
+  }
+
   getNextRNInstanceId(): number {
     return this.libRNOHApp?.getNextRNInstanceId()
   }
@@ -55,7 +75,8 @@ export class NapiBridge {
                             onCppMessage: (type: string, payload: any) => void,
                             shouldEnableDebugger: boolean,
                             shouldEnableBackgroundExecutor: boolean,
-                            cppFeatureFlags: CppFeatureFlag[]
+                            cppFeatureFlags: CppFeatureFlag[],
+                            turboModulesToPrewarm: string[] = []
   ) {
     const cppFeatureFlagStatusByName = cppFeatureFlags.reduce((acc, cppFeatureFlag) => {
       acc[cppFeatureFlag] = true
@@ -82,6 +103,7 @@ export class NapiBridge {
       shouldEnableBackgroundExecutor,
       cppFeatureFlagStatusByName,
       frameNodeFactoryRef,
+      turboModulesToPrewarm,
     );
   }
 
@@ -101,6 +123,45 @@ export class NapiBridge {
     })
   }
 
+  loadScriptFromFile(instanceId: number, path: string, sourceURL: string): Promise<void> {
+    return new Promise((resolve, reject) => {
+      this.libRNOHApp?.loadScriptFromFile(instanceId, path, sourceURL, (errorMsg: string) => {
+        errorMsg ? reject(new Error(errorMsg)) : resolve()
+      });
+    })
+  }
+
+  /**
+   * Records a marker in HiTrace and the native startup timeline.
+   */
+  logMarker(marker: string, tag: string, type: "START" | "FINISH" | "POINT") {
+    this.libRNOHApp?.logMarker(marker, tag, type)
+  }
+
+  getStartupTimeline(): StartupPhase[] {
+    return JSON.parse(this.libRNOHApp?.getStartupTimeline() ?? "[]")
+  }
+
+  registerSegment(instanceId: number, segmentId: number, path: string) {
+    this.libRNOHApp?.registerSegment(instanceId, segmentId, path);
+  }
+
+  setSurfaceTelemetrySamplingInterval(instanceId: number, samplingInterval: number) {
+    this.libRNOHApp?.setSurfaceTelemetrySamplingInterval(instanceId, samplingInterval);
+  }
+
+  getSurfaceTelemetry(instanceId: number): SurfaceTelemetry[] {
+    return JSON.parse(this.libRNOHApp?.getSurfaceTelemetry(instanceId) ?? "[]")
+  }
+
+  dumpSurfaceTelemetry(instanceId: number, path: string): boolean {
+    return this.libRNOHApp?.dumpSurfaceTelemetry(instanceId, path) ?? false
+  }
+
+  getContinuousEventStats(instanceId: number): ContinuousEventStats[] {
+    return JSON.parse(this.libRNOHApp?.getContinuousEventStats(instanceId) ?? "[]")
+  }
+
   startSurface(
     instanceId: number,
     surfaceTag: number,
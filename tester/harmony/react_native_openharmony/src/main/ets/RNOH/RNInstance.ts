@@ -21,6 +21,7 @@ import window from '@ohos.window'
 import { DevServerHelper } from './DevServerHelper';
 import { HttpClient } from '../HttpClient/HttpClient'
 import type { HttpClientProvider } from './HttpClientProvider'
+import type { ContinuousEventStats, SurfaceTelemetry } from './types'
 
 export type SurfaceContext = {
   width: number
@@ -158,6 +159,28 @@ export interface RNInstance {
    * Reads JS Bundle and executes loaded code.
    */
   runJSBundle(jsBundleProvider: JSBundleProvider): Promise<void>;
+  /**
+   * Registers a bundle segment stored in a file. Plain segments are executed right away. If the main bundle is an
+   * indexed RAM bundle, modules of a RAM bundle segment are read from the memory-mapped file when they are required.
+   */
+  registerSegment(segmentId: number, path: string): void;
+  /**
+   * Aggregates telemetry of every n-th mounting transaction per surface. 0 (default) disables sampling.
+   */
+  setSurfaceTelemetrySamplingInterval(samplingInterval: number): void;
+  /**
+   * Returns telemetry aggregated per surface since sampling was enabled.
+   */
+  getSurfaceTelemetry(): SurfaceTelemetry[];
+  /**
+   * Writes the aggregated surface telemetry as JSON to a file. Returns false if the file couldn't be written.
+   */
+  dumpSurfaceTelemetry(path: string): boolean;
+  /**
+   * Returns counts of dispatched and coalesced continuous events per event type. Events are coalesced only in the
+   * C-API architecture.
+   */
+  getContinuousEventStats(): ContinuousEventStats[];
   /**
    * Provides TurboModule instance. Currently TurboModule live on UI thread. This method may be deprecated once "Worker" turbo module are supported.
    */
@@ -267,6 +290,17 @@ export type RNInstanceOptions = {
    * Required if using a custom `--assets-dest` with `react-native bundle-harmony`.
    */
   assetsDest?: string,
+  /**
+   * Names of TurboModules which are created right after the instance, while the JS bundle is being loaded.
+   * Modules that are needed early at startup should be listed here, so that JS doesn't have to wait for them.
+   */
+  turboModulesToPrewarm?: string[],
+  /**
+   * Name of the pool of prewarmed instances, see `RNOHCoreContext.prewarmRNInstances`. If set, the instance is taken
+   * from the pool when one is available. All options passed with the same name should describe the same configuration,
+   * because prewarmed instances are created with the options passed to `prewarmRNInstances`.
+   */
+  poolName?: string,
 }
 
 /**
@@ -318,6 +352,7 @@ export class RNInstanceImpl implements RNInstance {
     private shouldUseCApiArchitecture: boolean,
     private assetsDest: string,
     httpClientProvider: HttpClientProvider,
+    private turboModulesToPrewarm: string[] = [],
   ) {
     this.httpClient = httpClientProvider.getInstance(this)
     this.logger = injectedLogger.clone("RNInstance")
@@ -427,6 +462,7 @@ export class RNInstanceImpl implements RNInstance {
       this.shouldEnableDebugger,
       this.shouldEnableBackgroundExecutor,
       cppFeatureFlags,
+      this.turboModulesToPrewarm,
     )
     stopTracing()
   }
@@ -543,6 +579,26 @@ export class RNInstanceImpl implements RNInstance {
     return this.bundleExecutionStatusByBundleURL.get(bundleURL)
   }
 
+  public registerSegment(segmentId: number, path: string) {
+    this.napiBridge.registerSegment(this.id, segmentId, path)
+  }
+
+  public setSurfaceTelemetrySamplingInterval(samplingInterval: number) {
+    this.napiBridge.setSurfaceTelemetrySamplingInterval(this.id, samplingInterval)
+  }
+
+  public getSurfaceTelemetry(): SurfaceTelemetry[] {
+    return this.napiBridge.getSurfaceTelemetry(this.id)
+  }
+
+  public dumpSurfaceTelemetry(path: string): boolean {
+    return this.napiBridge.dumpSurfaceTelemetry(this.id, path)
+  }
+
+  public getContinuousEventStats(): ContinuousEventStats[] {
+    return this.napiBridge.getContinuousEventStats(this.id)
+  }
+
   public async runJSBundle(jsBundleProvider: JSBundleProvider) {
     const stopTracing = this.logger.clone("runJSBundle").startTracing()
     const bundleURL = jsBundleProvider.getURL()
@@ -551,12 +607,21 @@ export class RNInstanceImpl implements RNInstance {
       this.devToolsController.eventEmitter.emit("SHOW_DEV_LOADING_VIEW", this.id,
         `Loading from ${jsBundleProvider.getHumanFriendlyURL()}...`)
       this.bundleExecutionStatusByBundleURL.set(bundleURL, "RUNNING")
-      const jsBundle = await jsBundleProvider.getBundle((progress) => {
-        this.devToolsController.eventEmitter.emit("SHOW_DEV_LOADING_VIEW", this.id,
-          `Loading from ${jsBundleProvider.getHumanFriendlyURL()} (${Math.round(progress * 100)}%)`)
-      })
-      this.initialBundleUrl = this.initialBundleUrl ?? jsBundleProvider.getURL()
-      await this.napiBridge.loadScript(this.id, jsBundle, bundleURL)
+      const jsBundleFilePath = await jsBundleProvider.getBundleFilePath()
+      if (jsBundleFilePath !== null) {
+        // the bundle is read (or memory-mapped) on the native side
+        this.initialBundleUrl = this.initialBundleUrl ?? jsBundleProvider.getURL()
+        await this.napiBridge.loadScriptFromFile(this.id, jsBundleFilePath, bundleURL)
+      } else {
+        this.napiBridge.logMarker("READ_JS_BUNDLE", bundleURL, "START")
+        const jsBundle = await jsBundleProvider.getBundle((progress) => {
+          this.devToolsController.eventEmitter.emit("SHOW_DEV_LOADING_VIEW", this.id,
+            `Loading from ${jsBundleProvider.getHumanFriendlyURL()} (${Math.round(progress * 100)}%)`)
+        })
+        this.napiBridge.logMarker("READ_JS_BUNDLE", bundleURL, "FINISH")
+        this.initialBundleUrl = this.initialBundleUrl ?? jsBundleProvider.getURL()
+        await this.napiBridge.loadScript(this.id, jsBundle, bundleURL)
+      }
       this.lifecycleState = LifecycleState.READY
       const hotReloadConfig = jsBundleProvider.getHotReloadConfig()
       if (hotReloadConfig) {
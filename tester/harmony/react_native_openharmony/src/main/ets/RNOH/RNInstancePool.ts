@@ -0,0 +1,119 @@
+import type { RNInstanceImpl, RNInstanceOptions } from './RNInstance';
+import type { RNOHLogger } from './RNOHLogger';
+
+const MEMORY_LEVEL_MODERATE = 0
+
+type Pool = {
+  options: RNInstanceOptions,
+  targetSize: number,
+  idleInstances: RNInstanceImpl[],
+  fillPromise: Promise<void> | undefined,
+}
+
+/**
+ * Keeps RNInstances which were created and initialized ahead of time, up to the point of loading a JS bundle, so that
+ * screens with additional RNInstances don't have to wait for the JS runtime, TurboModules and the scheduler to be
+ * created. Pools are identified by `RNInstanceOptions.poolName`, and instances of a pool are created with the options
+ * passed to the latest `prewarm` call for that name.
+ */
+export class RNInstancePool {
+  private poolByName = new Map<string, Pool>()
+  private logger: RNOHLogger
+
+  constructor(
+    logger: RNOHLogger,
+    private createInstance: (options: RNInstanceOptions) => Promise<RNInstanceImpl>,
+  ) {
+    this.logger = logger.clone("RNInstancePool")
+  }
+
+  /**
+   * Creates instances until `size` instances of the pool named `options.poolName` are waiting to be used. Idle
+   * instances above `size` are destroyed.
+   */
+  public prewarm(options: RNInstanceOptions, size: number): Promise<void> {
+    if (options.poolName === undefined) {
+      return Promise.reject(new Error("RNInstanceOptions.poolName is required to prewarm RNInstances"))
+    }
+    let pool = this.poolByName.get(options.poolName)
+    if (!pool) {
+      pool = { options, targetSize: size, idleInstances: [], fillPromise: undefined }
+      this.poolByName.set(options.poolName, pool)
+    }
+    pool.options = options
+    pool.targetSize = size
+    pool.idleInstances.splice(size).forEach(rnInstance => this.destroyIdleInstance(rnInstance))
+    return this.fill(pool)
+  }
+
+  /**
+   * Returns a prewarmed instance, if there is one, and starts creating its replacement once the current task is done.
+   * JS runtime state can't be reset, so instances which were destroyed are never handed out again.
+   */
+  public acquire(options: RNInstanceOptions): RNInstanceImpl | undefined {
+    if (options.poolName === undefined) {
+      return undefined
+    }
+    const pool = this.poolByName.get(options.poolName)
+    const rnInstance = pool?.idleInstances.shift()
+    if (pool && rnInstance) {
+      // let the acquired instance load its bundle first
+      setTimeout(() => this.fill(pool), 0)
+    }
+    return rnInstance
+  }
+
+  /**
+   * Releases idle instances. Under moderate memory pressure one instance per pool is kept, otherwise all of them are
+   * destroyed. Pools are refilled when an instance is acquired or prewarmed again.
+   */
+  public trim(memoryLevel: number) {
+    const maxIdleInstancesCount = memoryLevel === MEMORY_LEVEL_MODERATE ? 1 : 0
+    this.poolByName.forEach((pool) => {
+      const trimmedInstances = pool.idleInstances.splice(maxIdleInstancesCount)
+      trimmedInstances.forEach(rnInstance => this.destroyIdleInstance(rnInstance))
+    })
+  }
+
+  public destroy() {
+    this.poolByName.forEach((pool) => {
+      pool.targetSize = 0
+      pool.idleInstances.splice(0).forEach(rnInstance => this.destroyIdleInstance(rnInstance))
+    })
+  }
+
+  private fill(pool: Pool): Promise<void> {
+    if (!pool.fillPromise) {
+      pool.fillPromise = this.fillSequentially(pool).finally(() => {
+        pool.fillPromise = undefined
+      })
+    }
+    return pool.fillPromise
+  }
+
+  private async fillSequentially(pool: Pool) {
+    // instances are created one by one to avoid blocking the main thread for too long
+    while (pool.idleInstances.length < pool.targetSize) {
+      const stopTracing = this.logger.clone("createIdleInstance").startTracing()
+      try {
+        const rnInstance = await this.createInstance(pool.options)
+        if (pool.idleInstances.length < pool.targetSize) {
+          pool.idleInstances.push(rnInstance)
+        } else {
+          this.destroyIdleInstance(rnInstance)
+        }
+      } catch (err) {
+        this.logger.error("Failed to prewarm RNInstance", err)
+        return
+      } finally {
+        stopTracing()
+      }
+    }
+  }
+
+  private destroyIdleInstance(rnInstance: RNInstanceImpl) {
+    // idle instances are owned by the pool, so native resources can be released safely
+    rnInstance.enableFeatureFlag("ENABLE_RN_INSTANCE_CLEAN_UP")
+    rnInstance.onDestroy()
+  }
+}
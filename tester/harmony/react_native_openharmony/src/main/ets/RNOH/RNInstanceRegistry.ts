@@ -5,9 +5,11 @@ import type { RNOHContext } from './RNOHContext';
 import type { RNOHLogger } from './RNOHLogger';
 import type { DevToolsController } from "./DevToolsController"
 import { HttpClientProvider } from './HttpClientProvider';
+import { RNInstancePool } from './RNInstancePool';
 
 export class RNInstanceRegistry {
   private instanceMap: Map<number, RNInstanceImpl> = new Map();
+  private instancePool: RNInstancePool
 
   constructor(
     private logger: RNOHLogger,
@@ -16,11 +18,39 @@ export class RNInstanceRegistry {
     private createRNOHContext: (rnInstance: RNInstance) => RNOHContext,
     private httpClientProvider: HttpClientProvider,
   ) {
+    this.instancePool = new RNInstancePool(logger, (options) => this.createUnregisteredInstance(options))
   }
 
   public async createInstance(
     options: RNInstanceOptions,
   ): Promise<RNInstance> {
+    let instance = this.instancePool.acquire(options)
+    if (instance) {
+      this.logger.clone("RNInstanceRegistry").debug(`Using prewarmed RNInstance (id: ${instance.getId()})`)
+    } else {
+      instance = await this.createUnregisteredInstance(options)
+    }
+    this.instanceMap.set(instance.getId(), instance)
+    return instance;
+  }
+
+  /**
+   * Creates and initializes `count` instances with given options in advance. Subsequent `createInstance` calls with
+   * the same `poolName` use these instances.
+   */
+  public prewarmInstances(options: RNInstanceOptions, count: number): Promise<void> {
+    return this.instancePool.prewarm(options, count)
+  }
+
+  public onMemoryLevel(memoryLevel: number) {
+    this.instancePool.trim(memoryLevel)
+  }
+
+  public onDestroy() {
+    this.instancePool.destroy()
+  }
+
+  private async createUnregisteredInstance(options: RNInstanceOptions): Promise<RNInstanceImpl> {
     const id = this.napiBridge.getNextRNInstanceId();
     const instance = new RNInstanceImpl(
       id,
@@ -36,9 +66,9 @@ export class RNInstanceRegistry {
       options.enableCAPIArchitecture ?? false,
       options.assetsDest,
       this.httpClientProvider,
+      options.turboModulesToPrewarm ?? [],
     )
     await instance.initialize(options.createRNPackages({}))
-    this.instanceMap.set(id, instance)
     return instance;
   }
 
@@ -74,7 +74,8 @@ export class RNOHContext extends RNOHCoreContext {
       coreContext.safeAreaInsetsProvider,
       coreContext.isDebugModeEnabled,
       coreContext.launchUri,
-      coreContext._defaultBackPressHandler
+      coreContext._defaultBackPressHandler,
+      coreContext.prewarmRNInstances,
     )
     this.devToolsController = coreContext.devToolsController
     this.devMenu = coreContext.devMenu
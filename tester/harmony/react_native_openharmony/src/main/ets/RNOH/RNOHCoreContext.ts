@@ -64,7 +64,9 @@ export class RNOHCoreContext {
       safeAreaInsetsProvider,
       isDebugModeEnabled,
       launchUri,
-      defaultBackPressHandler
+      defaultBackPressHandler,
+      // prewarmRNInstances
+      (options, count) => rnInstanceRegistry.prewarmInstances(options, count),
     )
   }
 
@@ -111,7 +113,14 @@ export class RNOHCoreContext {
      */
     public launchUri: string | undefined,
 
-    public _defaultBackPressHandler: () => void
+    public _defaultBackPressHandler: () => void,
+    /**
+     * Creates and initializes RNInstances in advance, up to the point of loading a JS bundle.
+     * `createAndRegisterRNInstance` called with the same `RNInstanceOptions.poolName` returns one of these instances,
+     * which makes opening additional RNInstances faster. `options.poolName` is required. Prewarmed instances are
+     * released when the system is low on memory.
+     */
+    public prewarmRNInstances: (options: RNInstanceOptions, count: number) => Promise<void>,
   ) {
   }
 
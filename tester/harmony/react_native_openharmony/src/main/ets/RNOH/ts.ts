@@ -21,6 +21,7 @@ export * from './EventEmitter'
 export * from './types'
 export * from './TouchTargetHelper'
 export * from "./CompactValue"
+export * from "./MapBuffer"
 export * from "./RNOHLogger"
 export * from "./RNOHError"
 export * from './JSPackagerClient'
@@ -73,3 +73,63 @@ export interface InspectorInstance {
   getPages(): InspectorPage[]
   connect(pageId: InspectorPageId, remote: InspectorRemoteConnection): InspectorLocalConnection
 }
+
+export type ImageLoaderStats = {
+  decodedImagesCount: number,
+  /**
+   * Images decoded below their source size, because they are displayed at a smaller size.
+   */
+  downsampledImagesCount: number,
+  /**
+   * Estimated memory saved by downsampling decoded images.
+   */
+  savedBytesCount: number,
+}
+
+/**
+ * Startup phase recorded on the native side. Times are in milliseconds, measured with a monotonic clock.
+ * `finishPeakRSSInKB` is the peak resident set size of the process when the phase finished, 0 if unavailable.
+ */
+export type StartupPhase = {
+  name: string,
+  tag: string,
+  startTime: number,
+  startThreadId: number,
+  finishTime: number | null,
+  finishThreadId: number | null,
+  finishPeakRSSInKB: number | null,
+}
+
+/**
+ * Durations are in milliseconds. Percentiles are approximated with an error of at most 25%.
+ */
+export type TelemetryHistogram = {
+  count: number,
+  min?: number,
+  max?: number,
+  mean?: number,
+  p50?: number,
+  p95?: number,
+  p99?: number,
+}
+
+export type SurfaceTelemetry = {
+  surfaceId: number,
+  commitToMountLatency: TelemetryHistogram,
+  commitTime: TelemetryHistogram,
+  diffTime: TelemetryHistogram,
+  layoutTime: TelemetryHistogram,
+  textMeasureTime: TelemetryHistogram,
+  mainThreadMountTime: TelemetryHistogram,
+  mutationsCount: TelemetryHistogram,
+}
+
+/**
+ * Counts of continuous events, e.g. scroll or touch move. Coalesced events were replaced by a newer event before JS
+ * consumed the previous one.
+ */
+export type ContinuousEventStats = {
+  eventType: string,
+  dispatchedEventsCount: number,
+  coalescedEventsCount: number,
+}
@@ -1,4 +1,4 @@
-import { Tag } from '../../../RNOH/ts';
+import { MapBufferBuilder, Tag } from '../../../RNOH/ts';
 import { ViewBaseProps, ViewRawProps } from '../RNViewBase/ts';
 
 
@@ -74,6 +74,37 @@ export interface ScrollEvent {
   responderIgnoreScroll: boolean;
 }
 
+/**
+ * Keys of scroll events encoded as MapBuffer. Keep in sync with ScrollEventEmitRequestHandler.h.
+ */
+export enum ScrollEventKey {
+  ContentSizeWidth = 0,
+  ContentSizeHeight = 1,
+  ContentOffsetX = 2,
+  ContentOffsetY = 3,
+  ContainerSizeWidth = 4,
+  ContainerSizeHeight = 5,
+  ZoomScale = 6,
+  ResponderIgnoreScroll = 7,
+}
+
+/**
+ * Scroll events are emitted at the display refresh rate, so they are passed to the native side as MapBuffer,
+ * which is cheaper to read than an object with nested objects.
+ */
+export function encodeScrollEvent(scrollEvent: ScrollEvent): ArrayBuffer {
+  return new MapBufferBuilder()
+    .putDouble(ScrollEventKey.ContentSizeWidth, scrollEvent.contentSize.width)
+    .putDouble(ScrollEventKey.ContentSizeHeight, scrollEvent.contentSize.height)
+    .putDouble(ScrollEventKey.ContentOffsetX, scrollEvent.contentOffset.x)
+    .putDouble(ScrollEventKey.ContentOffsetY, scrollEvent.contentOffset.y)
+    .putDouble(ScrollEventKey.ContainerSizeWidth, scrollEvent.containerSize.width)
+    .putDouble(ScrollEventKey.ContainerSizeHeight, scrollEvent.containerSize.height)
+    .putDouble(ScrollEventKey.ZoomScale, scrollEvent.zoomScale)
+    .putBool(ScrollEventKey.ResponderIgnoreScroll, scrollEvent.responderIgnoreScroll)
+    .build()
+}
+
 export interface MaintainVisibleContentPosition {
   minIndexForVisible: number,
   autoscrollToTopThreshold?: number,
@@ -33,8 +33,7 @@ export class BlobRegistry {
     }
 
     if (offset > 0 || size !== data.byteLength) {
-      const bytes = new Uint8Array(data, offset, size);
-      return bytes.buffer;
+      return data.slice(offset, offset + size);
     }
     return data;
   }
@@ -130,6 +130,14 @@ export class BlobTurboModule extends TurboModule {
     this.blobRegistry.appendPartsToBlob(parts, blobId)
   }
 
+  /**
+   * Called from the C++ side of the module, `buffer` is already a copy of the
+   * bytes passed from JS.
+   */
+  createFromArrayBuffer(buffer: ArrayBuffer, blobId: string): void {
+    this.blobRegistry.saveWithId(buffer, blobId)
+  }
+
   sendOverSocket(blob: BlobMetadata, idDouble: number): void {
     const id = Math.floor(idDouble);
     const webSocketModule = this.getWebSocketModule();
@@ -6,9 +6,6 @@ import util from '@ohos.util';
 export class FileReaderTurboModule extends TurboModule {
   public static readonly NAME = 'FileReaderModule';
 
-  private base64Helper = new util.Base64Helper();
-
-
   private getBlobTurboModule(): BlobTurboModule {
     const blobModule = this.ctx.rnInstance.getTurboModule<BlobTurboModule>(BlobTurboModule.NAME);
     if (blobModule == null) {
@@ -25,18 +22,15 @@ export class FileReaderTurboModule extends TurboModule {
     return result;
   }
 
-  async readAsDataURL(blobMetadata: BlobMetadata): Promise<string> {
-
+  /**
+   * Used by the native `readAsDataURL` implementation, which encodes the returned bytes.
+   */
+  readAsArrayBuffer(blobMetadata: BlobMetadata): ArrayBuffer {
     const blobModule = this.getBlobTurboModule();
-    const bytes = new Uint8Array(blobModule.findByMetaData(blobMetadata));
-    let urlString = 'data:';
-    if (blobMetadata.type != null && blobMetadata.type.length > 0) {
-      urlString += blobMetadata.type;
-    } else {
-      urlString += 'application/octet-stream';
+    const bytes = blobModule.findByMetaData(blobMetadata);
+    if (bytes == null) {
+      throw new Error(`FileReaderModule::Could not find blob ${blobMetadata.blobId}`);
     }
-    urlString += ';base64,';
-    urlString += await this.base64Helper.encodeToString(bytes);
-    return urlString;
+    return bytes;
   }
 }
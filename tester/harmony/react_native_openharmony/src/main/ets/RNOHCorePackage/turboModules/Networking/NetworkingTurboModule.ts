@@ -48,6 +48,17 @@ export type RequestBodyHandler = {
   };
 }
 
+/**
+ * Native functions provided by the C++ side. Body chunks are passed to native code as they arrive, and the response,
+ * its body and its completion are delivered to JS at once, without converting the body on the ArkTS side.
+ */
+type ResponseSink = {
+  onData: (requestId: number, chunk: ArrayBuffer, expectedLength: number) => void,
+  onEnd: (requestId: number, statusCode: number, headers: Object, url: string,
+    responseType: 'text' | 'base64') => void,
+  onDrop: (requestId: number) => void,
+}
+
 export type ResponseBodyHandler = {
   supports: (responseType: ResponseType) => boolean,
   handleResponse: (response: string | Object | ArrayBuffer) => BlobMetadata
@@ -65,9 +76,9 @@ export class NetworkingTurboModule extends TurboModule {
   private base64Helper: util.Base64Helper = new util.Base64Helper();
   private uriHandlers: ArrayList<UriHandler> = new ArrayList();
   private requestCancellersById: Map<number, CancelRequestCallback> = new Map();
-  private nextId: number = 0
   private requestBodyHandlers: ArrayList<RequestBodyHandler> = new ArrayList();
   private responseBodyHandlers: ArrayList<ResponseBodyHandler> = new ArrayList();
+  private responseSink: ResponseSink | undefined = undefined;
 
   private REQUEST_METHOD_BY_NAME: Record<string, http.RequestMethod> = {
     OPTIONS: http.RequestMethod.OPTIONS,
@@ -136,6 +147,15 @@ export class NetworkingTurboModule extends TurboModule {
     throw new Error("Unsupported query response type");
   }
 
+  private findResponseBodyHandler(responseType: ResponseType): ResponseBodyHandler | undefined {
+    for (const handler of this.responseBodyHandlers) {
+      if (handler.supports(responseType)) {
+        return handler;
+      }
+    }
+    return undefined;
+  }
+
   private encodeBody(data: Object): string | ArrayBuffer | Object {
     if ('trackingName' in data) {
       delete data.trackingName;
@@ -166,9 +186,9 @@ export class NetworkingTurboModule extends TurboModule {
     return formData;
   }
 
-  async sendRequest(query: Query, callback: (requestId: number) => void) {
+  async sendRequest(query: Query, requestId: number, responseSink: ResponseSink) {
+    this.responseSink = responseSink;
     const httpClient = this.ctx.rnInstance.httpClient;
-    const requestId = this.createId();
     for (const handler of this.uriHandlers) {
       if (handler.supports(query)) {
         const response = handler.fetch(query);
@@ -203,6 +223,10 @@ export class NetworkingTurboModule extends TurboModule {
     else {
       extraData = this.encodeBody(query.data);
     }
+    const responseBodyHandler = this.findResponseBodyHandler(query.responseType);
+    // text and base64 bodies go to native code chunk by chunk, other ones are collected and handled here
+    const shouldStreamBody = !responseBodyHandler && (query.responseType === 'text' || query.responseType === 'base64');
+    let hasStreamedData = false;
     const { cancel, promise } = httpClient.sendRequest(query.url,
       {
         method: this.REQUEST_METHOD_BY_NAME[query.method],
@@ -211,44 +235,53 @@ export class NetworkingTurboModule extends TurboModule {
         connectTimeout: query.timeout,
         readTimeout: query.timeout,
         multiFormDataList: multiFormDataList
-      })
+      },
+      shouldStreamBody ? (progress) => {
+        hasStreamedData = true;
+        responseSink.onData(requestId, progress.bitsReceived, Number(progress.totalLength) || 0);
+      } : undefined,
+      !shouldStreamBody)
     this.requestCancellersById.set(requestId, cancel);
 
     promise.then(async (httpResponse) => {
-      this.networkEventDispatcher.dispatchDidReceiveNetworkResponse(requestId, httpResponse.statusCode, httpResponse.headers, query.url);
-      if (this.requestCancellersById[requestId]) {
-        this.requestCancellersById.delete(requestId);
-      }
-      for (const handler of this.responseBodyHandlers) {
-        if (handler.supports(query.responseType)) {
-          this.networkEventDispatcher.dispatchDidReceiveNetworkData(requestId, handler.handleResponse(httpResponse.body));
-          this.networkEventDispatcher.dispatchDidCompleteNetworkResponse(requestId);
-          return;
+      this.requestCancellersById.delete(requestId);
+      const body = httpResponse.body;
+      if (shouldStreamBody) {
+        // HttpClients which don't report progress return the whole body instead
+        if (!hasStreamedData && body instanceof ArrayBuffer && body.byteLength > 0) {
+          responseSink.onData(requestId, body, body.byteLength);
+        } else if (!hasStreamedData && typeof body === 'string' && body.length > 0) {
+          responseSink.onData(requestId, new util.TextEncoder().encodeInto(body).buffer, 0);
         }
+        // events emitted by the native side and through `networkEventDispatcher` take different paths to JS, so all
+        // events of a request must go through the same one to keep their order
+        responseSink.onEnd(requestId, httpResponse.statusCode, httpResponse.headers, query.url, query.responseType);
+        return;
+      }
+      this.networkEventDispatcher.dispatchDidReceiveNetworkResponse(requestId, httpResponse.statusCode, httpResponse.headers, query.url);
+      if (responseBodyHandler) {
+        this.networkEventDispatcher.dispatchDidReceiveNetworkData(requestId, responseBodyHandler.handleResponse(body));
+      } else {
+        this.networkEventDispatcher.dispatchDidReceiveNetworkData(requestId, await this.encodeResponse(body, query.responseType));
       }
-      this.networkEventDispatcher.dispatchDidReceiveNetworkData(requestId, await this.encodeResponse(httpResponse.body, query.responseType));
       this.networkEventDispatcher.dispatchDidCompleteNetworkResponse(requestId);
     }).catch((errorResponse: HttpErrorResponse) => {
+      if (shouldStreamBody) {
+        responseSink.onDrop(requestId);
+      }
       this.networkEventDispatcher.dispatchDidReceiveNetworkResponse(requestId, errorResponse.statusCode || 0, {
       }, query.url)
       this.networkEventDispatcher.dispatchDidCompleteNetworkResponseWithError(requestId, errorResponse.error.toString());
-      if (this.requestCancellersById[requestId]) {
-        this.requestCancellersById.delete(requestId);
-      }
+      this.requestCancellersById.delete(requestId);
     });
-
-
-    callback(requestId)
   }
 
   abortRequest(requestId: number) {
-    if (this.requestCancellersById[requestId]) {
-      this.requestCancellersById[requestId]();
+    const cancel = this.requestCancellersById.get(requestId);
+    if (cancel) {
+      cancel();
       this.requestCancellersById.delete(requestId);
+      this.responseSink?.onDrop(requestId);
     }
   }
-
-  private createId(): number {
-    return this.nextId++;
-  }
 }
@@ -1,71 +1,29 @@
 import { LifecycleState, TurboModule } from '../../RNOH/ts';
 
+/**
+ * Timers are run on the C++ side. This module only tells it when the app is paused and resumed, so that timers
+ * aren't called while the app is in the background.
+ */
 export class TimingTurboModule extends TurboModule {
   public static readonly NAME = 'Timing';
 
-  private nativeTimerMap: Map<number, {
-    nativeTimerId: number,
-    repeats: boolean
-  }> = new Map();
+  private unsubscribeFromLifecycleEvents: (() => void)[] = [];
 
-  createTimer(
-    id: number,
-    duration: number,
-    jsSchedulingTime: number,
-    repeats: boolean
-  ): void {
-    const triggerTimer = () => {
-      if (this.ctx.rnInstance.getLifecycleState() === LifecycleState.READY) {
-        this.ctx.rnInstance.callRNFunction("JSTimers", "callTimers", [[id]]);
-        if (!repeats) {
-          this.deleteTimer(id);
-        }
-      }
-      else if (this.ctx.rnInstance.getLifecycleState() === LifecycleState.PAUSED) {
-        this.deleteTimer(id);
-        this.ctx.rnInstance.subscribeToLifecycleEvents("FOREGROUND", () => {
-          this.ctx.rnInstance.callRNFunction("JSTimers", "callTimers", [[id]]);
-          if (repeats) {
-            const nativeTimerId = setInterval(triggerTimer, duration);
-            this.nativeTimerMap.set(id, { nativeTimerId, repeats });
-          }
-        })
-      }
-    };
-
-    let nativeTimerId;
-
-    if (repeats) {
-      nativeTimerId = setInterval(triggerTimer, duration)
-    } else {
-      const delay = new Date().getTime() - jsSchedulingTime;
-      nativeTimerId = setTimeout(triggerTimer, Math.max(0, duration - delay))
-    }
-
-    this.nativeTimerMap.set(id, { nativeTimerId, repeats });
-  }
-
-  deleteTimer(id: number): void {
-    const timer = this.nativeTimerMap.get(id);
-    if (!timer) {
-      return;
-    }
-
-    this.nativeTimerMap.delete(id);
-    const { nativeTimerId, repeats } = timer;
-    if (repeats) {
-      clearInterval(nativeTimerId);
-    } else {
-      clearTimeout(nativeTimerId);
-    }
+  setPausedChangeListener(onPausedChange: (isPaused: boolean) => void): void {
+    this.unsubscribe();
+    this.unsubscribeFromLifecycleEvents = [
+      this.ctx.rnInstance.subscribeToLifecycleEvents("BACKGROUND", () => onPausedChange(true)),
+      this.ctx.rnInstance.subscribeToLifecycleEvents("FOREGROUND", () => onPausedChange(false)),
+    ];
+    onPausedChange(this.ctx.rnInstance.getLifecycleState() === LifecycleState.PAUSED);
   }
 
-  setSendIdleEvents(enabled: boolean): void {
-    this.ctx.logger.warn(`TimingTurboModule::setSendIdleEvents(${enabled}): not implemented`);
+  private unsubscribe() {
+    this.unsubscribeFromLifecycleEvents.forEach(unsubscribe => unsubscribe());
+    this.unsubscribeFromLifecycleEvents = [];
   }
 
   public __onDestroy__(): void {
-    const timerIds = [...this.nativeTimerMap.keys()];
-    timerIds.forEach(id => this.deleteTimer(id))
+    this.unsubscribe();
   }
-}
\ No newline at end of file
+}
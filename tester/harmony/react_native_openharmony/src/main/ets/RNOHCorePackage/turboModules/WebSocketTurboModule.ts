@@ -12,6 +12,13 @@ type MessageParams = {
   data?: string | BlobMetadata,
 }
 
+/**
+ * Native function provided by the C++ side. Emits the event to JS. `binaryData`, if provided, is base64-encoded natively
+ * and set as the `data` param.
+ */
+type EventHandler = (eventName: typeof WEB_SOCKET_SUPPORTED_EVENT_NAMES[number], params: Object,
+  binaryData?: ArrayBuffer) => void
+
 export type ContentHandler = {
   processMessage: (params: MessageParams) => MessageParams;
   processByteMessage: (bytes: ArrayBuffer, params: MessageParams) => MessageParams;
@@ -24,6 +31,7 @@ export class WebSocketTurboModule extends TurboModule {
   private logger: RNOHLogger
   private base64 = new util.Base64Helper();
   private contentHandlersBySocketID: Map<number, ContentHandler> = new Map();
+  private eventHandler: EventHandler | undefined = undefined;
 
   constructor(ctx: TurboModuleContext) {
     super(ctx)
@@ -35,6 +43,26 @@ export class WebSocketTurboModule extends TurboModule {
     return WEB_SOCKET_SUPPORTED_EVENT_NAMES
   }
 
+  /**
+   * Called from the native side before any other method. All events need to be emitted through the same channel to
+   * reach JS in order.
+   */
+  setEventHandler(eventHandler: EventHandler) {
+    this.eventHandler = eventHandler;
+  }
+
+  private emitEvent(eventName: typeof WEB_SOCKET_SUPPORTED_EVENT_NAMES[number], params: Object,
+    binaryData?: ArrayBuffer) {
+    if (this.eventHandler) {
+      this.eventHandler(eventName, params, binaryData);
+      return;
+    }
+    if (binaryData) {
+      params = { ...params, data: this.base64.encodeToStringSync(new Uint8Array(binaryData)) };
+    }
+    this.ctx.rnInstance.emitDeviceEvent(eventName, params);
+  }
+
   setContentHandler(socketID: number, contentHandler?: ContentHandler) {
     if (contentHandler) {
       this.contentHandlersBySocketID.set(socketID, contentHandler);
@@ -52,15 +80,15 @@ export class WebSocketTurboModule extends TurboModule {
         params = contentHandler.processMessage(params);
       }
 
-      this.ctx.rnInstance.emitDeviceEvent("websocketMessage", params);
+      this.emitEvent("websocketMessage", params);
     } else if (data instanceof ArrayBuffer) {
-      const base64Data = this.base64.encodeToStringSync(new Uint8Array(data));
-      let params: MessageParams = { id: socketID, type: 'text', data: base64Data };
+      const params: MessageParams = { id: socketID, type: 'binary' };
       if (contentHandler) {
-        params = contentHandler.processByteMessage(data, params);
+        // content handlers (e.g. for blobs) consume the bytes, they don't need them encoded
+        this.emitEvent("websocketMessage", contentHandler.processByteMessage(data, params));
+      } else {
+        this.emitEvent("websocketMessage", params, data);
       }
-
-      this.ctx.rnInstance.emitDeviceEvent("websocketMessage", params);
     }
   }
 
@@ -75,7 +103,7 @@ export class WebSocketTurboModule extends TurboModule {
     }
 
     ws.on('open', (data) => {
-      this.ctx.rnInstance.emitDeviceEvent("websocketOpen", {
+      this.emitEvent("websocketOpen", {
         id: socketID,
         protocol: "",
       });
@@ -84,7 +112,7 @@ export class WebSocketTurboModule extends TurboModule {
     ws.on('error', (err) => this.handleError(socketID, err));
     ws.on('message', (err, data) => this.onMessage(err, data, socketID));
     ws.on('close', (err, data) => {
-      this.ctx.rnInstance.emitDeviceEvent("websocketClosed", {
+      this.emitEvent("websocketClosed", {
         id: socketID,
         ...data,
       })
@@ -114,6 +142,20 @@ export class WebSocketTurboModule extends TurboModule {
     ws.send(message.buffer, (err) => this.handleError(socketID, err));
   }
 
+  /**
+   * Called from the native `sendBinary` implementation with an already decoded message.
+   */
+  sendBinaryBuffer(message: ArrayBuffer, socketID: number) {
+    const ws = this.socketsById.get(socketID);
+    if (!ws) {
+      // the native side doesn't wait for this call, so the error can't be thrown to JS
+      this.handleError(socketID, `Trying to send a message on websocket "${socketID}" but there is no socket.`);
+      return;
+    }
+
+    ws.send(message, (err) => this.handleError(socketID, err));
+  }
+
   sendBinaryArray(message: Uint8Array, socketID: number) {
     const ws = this.socketsById.get(socketID);
     if (!ws) {
@@ -143,10 +185,11 @@ export class WebSocketTurboModule extends TurboModule {
     this.contentHandlersBySocketID.delete(socketID);
   }
 
-  private handleError(socketID: number, err) {
+  private handleError(socketID: number, err: BusinessError | string | undefined) {
     if (err) {
       this.ctx.logger.info(`WebSocketTurboModule::handleError ${JSON.stringify(err)}`);
-      this.ctx.rnInstance.emitDeviceEvent("websocketFailed", { id: socketID, message: JSON.stringify(err) });
+      const message = typeof err === "string" ? err : JSON.stringify(err);
+      this.emitEvent("websocketFailed", { id: socketID, message });
       this.socketsById.delete(socketID);
       this.contentHandlersBySocketID.delete(socketID);
     }
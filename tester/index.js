@@ -3,6 +3,7 @@ import {AppRegistry} from 'react-native';
 import App from './App';
 import {name as appName} from './app.json';
 import {AppParamsContext} from './contexts';
+import {logStartupTimelineAfterFirstFrame} from './benchmarks';
 // @ts-expect-error
 import ReactNativeFeatureFlags from 'react-native/Libraries/ReactNative/ReactNativeFeatureFlags';
 import {
@@ -33,6 +34,7 @@ ReactNativeFeatureFlags.shouldPressibilityUseW3CPointerEventsForHover = () =>
   true;
 
 AppRegistry.registerComponent(appName, () => App);
+logStartupTimelineAfterFirstFrame();
 
 AppRegistry.registerComponent('tester', () => TesterExample);
 AppRegistry.registerComponent('animations', () => AnimationsExample);
@@ -1,5 +1,8 @@
 const {mergeConfig, getDefaultConfig} = require('@react-native/metro-config');
 const {createHarmonyMetroConfig} = require('react-native-harmony/metro.config');
+const {
+  createLargeJsonMiddleware,
+} = require('./scripts/lib/create-large-json-middleware');
 
 /**
  * @type {import("metro-config").ConfigT}
@@ -13,6 +16,9 @@ const config = {
       },
     }),
   },
+  server: {
+    enhanceMiddleware: middleware => createLargeJsonMiddleware(middleware),
+  },
 };
 
 module.exports = mergeConfig(
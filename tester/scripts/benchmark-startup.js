@@ -0,0 +1,83 @@
+const {execFileSync} = require('child_process');
+const yargs = require('yargs');
+const {
+  getStartupMetrics,
+  createStartupStats,
+} = require('./lib/create-startup-stats');
+
+const STARTUP_TIMELINE_LOG_PREFIX = 'RNOH_STARTUP_TIMELINE ';
+
+const argv = yargs
+  .option('n', {
+    alias: 'runs',
+    default: 10,
+    type: 'number',
+    description: 'Number of cold starts.',
+  })
+  .option('w', {
+    alias: 'wait',
+    default: 8,
+    type: 'number',
+    description: 'Seconds to wait for the app to start and log its timeline.',
+  })
+  .option('b', {
+    alias: 'bundle',
+    default: 'com.rnoh.tester',
+    type: 'string',
+    description: 'Bundle name of the app.',
+  })
+  .example(
+    '$0 -n 20',
+    'cold starts the tester app 20 times and prints the time to first JS, the time to first frame and the peak RSS',
+  )
+  .help('h')
+  .alias('h', 'help').argv;
+
+function hdc(...args) {
+  return execFileSync('hdc', args, {encoding: 'utf8'});
+}
+
+function sleep(seconds) {
+  Atomics.wait(new Int32Array(new SharedArrayBuffer(4)), 0, 0, seconds * 1000);
+}
+
+/**
+ * The app logs the timeline once the first frame was displayed, see
+ * logStartupTimelineAfterFirstFrame in benchmarks/StartupReport.tsx.
+ */
+function readStartupTimeline() {
+  const line = hdc('shell', 'hilog', '-x')
+    .split('\n')
+    .reverse()
+    .find(logLine => logLine.includes(STARTUP_TIMELINE_LOG_PREFIX));
+  if (!line) {
+    return null;
+  }
+  const json = line.slice(
+    line.indexOf(STARTUP_TIMELINE_LOG_PREFIX) +
+      STARTUP_TIMELINE_LOG_PREFIX.length,
+  );
+  return JSON.parse(json);
+}
+
+const run = () => {
+  const metricsList = [];
+  for (let i = 0; i < argv.n; i++) {
+    hdc('shell', 'aa', 'force-stop', argv.b);
+    hdc('shell', 'hilog', '-r');
+    hdc('shell', 'aa', 'start', '-a', 'EntryAbility', '-b', argv.b);
+    sleep(argv.w);
+    const phases = readStartupTimeline();
+    if (!phases) {
+      console.warn(`run ${i + 1}: the startup timeline wasn't logged`);
+      continue;
+    }
+    const metrics = getStartupMetrics(phases);
+    console.warn(`run ${i + 1}: ${JSON.stringify(metrics)}`);
+    metricsList.push(metrics);
+  }
+  hdc('shell', 'aa', 'force-stop', argv.b);
+  console.log(JSON.stringify(createStartupStats(metricsList), null, 2));
+};
+
+run();
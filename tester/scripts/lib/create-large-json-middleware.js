@@ -0,0 +1,56 @@
+// @ts-check
+
+const LARGE_JSON_PATH = '/benchmarks/large.json';
+
+/**
+ * Creates a JSON array of objects resembling an API response, about
+ * `sizeInBytes` long.
+ * @param {number} sizeInBytes
+ */
+function createLargeJson(sizeInBytes) {
+  const items = [];
+  let length = 2;
+  for (let id = 0; length < sizeInBytes; id++) {
+    const item = JSON.stringify({
+      id,
+      name: `Item ${id}`,
+      description: 'Lorem ipsum dolor sit amet, consectetur adipiscing elit',
+      price: id * 0.25,
+      tags: ['benchmark', `group-${id % 16}`],
+      isAvailable: id % 3 !== 0,
+    });
+    items.push(item);
+    length += item.length + 1;
+  }
+  return `[${items.join(',')}]`;
+}
+
+/**
+ * Metro middleware serving `GET /benchmarks/large.json?sizeInMB=N`, which the
+ * networking benchmarks of the tester app download. Generated payloads are
+ * kept in memory, so that only the transfer is measured.
+ * @param {(req: any, res: any, next: () => void) => void} middleware
+ */
+function createLargeJsonMiddleware(middleware) {
+  /** @type {Map<number, Buffer>} */
+  const payloadBySizeInMB = new Map();
+  return (req, res, next) => {
+    const url = new URL(req.url, 'http://localhost');
+    if (url.pathname !== LARGE_JSON_PATH) {
+      return middleware(req, res, next);
+    }
+    const sizeInMB = Math.min(Number(url.searchParams.get('sizeInMB')) || 1, 64);
+    let payload = payloadBySizeInMB.get(sizeInMB);
+    if (!payload) {
+      payload = Buffer.from(createLargeJson(sizeInMB * 1024 * 1024));
+      payloadBySizeInMB.set(sizeInMB, payload);
+    }
+    res.writeHead(200, {
+      'Content-Type': 'application/json',
+      'Content-Length': payload.length,
+    });
+    res.end(payload);
+  };
+}
+
+module.exports = {createLargeJson, createLargeJsonMiddleware};
@@ -0,0 +1,13 @@
+// @ts-check
+
+const {createLargeJson} = require('./create-large-json-middleware');
+
+it('should create valid JSON of about the requested size', () => {
+  const sizeInBytes = 2 * 1024 * 1024;
+
+  const json = createLargeJson(sizeInBytes);
+
+  expect(json.length).toBeGreaterThanOrEqual(sizeInBytes);
+  expect(json.length).toBeLessThan(sizeInBytes + 1024);
+  expect(JSON.parse(json)[0].id).toBe(0);
+});
@@ -0,0 +1,84 @@
+// @ts-check
+
+/**
+ * @typedef {{
+ *   name: string,
+ *   tag: string,
+ *   startTime: number,
+ *   finishTime: number | null,
+ *   finishPeakRSSInKB: number | null,
+ * }} StartupPhase
+ */
+
+/**
+ * @param {StartupPhase[]} phases
+ * @param {string} name
+ */
+function findPhase(phases, name) {
+  return phases.find(phase => phase.name === name);
+}
+
+/**
+ * Extracts startup metrics from the native startup timeline. Times are in
+ * milliseconds since the native library was loaded, metrics of phases which
+ * weren't recorded are null.
+ * @param {StartupPhase[]} phases
+ */
+function getStartupMetrics(phases) {
+  const runJSBundle = findPhase(phases, 'RUN_JS_BUNDLE');
+  const firstFrame = findPhase(phases, 'FIRST_FRAME');
+  const toMB = (/** @type {number | null | undefined} */ sizeInKB) =>
+    sizeInKB ? sizeInKB / 1024 : null;
+  return {
+    timeToFirstJSInMs: runJSBundle?.startTime ?? null,
+    runJSBundleDurationInMs:
+      runJSBundle && runJSBundle.finishTime !== null
+        ? runJSBundle.finishTime - runJSBundle.startTime
+        : null,
+    timeToFirstFrameInMs: firstFrame?.finishTime ?? null,
+    peakRSSAfterJSBundleInMB: toMB(runJSBundle?.finishPeakRSSInKB),
+    peakRSSAtFirstFrameInMB: toMB(firstFrame?.finishPeakRSSInKB),
+  };
+}
+
+/**
+ * @param {number[]} sortedValues
+ * @param {number} percentile
+ */
+function getPercentile(sortedValues, percentile) {
+  const index = Math.ceil((percentile / 100) * sortedValues.length) - 1;
+  return sortedValues[Math.max(0, index)];
+}
+
+/**
+ * Summarizes metrics of multiple cold starts, values missing in a start are
+ * skipped.
+ * @param {ReturnType<typeof getStartupMetrics>[]} metricsList
+ */
+function createStartupStats(metricsList) {
+  /** @type {Record<string, {min: number, median: number, p90: number, max: number, count: number}>} */
+  const stats = {};
+  if (metricsList.length === 0) {
+    return stats;
+  }
+  for (const key of Object.keys(metricsList[0])) {
+    const values = metricsList
+      .map(metrics => metrics[/** @type {keyof typeof metrics} */ (key)])
+      .filter(value => value !== null)
+      .map(value => /** @type {number} */ (value))
+      .sort((a, b) => a - b);
+    if (values.length === 0) {
+      continue;
+    }
+    stats[key] = {
+      min: values[0],
+      median: getPercentile(values, 50),
+      p90: getPercentile(values, 90),
+      max: values[values.length - 1],
+      count: values.length,
+    };
+  }
+  return stats;
+}
+
+module.exports = {getStartupMetrics, createStartupStats};
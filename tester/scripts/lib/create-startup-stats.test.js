@@ -0,0 +1,65 @@
+// @ts-check
+
+const {
+  getStartupMetrics,
+  createStartupStats,
+} = require('./create-startup-stats');
+
+/**
+ * @param {string} name
+ * @param {number} startTime
+ * @param {number | null} finishTime
+ * @param {number | null} finishPeakRSSInKB
+ */
+function createPhase(name, startTime, finishTime, finishPeakRSSInKB) {
+  return {name, tag: '', startTime, finishTime, finishPeakRSSInKB};
+}
+
+it('should extract time to first JS and peak RSS from the timeline', () => {
+  const metrics = getStartupMetrics([
+    createPhase('CREATE_RN_INSTANCE', 0, 10, 40 * 1024),
+    createPhase('RUN_JS_BUNDLE', 50, 250, 80 * 1024),
+    createPhase('FIRST_FRAME', 400, 400, 96 * 1024),
+  ]);
+
+  expect(metrics).toEqual({
+    timeToFirstJSInMs: 50,
+    runJSBundleDurationInMs: 200,
+    timeToFirstFrameInMs: 400,
+    peakRSSAfterJSBundleInMB: 80,
+    peakRSSAtFirstFrameInMB: 96,
+  });
+});
+
+it('should report metrics of missing or unfinished phases as null', () => {
+  const metrics = getStartupMetrics([
+    createPhase('RUN_JS_BUNDLE', 50, null, null),
+  ]);
+
+  expect(metrics.timeToFirstJSInMs).toBe(50);
+  expect(metrics.runJSBundleDurationInMs).toBeNull();
+  expect(metrics.timeToFirstFrameInMs).toBeNull();
+  expect(metrics.peakRSSAfterJSBundleInMB).toBeNull();
+});
+
+it('should summarize cold starts, skipping missing values', () => {
+  const metricsList = [50, 10, 40, 20, 30].map(timeToFirstJSInMs => ({
+    timeToFirstJSInMs,
+    runJSBundleDurationInMs: null,
+    timeToFirstFrameInMs: null,
+    peakRSSAfterJSBundleInMB: timeToFirstJSInMs === 10 ? null : 64,
+    peakRSSAtFirstFrameInMB: null,
+  }));
+
+  const stats = createStartupStats(metricsList);
+
+  expect(stats.timeToFirstJSInMs).toEqual({
+    min: 10,
+    median: 30,
+    p90: 50,
+    max: 50,
+    count: 5,
+  });
+  expect(stats.peakRSSAfterJSBundleInMB.count).toBe(4);
+  expect(stats.runJSBundleDurationInMs).toBeUndefined();
+});
@@ -81,6 +81,28 @@ export const NetworkingTest = () => {
           expect(result.title).to.be.eq('The Basics - Networking');
         }}
       />
+      <TestCase.Logical
+        tags={['C_API']}
+        itShould="receive response headers before the response body"
+        fn={async ({expect}) => {
+          const readyStates = await new Promise<number[]>((resolve, reject) => {
+            const request = new XMLHttpRequest();
+            const states: number[] = [];
+            request.onreadystatechange = () => states.push(request.readyState);
+            request.onload = () => {
+              expect(request.status).to.be.eq(200);
+              resolve(states);
+            };
+            request.onerror = () => reject(new Error('request failed'));
+            request.open('GET', 'https://reactnative.dev/movies.json');
+            request.send();
+          });
+          expect(readyStates).to.include(XMLHttpRequest.HEADERS_RECEIVED);
+          expect(readyStates.indexOf(XMLHttpRequest.HEADERS_RECEIVED)).to.be.lt(
+            readyStates.indexOf(XMLHttpRequest.LOADING),
+          );
+        }}
+      />
       <TestCase.Logical
         tags={['C_API']}
         itShould="download data to an ArrayBuffer"